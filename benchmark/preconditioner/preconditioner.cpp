@@ -109,6 +109,17 @@ std::string encode_parameters(const char* precond_name)
                  << '-' << FLAGS_isai_power;
              return oss.str();
          }},
+        {"iluk",
+         [] {
+             return std::string{"iluk-"} +
+                    std::to_string(FLAGS_iluk_fill_level);
+         }},
+        {"fsai",
+         [] {
+             std::ostringstream oss;
+             oss << "fsai-" << FLAGS_fsai_steps << '-' << FLAGS_fsai_step_size;
+             return oss.str();
+         }},
         {"ilu-isai",
          [] {
              return std::string{"ilu-isai-"} + std::to_string(FLAGS_isai_power);
@@ -52,8 +52,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 DEFINE_string(preconditioners, "none",
               "A comma-separated list of preconditioners to use. "
               "Supported values are: none, jacobi, paric, parict, parilu, "
-              "parilut, ic, ilu, paric-isai, parict-isai, parilu-isai, "
-              "parilut-isai, ic-isai, ilu-isai, overhead");
+              "parilut, ic, ilu, iluk, paric-isai, parict-isai, parilu-isai, "
+              "parilut-isai, ic-isai, ilu-isai, fsai, overhead");
 
 DEFINE_uint32(parilu_iterations, 5,
               "The number of iterations for ParIC(T)/ParILU(T)");
@@ -63,6 +63,13 @@ DEFINE_bool(parilut_approx_select, true,
 
 DEFINE_double(parilut_limit, 2.0, "The fill-in limit for ParICT/ParILUT");
 
+DEFINE_uint32(iluk_fill_level, 1, "The maximum level of fill-in for ILU(k)");
+
+DEFINE_uint32(fsai_steps, 5, "The number of adaptive steps for FSAI");
+
+DEFINE_uint32(fsai_step_size, 2,
+              "The number of entries added per row and step for FSAI");
+
 DEFINE_int32(
     isai_power, 1,
     "Which power of the sparsity structure to use for ISAI preconditioners");
@@ -187,6 +194,18 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOpFactory>(
                      .with_factorization_factory(fact)
                      .on(exec);
          }},
+        {"iluk",
+         [](std::shared_ptr<const gko::Executor> exec) {
+             auto fact =
+                 gko::share(gko::factorization::Ilu<etype, itype>::build()
+                                .with_fill_level(FLAGS_iluk_fill_level)
+                                .on(exec));
+             return gko::preconditioner::
+                 Ilu<gko::solver::LowerTrs<etype, itype>,
+                     gko::solver::UpperTrs<etype, itype>, false, itype>::build()
+                     .with_factorization_factory(fact)
+                     .on(exec);
+         }},
         {"paric-isai",
          [](std::shared_ptr<const gko::Executor> exec) {
              auto fact =
@@ -323,6 +342,13 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOpFactory>(
                  .with_sparsity_power(FLAGS_isai_power)
                  .on(exec);
          }},
+        {"fsai",
+         [](std::shared_ptr<const gko::Executor> exec) {
+             return gko::preconditioner::Fsai<etype, itype>::build()
+                 .with_steps(FLAGS_fsai_steps)
+                 .with_step_size(FLAGS_fsai_step_size)
+                 .on(exec);
+         }},
         {"overhead", [](std::shared_ptr<const gko::Executor> exec) {
              return gko::Overhead<etype>::build()
                  .with_criteria(gko::stop::ResidualNorm<etype>::build()
@@ -0,0 +1,155 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/preconditioner/sor_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The SOR preconditioner namespace.
+ *
+ * @ingroup sor
+ */
+namespace sor {
+
+
+template <typename ValueType, typename IndexType>
+void initialize_weighted_l(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* system_matrix,
+    remove_complex<ValueType> weight, matrix::Csr<ValueType, IndexType>* l_mtx)
+{
+    const auto inv_weight = one(weight) / weight;
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto l_row_ptrs, auto l_col_idxs, auto l_vals,
+                      auto inv_weight) {
+            auto l_nz = l_row_ptrs[row];
+            const auto l_diag_nz = l_row_ptrs[row + 1] - 1;
+            // if there is no diagonal value, set it to 1 by default
+            auto diag_val = one(l_vals[l_diag_nz]);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+                const auto col = col_idxs[nz];
+                if (col < row) {
+                    l_col_idxs[l_nz] = col;
+                    l_vals[l_nz] = vals[nz];
+                    ++l_nz;
+                } else if (col == row) {
+                    diag_val = vals[nz];
+                }
+            }
+            // store the diagonal value last
+            l_col_idxs[l_diag_nz] = row;
+            l_vals[l_diag_nz] = diag_val * inv_weight;
+        },
+        system_matrix->get_size()[0], system_matrix->get_const_row_ptrs(),
+        system_matrix->get_const_col_idxs(), system_matrix->get_const_values(),
+        l_mtx->get_const_row_ptrs(), l_mtx->get_col_idxs(),
+        l_mtx->get_values(), inv_weight);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L);
+
+
+template <typename ValueType, typename IndexType>
+void initialize_weighted_l_u(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* system_matrix,
+    remove_complex<ValueType> weight, matrix::Csr<ValueType, IndexType>* l_mtx,
+    matrix::Csr<ValueType, IndexType>* u_mtx)
+{
+    const auto inv_weight = one(weight) / weight;
+    const auto inv_two_minus_weight =
+        one(weight) / (static_cast<remove_complex<ValueType>>(2.0) - weight);
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto l_row_ptrs, auto l_col_idxs, auto l_vals,
+                      auto u_row_ptrs, auto u_col_idxs, auto u_vals,
+                      auto weight, auto inv_weight, auto inv_two_minus_weight) {
+            const auto l_diag_nz = l_row_ptrs[row + 1] - 1;
+            const auto u_diag_nz = u_row_ptrs[row];
+            // if there is no diagonal value, set it to 1 by default
+            auto diag_val = one(l_vals[l_diag_nz]);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+                if (col_idxs[nz] == row) {
+                    diag_val = vals[nz];
+                }
+            }
+            // the upper factor is scaled such that L * U equals the SSOR
+            // matrix
+            const auto u_scale = weight * inv_two_minus_weight / diag_val;
+            auto l_nz = l_row_ptrs[row];
+            // the diagonal is stored first in U
+            auto u_nz = u_diag_nz + 1;
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+                const auto col = col_idxs[nz];
+                if (col < row) {
+                    l_col_idxs[l_nz] = col;
+                    l_vals[l_nz] = vals[nz];
+                    ++l_nz;
+                } else if (col > row) {
+                    u_col_idxs[u_nz] = col;
+                    u_vals[u_nz] = vals[nz] * u_scale;
+                    ++u_nz;
+                }
+            }
+            l_col_idxs[l_diag_nz] = row;
+            l_vals[l_diag_nz] = diag_val * inv_weight;
+            u_col_idxs[u_diag_nz] = row;
+            u_vals[u_diag_nz] = one(u_vals[u_diag_nz]) * inv_two_minus_weight;
+        },
+        system_matrix->get_size()[0], system_matrix->get_const_row_ptrs(),
+        system_matrix->get_const_col_idxs(), system_matrix->get_const_values(),
+        l_mtx->get_const_row_ptrs(), l_mtx->get_col_idxs(), l_mtx->get_values(),
+        u_mtx->get_const_row_ptrs(), u_mtx->get_col_idxs(), u_mtx->get_values(),
+        weight, inv_weight, inv_two_minus_weight);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U);
+
+
+}  // namespace sor
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
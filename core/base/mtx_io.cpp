@@ -831,10 +831,7 @@ struct select_helper<false> {
 
 template <typename FileValueType, typename FileIndexType, typename ValueType,
           typename IndexType>
-matrix_data<ValueType, IndexType> read_binary_convert(std::istream& is,
-                                                      uint64 num_rows,
-                                                      uint64 num_cols,
-                                                      uint64 num_entries)
+void check_binary_convertible(uint64 num_rows, uint64 num_cols)
 {
     if (num_rows > std::numeric_limits<IndexType>::max() ||
         num_cols > std::numeric_limits<IndexType>::max()) {
@@ -845,26 +842,105 @@ matrix_data<ValueType, IndexType> read_binary_convert(std::istream& is,
         throw GKO_STREAM_ERROR(
             "cannot read into this format, would assign complex to real");
     }
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+matrix_data_entry<ValueType, IndexType> read_binary_entry(std::istream& is,
+                                                          size_type i)
+{
+    constexpr auto entry_binary_size =
+        sizeof(FileValueType) + 2 * sizeof(FileIndexType);
+    std::array<char, entry_binary_size> block;
+    GKO_CHECK_STREAM(is.read(block.data(), entry_binary_size),
+                     "failed reading entry " + std::to_string(i));
+    FileValueType value{};
+    FileIndexType row{};
+    FileIndexType column{};
+    std::memcpy(&row, &block[0], sizeof(FileIndexType));
+    std::memcpy(&column, &block[sizeof(FileIndexType)], sizeof(FileIndexType));
+    std::memcpy(&value, &block[2 * sizeof(FileIndexType)],
+                sizeof(FileValueType));
+    return {static_cast<IndexType>(row), static_cast<IndexType>(column),
+            static_cast<ValueType>(select_helper<is_complex<ValueType>()>::get(
+                value, real(value)))};
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+matrix_data<ValueType, IndexType> read_binary_convert(std::istream& is,
+                                                      uint64 num_rows,
+                                                      uint64 num_cols,
+                                                      uint64 num_entries)
+{
+    check_binary_convertible<FileValueType, FileIndexType, ValueType,
+                             IndexType>(num_rows, num_cols);
     matrix_data<ValueType, IndexType> result(gko::dim<2>{num_rows, num_cols});
     result.nonzeros.resize(num_entries);
+    for (size_type i = 0; i < num_entries; i++) {
+        result.nonzeros[i] =
+            read_binary_entry<FileValueType, FileIndexType, ValueType,
+                              IndexType>(is, i);
+    }
+    // sort the entries
+    result.ensure_row_major_order();
+    return result;
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+matrix_data<ValueType, IndexType> read_binary_rows_convert(
+    std::istream& is, uint64 num_rows, uint64 num_cols, uint64 num_entries,
+    IndexType row_begin, IndexType row_end)
+{
+    check_binary_convertible<FileValueType, FileIndexType, ValueType,
+                             IndexType>(num_rows, num_cols);
     constexpr auto entry_binary_size =
         sizeof(FileValueType) + 2 * sizeof(FileIndexType);
-    for (size_type i = 0; i < num_entries; i++) {
-        std::array<char, entry_binary_size> block;
-        GKO_CHECK_STREAM(is.read(block.data(), entry_binary_size),
-                         "failed reading entry " + std::to_string(i));
-        FileValueType value{};
-        FileIndexType row{};
-        FileIndexType column{};
-        std::memcpy(&row, &block[0], sizeof(FileIndexType));
-        std::memcpy(&column, &block[sizeof(FileIndexType)],
-                    sizeof(FileIndexType));
-        std::memcpy(&value, &block[2 * sizeof(FileIndexType)],
-                    sizeof(FileValueType));
-        result.nonzeros[i].value = static_cast<ValueType>(
-            select_helper<is_complex<ValueType>()>::get(value, real(value)));
-        result.nonzeros[i].row = row;
-        result.nonzeros[i].column = column;
+    const auto entries_begin = is.tellg();
+    GKO_CHECK_STREAM(is, "failed determining the stream position");
+    const auto seek_entry = [&](uint64 i) {
+        GKO_CHECK_STREAM(
+            is.seekg(entries_begin +
+                     static_cast<std::streamoff>(i * entry_binary_size)),
+            "failed seeking entry " + std::to_string(i));
+    };
+    // binary search for the first entry with a row index not below row
+    const auto find_row_begin = [&](IndexType row) {
+        uint64 begin{};
+        auto end = num_entries;
+        while (begin < end) {
+            const auto mid = begin + (end - begin) / 2;
+            FileIndexType mid_row{};
+            seek_entry(mid);
+            GKO_CHECK_STREAM(is.read(reinterpret_cast<char*>(&mid_row),
+                                     sizeof(FileIndexType)),
+                             "failed reading entry " + std::to_string(mid));
+            if (mid_row < row) {
+                begin = mid + 1;
+            } else {
+                end = mid;
+            }
+        }
+        return begin;
+    };
+    const auto begin = find_row_begin(row_begin);
+    const auto end = std::max(begin, find_row_begin(row_end));
+    matrix_data<ValueType, IndexType> result(gko::dim<2>{num_rows, num_cols});
+    result.nonzeros.resize(end - begin);
+    seek_entry(begin);
+    for (size_type i = 0; i < end - begin; i++) {
+        result.nonzeros[i] =
+            read_binary_entry<FileValueType, FileIndexType, ValueType,
+                              IndexType>(is, begin + i);
+        if (result.nonzeros[i].row < row_begin ||
+            result.nonzeros[i].row >= row_end) {
+            throw GKO_STREAM_ERROR(
+                "the binary matrix entries are not sorted by row");
+        }
     }
     // sort the entries
     result.ensure_row_major_order();
@@ -914,6 +990,46 @@ matrix_data<ValueType, IndexType> read_binary_raw(std::istream& is)
 }
 
 
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_binary_raw_rows(std::istream& is,
+                                                       IndexType row_begin,
+                                                       IndexType row_end)
+{
+    std::array<char, 32> header{};
+    GKO_CHECK_STREAM(is.read(header.data(), 32), "failed reading header");
+    uint64 magic{};
+    uint64 num_rows{};
+    uint64 num_cols{};
+    uint64 num_entries{};
+    std::memcpy(&magic, &header[0], 8);
+    std::memcpy(&num_rows, &header[8], 8);
+    std::memcpy(&num_cols, &header[16], 8);
+    std::memcpy(&num_entries, &header[24], 8);
+#define DECLARE_OVERLOAD(_vtype, _itype)                                       \
+    else if (magic == binary_format_magic<_vtype, _itype>())                   \
+    {                                                                          \
+        return read_binary_rows_convert<_vtype, _itype, ValueType, IndexType>( \
+            is, num_rows, num_cols, num_entries, row_begin, row_end);          \
+    }
+    if (false) {
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    else
+    {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(header.data(), 8) + "'");
+    }
+}
+
+
 template <typename ValueType, typename IndexType>
 matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
 {
@@ -985,6 +1101,9 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                    layout_type layout)
 #define GKO_DECLARE_READ_BINARY_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_binary_raw(std::istream& is)
+#define GKO_DECLARE_READ_BINARY_RAW_ROWS(ValueType, IndexType) \
+    matrix_data<ValueType, IndexType> read_binary_raw_rows(    \
+        std::istream& is, IndexType row_begin, IndexType row_end)
 #define GKO_DECLARE_WRITE_BINARY_RAW(ValueType, IndexType) \
     void write_binary_raw(std::ostream& os,                \
                           const matrix_data<ValueType, IndexType>& data)
@@ -993,6 +1112,8 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_BINARY_RAW_ROWS);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
 
@@ -34,6 +34,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_COMPONENTS_DISJOINT_SETS_HPP_
 
 
+#include <algorithm>
+
+
 #include <ginkgo/core/base/array.hpp>
 
 
@@ -61,7 +64,8 @@ public:
     explicit disjoint_sets(std::shared_ptr<const Executor> exec, IndexType size)
         : parents_{exec->get_master(), static_cast<size_type>(size)}
     {
-        parents_.fill(-1);
+        // the storage is on the host, so we don't need to dispatch a kernel
+        std::fill_n(parents_.get_data(), size, -1);
     }
 
     /**
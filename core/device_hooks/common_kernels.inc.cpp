@@ -65,15 +65,24 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/multigrid/classical_coarsening_kernels.hpp"
+#include "core/multigrid/galerkin_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
+#include "core/multigrid/smoothed_aggregation_kernels.hpp"
+#include "core/preconditioner/bilu_kernels.hpp"
+#include "core/preconditioner/fsai_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/preconditioner/sor_kernels.hpp"
+#include "core/reorder/coloring_kernels.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
 #include "core/solver/bicgstab_kernels.hpp"
 #include "core/solver/cb_gmres_kernels.hpp"
 #include "core/solver/cg_kernels.hpp"
 #include "core/solver/cgs_kernels.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
 #include "core/solver/common_gmres_kernels.hpp"
 #include "core/solver/fcg_kernels.hpp"
 #include "core/solver/gcr_kernels.hpp"
@@ -247,6 +256,7 @@ GKO_STUB(GKO_PARTITION_COUNT_RANGES);
 GKO_STUB_INDEX_TYPE(GKO_PARTITION_BUILD_FROM_CONTIGUOUS);
 GKO_STUB_INDEX_TYPE(GKO_PARTITION_BUILD_FROM_MAPPING);
 GKO_STUB_INDEX_TYPE(GKO_PARTITION_BUILD_FROM_GLOBAL_SIZE);
+GKO_STUB_INDEX_TYPE(GKO_PARTITION_COMPUTE_GRAPH_MAPPING);
 GKO_STUB_LOCAL_GLOBAL_TYPE(GKO_DECLARE_PARTITION_BUILD_STARTING_INDICES);
 GKO_STUB_LOCAL_GLOBAL_TYPE(GKO_DECLARE_PARTITION_IS_ORDERED);
 
@@ -267,6 +277,7 @@ namespace distributed_matrix {
 
 
 GKO_STUB_VALUE_AND_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_BUILD_LOCAL_NONLOCAL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DISTRIBUTED_MATRIX_ADD_SCALED_ROWS);
 
 
 }  // namespace distributed_matrix
@@ -438,6 +449,16 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_CGS_STEP_3_KERNEL);
 
 }  // namespace cgs
 
+
+namespace chebyshev {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL);
+
+
+}  // namespace chebyshev
+
 namespace gcr {
 
 
@@ -703,9 +724,39 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
 }  // namespace isai
 
 
+namespace bilu {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BILU_FACTORIZE_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BILU_APPLY_KERNEL);
+
+
+}  // namespace bilu
+
+
+namespace fsai {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FSAI_GENERATE_KERNEL);
+
+
+}  // namespace fsai
+
+
+namespace sor {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U);
+
+
+}  // namespace sor
+
+
 namespace cholesky {
 
 
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_CHOLESKY_COMPUTE_SKELETON_TREE);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_SYMBOLIC_COUNT);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_SYMBOLIC_FACTORIZE);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_FOREST_FROM_FACTOR);
@@ -753,6 +804,8 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
 namespace lu_factorization {
 
 
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_LU_SYMBOLIC_FACTORIZE);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_INITIALIZE);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_FACTORIZE);
 
@@ -801,6 +854,25 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 
 
 }  // namespace par_ilut_factorization
+namespace coloring {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_COLORING_COLOR_GRAPH_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_COLORING_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace coloring
+
+
+namespace nested_dissection {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_NESTED_DISSECTION_COMPUTE_ORDERING_KERNEL);
+
+
+}  // namespace nested_dissection
+
+
 namespace rcm {
 
 
@@ -826,11 +898,48 @@ GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
 GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
 
 
 }  // namespace pgm
 
 
+namespace smoothed_aggregation {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SMOOTHED_AGGREGATION_FILTER_MATRIX);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SMOOTHED_AGGREGATION_AGGREGATE);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_COMPUTE_PROLONGATOR);
+
+
+}  // namespace smoothed_aggregation
+
+
+namespace classical_coarsening {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_COMPUTE_STRENGTH);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_SELECT_COARSE_POINTS);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_COMPUTE_INTERPOLATION);
+
+
+}  // namespace classical_coarsening
+
+
+namespace galerkin {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_GALERKIN_COMPUTE_RAP_SYMBOLIC);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_GALERKIN_COMPUTE_RAP_NUMERIC);
+
+
+}  // namespace galerkin
+
+
 namespace set_all_statuses {
 
 
@@ -35,6 +35,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 
 #include <ginkgo/config.hpp>
@@ -212,6 +214,54 @@ create_submatrix_helper(experimental::distributed::Vector<ValueType>* mtx,
 #endif
 
 
+/**
+ * Computes the conjugate dot products of several vector pairs. For dense
+ * vectors, this is equivalent to calling compute_conj_dot on each pair.
+ *
+ * @param pairs  the vector pairs (x_i, y_i)
+ * @param results  the results, one 1 x num_cols row vector per pair
+ * @param tmp  the temporary storage used for the reductions
+ */
+template <typename ValueType>
+void compute_conj_dots(
+    const std::vector<std::pair<const matrix::Dense<ValueType>*,
+                                const matrix::Dense<ValueType>*>>& pairs,
+    const std::vector<matrix::Dense<ValueType>*>& results, array<char>& tmp)
+{
+    GKO_ASSERT_EQ(pairs.size(), results.size());
+    for (size_type i = 0; i < pairs.size(); ++i) {
+        pairs[i].first->compute_conj_dot(pairs[i].second, results[i], tmp);
+    }
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+/**
+ * Computes the conjugate dot products of several distributed vector pairs,
+ * combining the global reductions into a single one.
+ *
+ * @param pairs  the vector pairs (x_i, y_i)
+ * @param results  the results, one 1 x num_cols row vector per pair
+ * @param tmp  the temporary storage used for the reductions
+ */
+template <typename ValueType>
+void compute_conj_dots(
+    const std::vector<
+        std::pair<const experimental::distributed::Vector<ValueType>*,
+                  const experimental::distributed::Vector<ValueType>*>>&
+        pairs,
+    const std::vector<matrix::Dense<ValueType>*>& results, array<char>& tmp)
+{
+    experimental::distributed::Vector<ValueType>::compute_conj_dots(
+        pairs, results, tmp);
+}
+
+
+#endif
+
+
 }  // namespace detail
 }  // namespace gko
 
@@ -33,6 +33,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/distributed/matrix.hpp>
 
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+
+#include <ginkgo/core/base/mtx_io.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
@@ -50,12 +56,163 @@ namespace {
 
 GKO_REGISTER_OPERATION(build_local_nonlocal,
                        distributed_matrix::build_local_nonlocal);
+GKO_REGISTER_OPERATION(add_scaled_rows, distributed_matrix::add_scaled_rows);
 
 
 }  // namespace
 }  // namespace matrix
 
 
+namespace {
+
+
+/**
+ * Sends the entries of rows owned by other processes to their owners, using
+ * a single exchange with the processes that actually share entries.
+ *
+ * @return  the entries of the rows owned by this process on exec, including
+ *          the received ones, sorted in row-major order without duplicates.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> assemble_rows_from_neighbors(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const device_matrix_data<ValueType, GlobalIndexType>& data,
+    const Partition<LocalIndexType, GlobalIndexType>* row_partition)
+{
+    using nonzero_type = matrix_data_entry<ValueType, GlobalIndexType>;
+    auto host_exec = exec->get_master();
+    const auto rank = comm.rank();
+    const auto num_parts = comm.size();
+    auto host_data = data.copy_to_host();
+    auto host_partition = make_temporary_clone(host_exec, row_partition);
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    const auto num_ranges = host_partition->get_num_ranges();
+
+    // determine the owner of each entry, the entries are usually sorted by
+    // row, so the previous range is checked first
+    const auto num_entries = host_data.nonzeros.size();
+    std::vector<comm_index_type> owners(num_entries);
+    std::vector<comm_index_type> send_sizes(num_parts);
+    size_type range = 0;
+    for (size_type i = 0; i < num_entries; ++i) {
+        const auto row = host_data.nonzeros[i].row;
+        if (row < range_bounds[range] || row >= range_bounds[range + 1]) {
+            range = std::distance(
+                range_bounds + 1,
+                std::upper_bound(range_bounds + 1,
+                                 range_bounds + num_ranges + 1, row));
+        }
+        owners[i] = part_ids[range];
+        send_sizes[owners[i]]++;
+    }
+    std::vector<comm_index_type> recv_sizes(num_parts);
+    comm.all_to_all(host_exec, send_sizes.data(), 1, recv_sizes.data(), 1);
+
+    // only the processes sharing entries take part in the exchange
+    std::vector<comm_index_type> sources;
+    std::vector<comm_index_type> destinations;
+    std::vector<comm_index_type> neighbor_send_sizes;
+    std::vector<comm_index_type> neighbor_send_offsets{0};
+    std::vector<comm_index_type> neighbor_recv_sizes;
+    std::vector<comm_index_type> neighbor_recv_offsets{0};
+    std::vector<comm_index_type> send_positions(num_parts);
+    for (comm_index_type part = 0; part < num_parts; ++part) {
+        if (part == rank) {
+            continue;
+        }
+        if (send_sizes[part] > 0) {
+            send_positions[part] = neighbor_send_offsets.back();
+            destinations.push_back(part);
+            neighbor_send_sizes.push_back(send_sizes[part]);
+            neighbor_send_offsets.push_back(neighbor_send_offsets.back() +
+                                            send_sizes[part]);
+        }
+        if (recv_sizes[part] > 0) {
+            sources.push_back(part);
+            neighbor_recv_sizes.push_back(recv_sizes[part]);
+            neighbor_recv_offsets.push_back(neighbor_recv_offsets.back() +
+                                            recv_sizes[part]);
+        }
+    }
+    std::vector<nonzero_type> send_entries(neighbor_send_offsets.back());
+    matrix_data<ValueType, GlobalIndexType> local_data{data.get_size()};
+    local_data.nonzeros.reserve(send_sizes[rank] +
+                                neighbor_recv_offsets.back());
+    for (size_type i = 0; i < num_entries; ++i) {
+        if (owners[i] == rank) {
+            local_data.nonzeros.push_back(host_data.nonzeros[i]);
+        } else {
+            send_entries[send_positions[owners[i]]++] = host_data.nonzeros[i];
+        }
+    }
+
+    // the entries are exchanged as a whole, so a single message per neighbor
+    // suffices
+    std::vector<nonzero_type> recv_entries(neighbor_recv_offsets.back());
+    mpi::communicator neighbor_comm(comm, sources, destinations);
+    mpi::contiguous_type entry_type(sizeof(nonzero_type), MPI_CHAR);
+    neighbor_comm.neighbor_all_to_all_v(
+        host_exec, send_entries.data(), neighbor_send_sizes.data(),
+        neighbor_send_offsets.data(), entry_type.get(), recv_entries.data(),
+        neighbor_recv_sizes.data(), neighbor_recv_offsets.data(),
+        entry_type.get());
+    local_data.nonzeros.insert(local_data.nonzeros.end(), recv_entries.begin(),
+                               recv_entries.end());
+
+    auto result = device_matrix_data<ValueType, GlobalIndexType>::
+        create_from_host(exec, local_data);
+    result.sum_duplicates();
+    return result;
+}
+
+
+bool supports_shared_memory(std::shared_ptr<const Executor> exec)
+{
+    return exec == exec->get_master();
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+struct Matrix<ValueType, LocalIndexType, GlobalIndexType>::shared_halo_state {
+    explicit shared_halo_state(mpi::communicator node_comm)
+        : node_comm{std::move(node_comm)},
+          inter_node_comm{MPI_COMM_NULL},
+          num_cols{},
+          window_base{}
+    {}
+
+    ~shared_halo_state()
+    {
+        if (window.get_window() != MPI_WIN_NULL) {
+            window.unlock_all();
+        }
+    }
+
+    // the processes sharing memory with this process
+    mpi::communicator node_comm;
+    // graph communicator restricted to the neighbors on other nodes, which
+    // send into and receive from the segment of this process
+    mpi::communicator inter_node_comm;
+    std::vector<comm_index_type> inter_node_send_sizes;
+    std::vector<comm_index_type> inter_node_send_offsets;
+    std::vector<comm_index_type> inter_node_recv_sizes;
+    std::vector<comm_index_type> inter_node_recv_offsets;
+    // the first window row of the segment of each process on the node. A
+    // segment consists of the send buffer of the process, followed by the
+    // values it receives from other nodes.
+    std::vector<comm_index_type> segment_offsets;
+    // the boundary matrix with columns referring to the window rows
+    std::shared_ptr<LinOp> boundary_mtx;
+    size_type num_cols;
+    mpi::window<ValueType> window;
+    ValueType* window_base;
+};
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
     std::shared_ptr<const Executor> exec, mpi::communicator comm)
@@ -87,7 +244,11 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
       non_local_to_global_{exec},
       one_scalar_{},
       local_mtx_{local_matrix_template->clone(exec)},
-      non_local_mtx_{non_local_matrix_template->clone(exec)}
+      non_local_mtx_{non_local_matrix_template->clone(exec)},
+      boundary_rows_{exec},
+      boundary_mtx_{non_local_matrix_template->clone(exec)},
+      scatter_mtx_{
+          gko::matrix::Csr<value_type, local_index_type>::create(exec)}
 {
     GKO_ASSERT(
         (dynamic_cast<ReadableFromMatrixData<ValueType, LocalIndexType>*>(
@@ -109,12 +270,29 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::convert_to(
                result->get_communicator().size());
     result->local_mtx_->copy_from(this->local_mtx_);
     result->non_local_mtx_->copy_from(this->non_local_mtx_);
+    result->boundary_rows_ = this->boundary_rows_;
+    result->boundary_mtx_->copy_from(this->boundary_mtx_);
+    result->scatter_mtx_->copy_from(this->scatter_mtx_);
+    result->transposed_local_mtx_.reset();
+    result->transposed_non_local_mtx_.reset();
+    result->shared_memory_halo_ =
+        this->shared_memory_halo_ &&
+        supports_shared_memory(result->get_executor());
+    result->shared_halo_.reset();
     result->gather_idxs_ = this->gather_idxs_;
     result->send_offsets_ = this->send_offsets_;
     result->recv_offsets_ = this->recv_offsets_;
     result->recv_sizes_ = this->recv_sizes_;
     result->send_sizes_ = this->send_sizes_;
+    result->neighbor_comm_ = this->neighbor_comm_;
+    result->reverse_neighbor_comm_ = this->reverse_neighbor_comm_;
+    result->neighbor_send_offsets_ = this->neighbor_send_offsets_;
+    result->neighbor_send_sizes_ = this->neighbor_send_sizes_;
+    result->neighbor_recv_offsets_ = this->neighbor_recv_offsets_;
+    result->neighbor_recv_sizes_ = this->neighbor_recv_sizes_;
     result->non_local_to_global_ = this->non_local_to_global_;
+    result->row_partition_ = this->row_partition_;
+    result->col_partition_ = this->col_partition_;
     result->set_size(this->get_size());
 }
 
@@ -128,12 +306,32 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::move_to(
                result->get_communicator().size());
     result->local_mtx_->move_from(this->local_mtx_);
     result->non_local_mtx_->move_from(this->non_local_mtx_);
+    result->boundary_rows_ = std::move(this->boundary_rows_);
+    result->boundary_mtx_->move_from(this->boundary_mtx_);
+    result->scatter_mtx_->move_from(this->scatter_mtx_);
+    result->transposed_local_mtx_.reset();
+    result->transposed_non_local_mtx_.reset();
+    this->transposed_local_mtx_.reset();
+    this->transposed_non_local_mtx_.reset();
+    result->shared_memory_halo_ =
+        this->shared_memory_halo_ &&
+        supports_shared_memory(result->get_executor());
+    result->shared_halo_.reset();
+    this->shared_halo_.reset();
     result->gather_idxs_ = std::move(this->gather_idxs_);
     result->send_offsets_ = std::move(this->send_offsets_);
     result->recv_offsets_ = std::move(this->recv_offsets_);
     result->recv_sizes_ = std::move(this->recv_sizes_);
     result->send_sizes_ = std::move(this->send_sizes_);
+    result->neighbor_comm_ = this->neighbor_comm_;
+    result->reverse_neighbor_comm_ = this->reverse_neighbor_comm_;
+    result->neighbor_send_offsets_ = std::move(this->neighbor_send_offsets_);
+    result->neighbor_send_sizes_ = std::move(this->neighbor_send_sizes_);
+    result->neighbor_recv_offsets_ = std::move(this->neighbor_recv_offsets_);
+    result->neighbor_recv_sizes_ = std::move(this->neighbor_recv_sizes_);
     result->non_local_to_global_ = std::move(this->non_local_to_global_);
+    result->row_partition_ = std::move(this->row_partition_);
+    result->col_partition_ = std::move(this->col_partition_);
     result->set_size(this->get_size());
     this->set_size({});
 }
@@ -145,13 +343,21 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     ptr_param<const Partition<local_index_type, global_index_type>>
         row_partition,
     ptr_param<const Partition<local_index_type, global_index_type>>
-        col_partition)
+        col_partition,
+    assembly_mode assembly_type)
 {
     const auto comm = this->get_communicator();
     GKO_ASSERT_EQ(data.get_size()[0], row_partition->get_size());
     GKO_ASSERT_EQ(data.get_size()[1], col_partition->get_size());
     GKO_ASSERT_EQ(comm.size(), row_partition->get_num_parts());
     GKO_ASSERT_EQ(comm.size(), col_partition->get_num_parts());
+    if (assembly_type == assembly_mode::communicate) {
+        this->read_distributed(
+            assemble_rows_from_neighbors(this->get_executor(), comm, data,
+                                         row_partition.get()),
+            row_partition, col_partition, assembly_mode::local_only);
+        return;
+    }
     auto exec = this->get_executor();
     auto local_part = comm.rank();
 
@@ -189,14 +395,45 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     device_matrix_data<value_type, local_index_type> local_data{
         exec, dim<2>{num_local_rows, num_local_cols}, std::move(local_row_idxs),
         std::move(local_col_idxs), std::move(local_values)};
+    as<ReadableFromMatrixData<ValueType, LocalIndexType>>(this->local_mtx_)
+        ->read(std::move(local_data));
+
+    // compress the non-local entries to the boundary rows, i.e. the local rows
+    // that have at least one entry in a non-local column
+    auto host_exec = exec->get_master();
+    array<local_index_type> boundary_row_idxs{host_exec, non_local_row_idxs};
+    array<local_index_type> boundary_row_map{host_exec, num_local_rows};
+    boundary_row_map.fill(0);
+    for (size_type i = 0; i < boundary_row_idxs.get_num_elems(); ++i) {
+        boundary_row_map.get_data()[boundary_row_idxs.get_const_data()[i]] = 1;
+    }
+    std::vector<local_index_type> host_boundary_rows;
+    for (size_type row = 0; row < num_local_rows; ++row) {
+        if (boundary_row_map.get_const_data()[row]) {
+            boundary_row_map.get_data()[row] =
+                static_cast<local_index_type>(host_boundary_rows.size());
+            host_boundary_rows.push_back(static_cast<local_index_type>(row));
+        }
+    }
+    for (size_type i = 0; i < boundary_row_idxs.get_num_elems(); ++i) {
+        auto& row = boundary_row_idxs.get_data()[i];
+        row = boundary_row_map.get_const_data()[row];
+    }
+    boundary_rows_ = array<local_index_type>{exec, host_boundary_rows.begin(),
+                                             host_boundary_rows.end()};
+    device_matrix_data<value_type, local_index_type> boundary_data{
+        exec, dim<2>{host_boundary_rows.size(), num_non_local_cols},
+        array<local_index_type>{exec, boundary_row_idxs},
+        array<local_index_type>{exec, non_local_col_idxs},
+        array<value_type>{exec, non_local_values}};
     device_matrix_data<value_type, local_index_type> non_local_data{
         exec, dim<2>{num_local_rows, num_non_local_cols},
         std::move(non_local_row_idxs), std::move(non_local_col_idxs),
         std::move(non_local_values)};
-    as<ReadableFromMatrixData<ValueType, LocalIndexType>>(this->local_mtx_)
-        ->read(std::move(local_data));
     as<ReadableFromMatrixData<ValueType, LocalIndexType>>(this->non_local_mtx_)
         ->read(std::move(non_local_data));
+    as<ReadableFromMatrixData<ValueType, LocalIndexType>>(this->boundary_mtx_)
+        ->read(std::move(boundary_data));
 
     // exchange step 1: determine recv_sizes, send_sizes, send_offsets
     exec->get_master()->copy_from(
@@ -224,6 +461,50 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     if (use_host_buffer) {
         gather_idxs_.set_executor(exec);
     }
+    const auto send_size = static_cast<size_type>(send_offsets_.back());
+    array<local_index_type> scatter_col_idxs{exec->get_master(), send_size};
+    std::iota(scatter_col_idxs.get_data(),
+              scatter_col_idxs.get_data() + send_size, local_index_type{});
+    array<value_type> scatter_values{exec, send_size};
+    scatter_values.fill(one<value_type>());
+    device_matrix_data<value_type, local_index_type> scatter_data{
+        exec, dim<2>{num_local_cols, send_size},
+        array<local_index_type>{exec, gather_idxs_},
+        array<local_index_type>{exec, std::move(scatter_col_idxs)},
+        std::move(scatter_values)};
+    scatter_data.sort_row_major();
+    as<ReadableFromMatrixData<ValueType, LocalIndexType>>(this->scatter_mtx_)
+        ->read(std::move(scatter_data));
+    transposed_local_mtx_.reset();
+    transposed_non_local_mtx_.reset();
+    shared_halo_.reset();
+
+    // exchange step 3: restrict the communication to the actual neighbors
+    std::vector<comm_index_type> sources;
+    std::vector<comm_index_type> destinations;
+    neighbor_send_offsets_.clear();
+    neighbor_send_sizes_.clear();
+    neighbor_recv_offsets_.clear();
+    neighbor_recv_sizes_.clear();
+    for (comm_index_type part = 0; part < comm.size(); ++part) {
+        if (recv_sizes_[part] > 0) {
+            sources.push_back(part);
+            neighbor_recv_offsets_.push_back(recv_offsets_[part]);
+            neighbor_recv_sizes_.push_back(recv_sizes_[part]);
+        }
+        if (send_sizes_[part] > 0) {
+            destinations.push_back(part);
+            neighbor_send_offsets_.push_back(send_offsets_[part]);
+            neighbor_send_sizes_.push_back(send_sizes_[part]);
+        }
+    }
+    neighbor_comm_ = mpi::communicator(comm, sources, destinations);
+    reverse_neighbor_comm_ = mpi::communicator(comm, destinations, sources);
+
+    row_partition_ = gko::clone(exec, row_partition.get());
+    col_partition_ = row_partition.get() == col_partition.get()
+                         ? row_partition_
+                         : gko::clone(exec, col_partition.get());
 }
 
 
@@ -233,33 +514,81 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     ptr_param<const Partition<local_index_type, global_index_type>>
         row_partition,
     ptr_param<const Partition<local_index_type, global_index_type>>
-        col_partition)
+        col_partition,
+    assembly_mode assembly_type)
 {
     this->read_distributed(
         device_matrix_data<value_type, global_index_type>::create_from_host(
             this->get_executor(), data),
-        row_partition, col_partition);
+        row_partition, col_partition, assembly_type);
 }
 
 
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     const matrix_data<ValueType, global_index_type>& data,
-    ptr_param<const Partition<local_index_type, global_index_type>> partition)
+    ptr_param<const Partition<local_index_type, global_index_type>> partition,
+    assembly_mode assembly_type)
 {
     this->read_distributed(
         device_matrix_data<value_type, global_index_type>::create_from_host(
             this->get_executor(), data),
-        partition, partition);
+        partition, partition, assembly_type);
 }
 
 
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     const device_matrix_data<ValueType, GlobalIndexType>& data,
+    ptr_param<const Partition<local_index_type, global_index_type>> partition,
+    assembly_mode assembly_type)
+{
+    this->read_distributed(data, partition, partition, assembly_type);
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType,
+            GlobalIndexType>::read_distributed_binary(
+    std::istream& is,
+    ptr_param<const Partition<local_index_type, global_index_type>>
+        row_partition,
+    ptr_param<const Partition<local_index_type, global_index_type>>
+        col_partition)
+{
+    const auto rank = this->get_communicator().rank();
+    auto host_partition =
+        make_temporary_clone(this->get_executor()->get_master(), row_partition);
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    matrix_data<value_type, global_index_type> data{
+        dim<2>{static_cast<size_type>(row_partition->get_size()),
+               static_cast<size_type>(col_partition->get_size())}};
+    const auto start = is.tellg();
+    for (size_type range = 0; range < host_partition->get_num_ranges();
+         range++) {
+        if (part_ids[range] != rank) {
+            continue;
+        }
+        // every read starts at the header to find the entries of the range
+        is.seekg(start);
+        auto range_data = read_binary_raw_rows<value_type, global_index_type>(
+            is, range_bounds[range], range_bounds[range + 1]);
+        GKO_ASSERT_EQUAL_DIMENSIONS(range_data.size, data.size);
+        data.nonzeros.insert(data.nonzeros.end(), range_data.nonzeros.begin(),
+                             range_data.nonzeros.end());
+    }
+    this->read_distributed(data, row_partition, col_partition);
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType,
+            GlobalIndexType>::read_distributed_binary(
+    std::istream& is,
     ptr_param<const Partition<local_index_type, global_index_type>> partition)
 {
-    this->read_distributed(data, partition, partition);
+    this->read_distributed_binary(is, partition, partition);
 }
 
 
@@ -274,6 +603,41 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
     auto recv_size = recv_offsets_.back();
     auto send_dim = dim<2>{static_cast<size_type>(send_size), num_cols};
     auto recv_dim = dim<2>{static_cast<size_type>(recv_size), num_cols};
+    if (shared_memory_halo_) {
+        this->prepare_shared_halo(num_cols);
+        auto& state = *shared_halo_;
+        auto segment =
+            state.window_base +
+            state.segment_offsets[state.node_comm.rank()] * num_cols;
+        // the other processes on the node need to be done reading the values
+        // of the previous apply before they are overwritten
+        state.window.sync();
+        state.node_comm.synchronize();
+        state.window.sync();
+        auto send_view = local_vector_type::create(
+            exec, send_dim,
+            make_array_view(exec, send_dim[0] * num_cols, segment), num_cols);
+        local_b->row_gather(&gather_idxs_, send_view.get());
+
+        // only the values for the other nodes are sent
+        mpi::contiguous_type type(num_cols,
+                                  mpi::type_impl<ValueType>::get_type());
+        exec->synchronize();
+#ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
+        state.inter_node_comm.neighbor_all_to_all_v(
+            exec, segment, state.inter_node_send_sizes.data(),
+            state.inter_node_send_offsets.data(), type.get(), segment,
+            state.inter_node_recv_sizes.data(),
+            state.inter_node_recv_offsets.data(), type.get());
+        return {};
+#else
+        return state.inter_node_comm.i_neighbor_all_to_all_v(
+            exec, segment, state.inter_node_send_sizes.data(),
+            state.inter_node_send_offsets.data(), type.get(), segment,
+            state.inter_node_recv_sizes.data(),
+            state.inter_node_recv_offsets.data(), type.get());
+#endif
+    }
     recv_buffer_.init(exec, recv_dim);
     send_buffer_.init(exec, send_dim);
 
@@ -291,22 +655,368 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
                                     : send_buffer_->get_const_values();
     auto recv_ptr = use_host_buffer ? host_recv_buffer_->get_values()
                                     : recv_buffer_->get_values();
+    auto comm_exec = use_host_buffer ? exec->get_master() : exec;
+    // the neighborhood communicator is only available after reading the matrix
+    auto use_neighbor_comm = neighbor_comm_.get() != MPI_COMM_NULL;
     exec->synchronize();
 #ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
-    comm.all_to_all_v(use_host_buffer ? exec->get_master() : exec, send_ptr,
-                      send_sizes_.data(), send_offsets_.data(), type.get(),
-                      recv_ptr, recv_sizes_.data(), recv_offsets_.data(),
-                      type.get());
+    if (use_neighbor_comm) {
+        neighbor_comm_.neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_send_sizes_.data(),
+            neighbor_send_offsets_.data(), type.get(), recv_ptr,
+            neighbor_recv_sizes_.data(), neighbor_recv_offsets_.data(),
+            type.get());
+    } else {
+        comm.all_to_all_v(comm_exec, send_ptr, send_sizes_.data(),
+                          send_offsets_.data(), type.get(), recv_ptr,
+                          recv_sizes_.data(), recv_offsets_.data(),
+                          type.get());
+    }
     return {};
 #else
-    return comm.i_all_to_all_v(
-        use_host_buffer ? exec->get_master() : exec, send_ptr,
-        send_sizes_.data(), send_offsets_.data(), type.get(), recv_ptr,
-        recv_sizes_.data(), recv_offsets_.data(), type.get());
+    if (use_neighbor_comm) {
+        return neighbor_comm_.i_neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_send_sizes_.data(),
+            neighbor_send_offsets_.data(), type.get(), recv_ptr,
+            neighbor_recv_sizes_.data(), neighbor_recv_offsets_.data(),
+            type.get());
+    }
+    return comm.i_all_to_all_v(comm_exec, send_ptr, send_sizes_.data(),
+                               send_offsets_.data(), type.get(), recv_ptr,
+                               recv_sizes_.data(), recv_offsets_.data(),
+                               type.get());
 #endif
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_boundary(
+    const local_vector_type* alpha, local_vector_type* local_x) const
+{
+    auto exec = this->get_executor();
+    if (shared_memory_halo_) {
+        auto& state = *shared_halo_;
+        // make the values written by the other processes on the node visible
+        state.window.sync();
+        state.node_comm.synchronize();
+        state.window.sync();
+        const auto num_cols = state.num_cols;
+        const auto num_rows =
+            static_cast<size_type>(state.segment_offsets.back());
+        auto halo = local_vector_type::create_const(
+            exec, dim<2>{num_rows, num_cols},
+            make_const_array_view(exec, num_rows * num_cols,
+                                  state.window_base),
+            num_cols);
+        boundary_buffer_.init(
+            exec, dim<2>{state.boundary_mtx->get_size()[0], num_cols});
+        state.boundary_mtx->apply(halo, boundary_buffer_.get());
+    } else {
+        boundary_buffer_.init(exec, dim<2>{boundary_mtx_->get_size()[0],
+                                           recv_buffer_->get_size()[1]});
+        boundary_mtx_->apply(recv_buffer_.get(), boundary_buffer_.get());
+    }
+    exec->run(matrix::make_add_scaled_rows(
+        make_temporary_clone(exec, alpha).get(), boundary_buffer_.get(),
+        boundary_rows_, make_temporary_clone(exec, local_x).get()));
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::set_shared_memory_halo(
+    bool enable)
+{
+    auto exec = this->get_executor();
+    if (enable && !supports_shared_memory(exec)) {
+        GKO_NOT_SUPPORTED(exec);
+    }
+    if (enable != shared_memory_halo_) {
+        shared_memory_halo_ = enable;
+        shared_halo_.reset();
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::prepare_shared_halo(
+    size_type num_cols) const
+{
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    if (!shared_halo_) {
+        const auto num_parts = comm.size();
+        const auto rank = comm.rank();
+        auto state = std::make_shared<shared_halo_state>(
+            comm.create_node_local_communicator());
+        const auto& node_comm = state->node_comm;
+        std::vector<comm_index_type> node_members(node_comm.size());
+        node_comm.all_gather(exec, &rank, 1, node_members.data(), 1);
+        std::vector<comm_index_type> node_ranks(num_parts, -1);
+        for (comm_index_type i = 0; i < node_comm.size(); ++i) {
+            node_ranks[node_members[i]] = i;
+        }
+        // the row of the values for this process in the send buffers of the
+        // other processes
+        std::vector<comm_index_type> remote_send_offsets(num_parts);
+        comm.all_to_all(exec, send_offsets_.data(), 1,
+                        remote_send_offsets.data(), 1);
+
+        // values from other nodes are received behind the send buffer
+        std::vector<comm_index_type> sources;
+        std::vector<comm_index_type> destinations;
+        auto segment_size = send_offsets_.back();
+        for (comm_index_type part = 0; part < num_parts; ++part) {
+            if (node_ranks[part] >= 0) {
+                continue;
+            }
+            if (recv_sizes_[part] > 0) {
+                sources.push_back(part);
+                state->inter_node_recv_offsets.push_back(segment_size);
+                state->inter_node_recv_sizes.push_back(recv_sizes_[part]);
+                segment_size += recv_sizes_[part];
+            }
+            if (send_sizes_[part] > 0) {
+                destinations.push_back(part);
+                state->inter_node_send_offsets.push_back(send_offsets_[part]);
+                state->inter_node_send_sizes.push_back(send_sizes_[part]);
+            }
+        }
+        state->inter_node_comm =
+            mpi::communicator(comm, sources, destinations);
+        state->segment_offsets.resize(node_comm.size() + 1);
+        node_comm.all_gather(exec, &segment_size, 1,
+                             state->segment_offsets.data() + 1, 1);
+        state->segment_offsets[0] = 0;
+        std::partial_sum(state->segment_offsets.begin(),
+                         state->segment_offsets.end(),
+                         state->segment_offsets.begin());
+
+        // redirect the columns of the boundary matrix to the window rows
+        std::vector<comm_index_type> window_rows(recv_offsets_.back());
+        auto recv_row = state->segment_offsets[node_ranks[rank]] +
+                        send_offsets_.back();
+        for (comm_index_type part = 0; part < num_parts; ++part) {
+            comm_index_type first_row{};
+            if (node_ranks[part] >= 0) {
+                first_row = state->segment_offsets[node_ranks[part]] +
+                            remote_send_offsets[part];
+            } else {
+                first_row = recv_row;
+                recv_row += recv_sizes_[part];
+            }
+            for (comm_index_type i = 0; i < recv_sizes_[part]; ++i) {
+                window_rows[recv_offsets_[part] + i] = first_row + i;
+            }
+        }
+        matrix_data<value_type, local_index_type> boundary_data;
+        as<WritableToMatrixData<value_type, local_index_type>>(boundary_mtx_)
+            ->write(boundary_data);
+        for (auto& entry : boundary_data.nonzeros) {
+            entry.column = window_rows[entry.column];
+        }
+        boundary_data.size[1] = state->segment_offsets.back();
+        boundary_data.ensure_row_major_order();
+        state->boundary_mtx = boundary_mtx_->clone();
+        as<ReadableFromMatrixData<value_type, local_index_type>>(
+            state->boundary_mtx)
+            ->read(boundary_data);
+        shared_halo_ = std::move(state);
+    }
+    auto& state = *shared_halo_;
+    if (state.window.get_window() == MPI_WIN_NULL ||
+        state.num_cols != num_cols) {
+        if (state.window.get_window() != MPI_WIN_NULL) {
+            state.window.unlock_all();
+        }
+        // the segments of all processes are allocated as one contiguous block,
+        // so that the boundary matrix can read all of them at once
+        const auto num_elems =
+            state.node_comm.rank() == 0
+                ? static_cast<int>(state.segment_offsets.back() * num_cols)
+                : 0;
+        state.window = mpi::window<value_type>(
+            exec, num_elems, state.node_comm,
+            mpi::window<value_type>::create_type::allocate_shared);
+        state.window.lock_all(MPI_MODE_NOCHECK);
+        state.window_base = state.window.get_shared_base(0);
+        state.num_cols = num_cols;
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+mpi::request
+Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate_transposed(
+    size_type num_cols) const
+{
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto send_size = send_offsets_.back();
+    auto recv_size = recv_offsets_.back();
+    auto send_dim = dim<2>{static_cast<size_type>(send_size), num_cols};
+    auto recv_dim = dim<2>{static_cast<size_type>(recv_size), num_cols};
+    send_buffer_.init(exec, send_dim);
+
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+    if (use_host_buffer) {
+        host_recv_buffer_.init(exec->get_master(), recv_dim);
+        host_send_buffer_.init(exec->get_master(), send_dim);
+        host_recv_buffer_->copy_from(recv_buffer_.get());
+    }
+
+    // the roles of the buffers are swapped compared to communicate
+    mpi::contiguous_type type(num_cols, mpi::type_impl<ValueType>::get_type());
+    auto send_ptr = use_host_buffer ? host_recv_buffer_->get_const_values()
+                                    : recv_buffer_->get_const_values();
+    auto recv_ptr = use_host_buffer ? host_send_buffer_->get_values()
+                                    : send_buffer_->get_values();
+    auto comm_exec = use_host_buffer ? exec->get_master() : exec;
+    auto use_neighbor_comm = reverse_neighbor_comm_.get() != MPI_COMM_NULL;
+    exec->synchronize();
+#ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
+    if (use_neighbor_comm) {
+        reverse_neighbor_comm_.neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_recv_sizes_.data(),
+            neighbor_recv_offsets_.data(), type.get(), recv_ptr,
+            neighbor_send_sizes_.data(), neighbor_send_offsets_.data(),
+            type.get());
+    } else {
+        comm.all_to_all_v(comm_exec, send_ptr, recv_sizes_.data(),
+                          recv_offsets_.data(), type.get(), recv_ptr,
+                          send_sizes_.data(), send_offsets_.data(),
+                          type.get());
+    }
+    return {};
+#else
+    if (use_neighbor_comm) {
+        return reverse_neighbor_comm_.i_neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_recv_sizes_.data(),
+            neighbor_recv_offsets_.data(), type.get(), recv_ptr,
+            neighbor_send_sizes_.data(), neighbor_send_offsets_.data(),
+            type.get());
+    }
+    return comm.i_all_to_all_v(comm_exec, send_ptr, recv_sizes_.data(),
+                               recv_offsets_.data(), type.get(), recv_ptr,
+                               send_sizes_.data(), send_offsets_.data(),
+                               type.get());
+#endif
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::prepare_transposed()
+    const
+{
+    if (!transposed_local_mtx_) {
+        transposed_local_mtx_ = as<Transposable>(local_mtx_)->transpose();
+    }
+    if (!transposed_non_local_mtx_) {
+        transposed_non_local_mtx_ =
+            as<Transposable>(non_local_mtx_)->transpose();
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_transposed(
+    ptr_param<const LinOp> b, ptr_param<LinOp> x) const
+{
+    GKO_ASSERT_EQUAL_ROWS(this, b.get());
+    GKO_ASSERT_REVERSE_CONFORMANT(x.get(), this);
+    GKO_ASSERT_EQUAL_COLS(b.get(), x.get());
+    auto exec = this->get_executor();
+    this->prepare_transposed();
+    distributed::precision_dispatch_real_complex<ValueType>(
+        [this](const auto dense_b, auto dense_x) {
+            auto x_exec = dense_x->get_executor();
+            auto local_x = gko::matrix::Dense<ValueType>::create(
+                x_exec, dense_x->get_local_vector()->get_size(),
+                gko::make_array_view(
+                    x_exec,
+                    dense_x->get_local_vector()->get_num_stored_elements(),
+                    dense_x->get_local_values()),
+                dense_x->get_local_vector()->get_stride());
+
+            auto exec = this->get_executor();
+            auto comm = this->get_communicator();
+            const auto num_cols = dense_b->get_size()[1];
+            // the non-local products have to be sent first, so that the
+            // communication overlaps with the local product
+            recv_buffer_.init(
+                exec,
+                dim<2>{static_cast<size_type>(recv_offsets_.back()), num_cols});
+            transposed_non_local_mtx_->apply(dense_b->get_local_vector(),
+                                             recv_buffer_.get());
+            auto req = this->communicate_transposed(num_cols);
+            transposed_local_mtx_->apply(dense_b->get_local_vector(), local_x);
+            req.wait();
+
+            auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+            if (use_host_buffer) {
+                send_buffer_->copy_from(host_send_buffer_.get());
+            }
+            scatter_mtx_->apply(one_scalar_.get(), send_buffer_.get(),
+                                one_scalar_.get(), local_x);
+        },
+        make_temporary_clone(exec, b.get()).get(),
+        make_temporary_clone(exec, x.get()).get());
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_transposed(
+    ptr_param<const LinOp> alpha, ptr_param<const LinOp> b,
+    ptr_param<const LinOp> beta, ptr_param<LinOp> x) const
+{
+    GKO_ASSERT_EQUAL_ROWS(this, b.get());
+    GKO_ASSERT_REVERSE_CONFORMANT(x.get(), this);
+    GKO_ASSERT_EQUAL_COLS(b.get(), x.get());
+    GKO_ASSERT_EQUAL_DIMENSIONS(alpha.get(), dim<2>(1, 1));
+    GKO_ASSERT_EQUAL_DIMENSIONS(beta.get(), dim<2>(1, 1));
+    auto exec = this->get_executor();
+    this->prepare_transposed();
+    distributed::precision_dispatch_real_complex<ValueType>(
+        [this](const auto local_alpha, const auto dense_b,
+               const auto local_beta, auto dense_x) {
+            const auto x_exec = dense_x->get_executor();
+            auto local_x = gko::matrix::Dense<ValueType>::create(
+                x_exec, dense_x->get_local_vector()->get_size(),
+                gko::make_array_view(
+                    x_exec,
+                    dense_x->get_local_vector()->get_num_stored_elements(),
+                    dense_x->get_local_values()),
+                dense_x->get_local_vector()->get_stride());
+
+            auto exec = this->get_executor();
+            auto comm = this->get_communicator();
+            const auto num_cols = dense_b->get_size()[1];
+            // the non-local products have to be sent first, so that the
+            // communication overlaps with the local product
+            recv_buffer_.init(
+                exec,
+                dim<2>{static_cast<size_type>(recv_offsets_.back()), num_cols});
+            transposed_non_local_mtx_->apply(dense_b->get_local_vector(),
+                                             recv_buffer_.get());
+            auto req = this->communicate_transposed(num_cols);
+            transposed_local_mtx_->apply(local_alpha,
+                                         dense_b->get_local_vector(),
+                                         local_beta, local_x);
+            req.wait();
+
+            auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+            if (use_host_buffer) {
+                send_buffer_->copy_from(host_send_buffer_.get());
+            }
+            scatter_mtx_->apply(local_alpha, send_buffer_.get(),
+                                one_scalar_.get(), local_x);
+        },
+        make_temporary_clone(exec, alpha.get()).get(),
+        make_temporary_clone(exec, b.get()).get(),
+        make_temporary_clone(exec, beta.get()).get(),
+        make_temporary_clone(exec, x.get()).get());
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
     const LinOp* b, LinOp* x) const
@@ -332,8 +1042,7 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
             if (use_host_buffer) {
                 recv_buffer_->copy_from(host_recv_buffer_.get());
             }
-            non_local_mtx_->apply(one_scalar_.get(), recv_buffer_.get(),
-                                  one_scalar_.get(), local_x);
+            this->apply_boundary(one_scalar_.get(), local_x.get());
         },
         b, x);
 }
@@ -366,8 +1075,7 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
             if (use_host_buffer) {
                 recv_buffer_->copy_from(host_recv_buffer_.get());
             }
-            non_local_mtx_->apply(local_alpha, recv_buffer_.get(),
-                                  one_scalar_.get(), local_x);
+            this->apply_boundary(local_alpha, local_x.get());
         },
         alpha, b, beta, x);
 }
@@ -405,12 +1113,28 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(
         this->set_size(other.get_size());
         local_mtx_->copy_from(other.local_mtx_);
         non_local_mtx_->copy_from(other.non_local_mtx_);
+        boundary_rows_ = other.boundary_rows_;
+        boundary_mtx_->copy_from(other.boundary_mtx_);
+        scatter_mtx_->copy_from(other.scatter_mtx_);
+        transposed_local_mtx_.reset();
+        transposed_non_local_mtx_.reset();
+        shared_memory_halo_ = other.shared_memory_halo_ &&
+                              supports_shared_memory(this->get_executor());
+        shared_halo_.reset();
         gather_idxs_ = other.gather_idxs_;
         send_offsets_ = other.send_offsets_;
         recv_offsets_ = other.recv_offsets_;
         send_sizes_ = other.send_sizes_;
         recv_sizes_ = other.recv_sizes_;
+        neighbor_comm_ = other.neighbor_comm_;
+        reverse_neighbor_comm_ = other.reverse_neighbor_comm_;
+        neighbor_send_offsets_ = other.neighbor_send_offsets_;
+        neighbor_send_sizes_ = other.neighbor_send_sizes_;
+        neighbor_recv_offsets_ = other.neighbor_recv_offsets_;
+        neighbor_recv_sizes_ = other.neighbor_recv_sizes_;
         non_local_to_global_ = other.non_local_to_global_;
+        row_partition_ = other.row_partition_;
+        col_partition_ = other.col_partition_;
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -429,12 +1153,29 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(Matrix&& other)
         other.set_size({});
         local_mtx_->move_from(other.local_mtx_);
         non_local_mtx_->move_from(other.non_local_mtx_);
+        boundary_rows_ = std::move(other.boundary_rows_);
+        boundary_mtx_->move_from(other.boundary_mtx_);
+        scatter_mtx_->move_from(other.scatter_mtx_);
+        transposed_local_mtx_ = std::move(other.transposed_local_mtx_);
+        transposed_non_local_mtx_ = std::move(other.transposed_non_local_mtx_);
+        shared_memory_halo_ = other.shared_memory_halo_ &&
+                              supports_shared_memory(this->get_executor());
+        shared_halo_.reset();
+        other.shared_halo_.reset();
         gather_idxs_ = std::move(other.gather_idxs_);
         send_offsets_ = std::move(other.send_offsets_);
         recv_offsets_ = std::move(other.recv_offsets_);
         send_sizes_ = std::move(other.send_sizes_);
         recv_sizes_ = std::move(other.recv_sizes_);
+        neighbor_comm_ = other.neighbor_comm_;
+        reverse_neighbor_comm_ = other.reverse_neighbor_comm_;
+        neighbor_send_offsets_ = std::move(other.neighbor_send_offsets_);
+        neighbor_send_sizes_ = std::move(other.neighbor_send_sizes_);
+        neighbor_recv_offsets_ = std::move(other.neighbor_recv_offsets_);
+        neighbor_recv_sizes_ = std::move(other.neighbor_recv_sizes_);
         non_local_to_global_ = std::move(other.non_local_to_global_);
+        row_partition_ = std::move(other.row_partition_);
+        col_partition_ = std::move(other.col_partition_);
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
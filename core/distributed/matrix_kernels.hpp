@@ -39,6 +39,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 
 
 #include "core/base/kernel_declaration.hpp"
@@ -67,12 +68,22 @@ namespace kernels {
         array<GlobalIndexType>& non_local_to_global)
 
 
+#define GKO_DECLARE_DISTRIBUTED_MATRIX_ADD_SCALED_ROWS(ValueType, IndexType) \
+    void add_scaled_rows(std::shared_ptr<const DefaultExecutor> exec,        \
+                         const matrix::Dense<ValueType>* alpha,              \
+                         const matrix::Dense<ValueType>* rows,               \
+                         const array<IndexType>& row_idxs,                   \
+                         matrix::Dense<ValueType>* x)
+
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                    \
     using comm_index_type = experimental::distributed::comm_index_type; \
     template <typename ValueType, typename LocalIndexType,              \
               typename GlobalIndexType>                                 \
     GKO_DECLARE_BUILD_LOCAL_NONLOCAL(ValueType, LocalIndexType,         \
-                                     GlobalIndexType)
+                                     GlobalIndexType);                  \
+    template <typename ValueType, typename IndexType>                   \
+    GKO_DECLARE_DISTRIBUTED_MATRIX_ADD_SCALED_ROWS(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(distributed_matrix,
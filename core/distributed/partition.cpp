@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/distributed/partition_kernels.hpp"
+#include "core/reorder/adjacency_graph.hpp"
 
 
 namespace gko {
@@ -50,6 +51,7 @@ GKO_REGISTER_OPERATION(build_ranges_from_global_size,
 GKO_REGISTER_OPERATION(build_starting_indices,
                        partition::build_starting_indices);
 GKO_REGISTER_OPERATION(has_ordered_parts, partition::has_ordered_parts);
+GKO_REGISTER_OPERATION(compute_graph_mapping, partition::compute_graph_mapping);
 
 
 }  // namespace partition
@@ -142,6 +144,36 @@ bool Partition<LocalIndexType, GlobalIndexType>::has_ordered_parts()
 GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_PARTITION);
 
 
+template <typename ValueType, typename IndexType>
+array<comm_index_type> build_mapping_from_graph(
+    std::shared_ptr<const Executor> exec, std::shared_ptr<const LinOp> matrix,
+    comm_index_type num_parts, double imbalance)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(matrix);
+    GKO_ASSERT(num_parts > 0);
+    const auto host_exec = exec->get_master();
+    const auto num_rows = matrix->get_size()[0];
+    const auto adjacency_mtx =
+        reorder::detail::compute_adjacency_graph<ValueType, IndexType>(
+            host_exec, std::move(matrix), false);
+    array<comm_index_type> mapping(host_exec, num_rows);
+    host_exec->run(partition::make_compute_graph_mapping(
+        static_cast<IndexType>(num_rows), adjacency_mtx->get_const_row_ptrs(),
+        adjacency_mtx->get_const_col_idxs(), num_parts, imbalance,
+        mapping.get_data()));
+    mapping.set_executor(exec);
+    return mapping;
+}
+
+#define GKO_DECLARE_BUILD_MAPPING_FROM_GRAPH(ValueType, IndexType)         \
+    array<comm_index_type> build_mapping_from_graph<ValueType, IndexType>( \
+        std::shared_ptr<const Executor> exec,                              \
+        std::shared_ptr<const LinOp> matrix, comm_index_type num_parts,    \
+        double imbalance)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_BUILD_MAPPING_FROM_GRAPH);
+
+
 }  // namespace distributed
 }  // namespace experimental
 }  // namespace gko
@@ -67,6 +67,13 @@ namespace kernels {
         comm_index_type num_parts, GlobalIndexType global_size, \
         array<GlobalIndexType>& ranges)
 
+#define GKO_PARTITION_COMPUTE_GRAPH_MAPPING(IndexType)                       \
+    void compute_graph_mapping(                                              \
+        std::shared_ptr<const DefaultExecutor> exec, IndexType num_vertices, \
+        const IndexType* row_ptrs, const IndexType* col_idxs,                \
+        comm_index_type num_parts, double imbalance,                         \
+        comm_index_type* mapping)
+
 #define GKO_DECLARE_PARTITION_BUILD_STARTING_INDICES(LocalIndexType,          \
                                                      GlobalIndexType)         \
     void build_starting_indices(std::shared_ptr<const DefaultExecutor> exec,  \
@@ -92,6 +99,8 @@ namespace kernels {
     GKO_PARTITION_BUILD_FROM_MAPPING(GlobalIndexType);                  \
     template <typename GlobalIndexType>                                 \
     GKO_PARTITION_BUILD_FROM_GLOBAL_SIZE(GlobalIndexType);              \
+    template <typename IndexType>                                       \
+    GKO_PARTITION_COMPUTE_GRAPH_MAPPING(IndexType);                     \
     template <typename LocalIndexType, typename GlobalIndexType>        \
     GKO_DECLARE_PARTITION_BUILD_STARTING_INDICES(LocalIndexType,        \
                                                  GlobalIndexType);      \
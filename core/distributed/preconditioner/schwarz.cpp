@@ -33,16 +33,23 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/distributed/preconditioner/schwarz.hpp>
 
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/temporary_conversion.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
@@ -55,6 +62,77 @@ namespace gko {
 namespace experimental {
 namespace distributed {
 namespace preconditioner {
+namespace {
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+size_type find_range(
+    const Partition<LocalIndexType, GlobalIndexType>* partition,
+    GlobalIndexType idx)
+{
+    const auto range_bounds = partition->get_range_bounds();
+    return std::upper_bound(range_bounds + 1,
+                            range_bounds + partition->get_num_ranges() + 1,
+                            idx) -
+           (range_bounds + 1);
+}
+
+
+/**
+ * Computes the explicit inverse of a small dense host matrix by Gauss-Jordan
+ * elimination with partial pivoting.
+ */
+template <typename ValueType>
+std::unique_ptr<matrix::Dense<ValueType>> invert_dense(
+    const matrix::Dense<ValueType>* mtx)
+{
+    const auto size = mtx->get_size()[0];
+    auto work = gko::clone(mtx);
+    auto inverse =
+        matrix::Dense<ValueType>::create(mtx->get_executor(), mtx->get_size());
+    for (size_type row = 0; row < size; ++row) {
+        for (size_type col = 0; col < size; ++col) {
+            inverse->at(row, col) =
+                row == col ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+    for (size_type k = 0; k < size; ++k) {
+        auto pivot = k;
+        for (auto row = k + 1; row < size; ++row) {
+            if (abs(work->at(row, k)) > abs(work->at(pivot, k))) {
+                pivot = row;
+            }
+        }
+        if (work->at(pivot, k) == zero<ValueType>()) {
+            GKO_UNSUPPORTED_MATRIX_PROPERTY("The coarse matrix is singular");
+        }
+        if (pivot != k) {
+            for (size_type col = 0; col < size; ++col) {
+                std::swap(work->at(k, col), work->at(pivot, col));
+                std::swap(inverse->at(k, col), inverse->at(pivot, col));
+            }
+        }
+        const auto scale = one<ValueType>() / work->at(k, k);
+        for (size_type col = 0; col < size; ++col) {
+            work->at(k, col) *= scale;
+            inverse->at(k, col) *= scale;
+        }
+        for (size_type row = 0; row < size; ++row) {
+            const auto factor = work->at(row, k);
+            if (row == k || factor == zero<ValueType>()) {
+                continue;
+            }
+            for (size_type col = 0; col < size; ++col) {
+                work->at(row, col) -= factor * work->at(k, col);
+                inverse->at(row, col) -= factor * inverse->at(k, col);
+            }
+        }
+    }
+    return inverse;
+}
+
+
+}  // namespace
 
 
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
@@ -74,12 +152,95 @@ template <typename VectorType>
 void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_dense_impl(
     const VectorType* dense_b, VectorType* dense_x) const
 {
-    using Vector = matrix::Dense<ValueType>;
-    auto exec = this->get_executor();
+    auto local_b = gko::detail::get_local(dense_b);
+    auto local_x = gko::detail::get_local(dense_x);
     if (this->local_solver_ != nullptr) {
-        this->local_solver_->apply(gko::detail::get_local(dense_b),
-                                   gko::detail::get_local(dense_x));
+        if (parameters_.overlap > 0) {
+            this->apply_overlap(local_b, local_x);
+        } else {
+            this->local_solver_->apply(local_b, local_x);
+        }
+    }
+    if (this->coarse_inverse_ != nullptr) {
+        this->apply_coarse_correction(local_b, local_x);
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_overlap(
+    const matrix::Dense<ValueType>* local_b,
+    matrix::Dense<ValueType>* local_x) const
+{
+    using Dense = matrix::Dense<ValueType>;
+    auto exec = this->get_executor();
+    const auto num_local_rows = local_b->get_size()[0];
+    const auto num_cols = local_b->get_size()[1];
+    const auto num_send = static_cast<size_type>(overlap_send_offsets_.back());
+    const auto num_recv = static_cast<size_type>(overlap_recv_offsets_.back());
+    const auto local_rows = span{0, num_local_rows};
+    const auto overlap_rows = span{num_local_rows, num_local_rows + num_recv};
+    const auto cols = span{0, num_cols};
+
+    // gather the overlapping part of the right-hand side from its owners
+    auto send_buffer = Dense::create(exec, dim<2>{num_send, num_cols});
+    auto recv_buffer = Dense::create(exec, dim<2>{num_recv, num_cols});
+    local_b->row_gather(&overlap_gather_idxs_, send_buffer);
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm_);
+    if (use_host_buffer) {
+        send_buffer = gko::clone(exec->get_master(), send_buffer);
+        recv_buffer =
+            Dense::create(exec->get_master(), recv_buffer->get_size());
+    }
+    mpi::contiguous_type type(num_cols, mpi::type_impl<ValueType>::get_type());
+    exec->synchronize();
+    comm_.all_to_all_v(use_host_buffer ? exec->get_master() : exec,
+                       send_buffer->get_const_values(),
+                       overlap_send_sizes_.data(), overlap_send_offsets_.data(),
+                       type.get(), recv_buffer->get_values(),
+                       overlap_recv_sizes_.data(), overlap_recv_offsets_.data(),
+                       type.get());
+
+    auto ext_b =
+        Dense::create(exec, dim<2>{num_local_rows + num_recv, num_cols});
+    auto ext_x = Dense::create(exec, ext_b->get_size());
+    ext_b->create_submatrix(local_rows, cols)->copy_from(local_b);
+    ext_b->create_submatrix(overlap_rows, cols)->copy_from(recv_buffer);
+    ext_x->create_submatrix(local_rows, cols)->copy_from(local_x);
+    ext_x->create_submatrix(overlap_rows, cols)->fill(zero<ValueType>());
+    this->local_solver_->apply(ext_b, ext_x);
+    // restricted additive Schwarz: only keep the owned part of the solution
+    auto ext_x_local = ext_x->create_submatrix(local_rows, cols);
+    local_x->copy_from(ext_x_local);
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::
+    apply_coarse_correction(const matrix::Dense<ValueType>* local_b,
+                            matrix::Dense<ValueType>* local_x) const
+{
+    using Dense = matrix::Dense<ValueType>;
+    auto exec = this->get_executor();
+    const auto coarse_size = coarse_inverse_->get_size()[0];
+    const auto num_cols = local_b->get_size()[1];
+    auto coarse_b = Dense::create(exec, dim<2>{coarse_size, num_cols});
+    auto coarse_x = Dense::create(exec, dim<2>{coarse_size, num_cols});
+    coarse_restriction_->apply(local_b, coarse_b);
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm_);
+    if (use_host_buffer) {
+        auto host_coarse_b = gko::clone(exec->get_master(), coarse_b);
+        comm_.all_reduce(exec->get_master(), host_coarse_b->get_values(),
+                         static_cast<int>(coarse_size * num_cols), MPI_SUM);
+        coarse_b->copy_from(host_coarse_b);
+    } else {
+        exec->synchronize();
+        comm_.all_reduce(exec, coarse_b->get_values(),
+                         static_cast<int>(coarse_size * num_cols), MPI_SUM);
     }
+    coarse_inverse_->apply(coarse_b, coarse_x);
+    auto one_op = initialize<Dense>({one<ValueType>()}, exec);
+    coarse_prolongation_->apply(one_op, coarse_x, one_op, local_x);
 }
 
 
@@ -102,15 +263,372 @@ template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate(
     std::shared_ptr<const LinOp> system_matrix)
 {
+    auto dist_mtx =
+        as<experimental::distributed::Matrix<ValueType, LocalIndexType,
+                                             GlobalIndexType>>(system_matrix);
+    comm_ = dist_mtx->get_communicator();
     if (parameters_.local_solver_factory) {
-        this->local_solver_ = parameters_.local_solver_factory->generate(
-            as<experimental::distributed::Matrix<ValueType, LocalIndexType,
-                                                 GlobalIndexType>>(
-                system_matrix)
-                ->get_local_matrix());
+        if (parameters_.overlap > 0) {
+            this->local_solver_ = parameters_.local_solver_factory->generate(
+                this->generate_overlap(dist_mtx.get()));
+        } else {
+            this->local_solver_ = parameters_.local_solver_factory->generate(
+                dist_mtx->get_local_matrix());
+        }
     } else {
         GKO_NOT_IMPLEMENTED;
     }
+    if (parameters_.coarse_space || parameters_.coarse_correction) {
+        this->generate_coarse(dist_mtx.get());
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::shared_ptr<const LinOp>
+Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate_overlap(
+    const Matrix<ValueType, LocalIndexType, GlobalIndexType>* system_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, LocalIndexType>;
+    auto exec = this->get_executor();
+    auto host = exec->get_master();
+    const auto rank = comm_.rank();
+    const auto num_parts = comm_.size();
+    if (system_matrix->get_row_partition() == nullptr) {
+        GKO_NOT_SUPPORTED(system_matrix);
+    }
+    auto partition =
+        make_temporary_clone(host, system_matrix->get_row_partition().get());
+    const auto range_bounds = partition->get_range_bounds();
+    const auto range_starts = partition->get_range_starting_indices();
+    const auto part_ids = partition->get_part_ids();
+    const auto num_local_rows =
+        static_cast<size_type>(partition->get_part_size(rank));
+    auto local_mtx = csr_type::create(host);
+    auto non_local_mtx = csr_type::create(host);
+    as<ConvertibleTo<csr_type>>(system_matrix->get_local_matrix())
+        ->convert_to(local_mtx);
+    as<ConvertibleTo<csr_type>>(system_matrix->get_non_local_matrix())
+        ->convert_to(non_local_mtx);
+    GKO_ASSERT_IS_SQUARE_MATRIX(local_mtx);
+    const auto local_row_ptrs = local_mtx->get_const_row_ptrs();
+    const auto local_col_idxs = local_mtx->get_const_col_idxs();
+    const auto local_vals = local_mtx->get_const_values();
+    const auto non_local_row_ptrs = non_local_mtx->get_const_row_ptrs();
+    const auto non_local_col_idxs = non_local_mtx->get_const_col_idxs();
+    const auto non_local_vals = non_local_mtx->get_const_values();
+    const array<GlobalIndexType> non_local_to_global{
+        host, system_matrix->get_non_local_to_global()};
+    const auto non_local_to_global_data = non_local_to_global.get_const_data();
+
+    std::vector<GlobalIndexType> local_to_global(num_local_rows);
+    for (size_type range = 0; range < partition->get_num_ranges(); ++range) {
+        if (part_ids[range] == rank) {
+            for (auto idx = range_bounds[range]; idx < range_bounds[range + 1];
+                 ++idx) {
+                local_to_global[range_starts[range] + idx -
+                                range_bounds[range]] = idx;
+            }
+        }
+    }
+    auto owner = [&](GlobalIndexType idx) {
+        return part_ids[find_range(partition.get(), idx)];
+    };
+    auto global_to_local = [&](GlobalIndexType idx) {
+        const auto range = find_range(partition.get(), idx);
+        return static_cast<LocalIndexType>(range_starts[range] + idx -
+                                           range_bounds[range]);
+    };
+    auto by_owner = [&](GlobalIndexType a, GlobalIndexType b) {
+        return std::make_pair(owner(a), a) < std::make_pair(owner(b), b);
+    };
+    auto append_owned_row = [&](LocalIndexType row,
+                                std::vector<GlobalIndexType>& cols,
+                                std::vector<ValueType>& vals) {
+        for (auto nz = local_row_ptrs[row]; nz < local_row_ptrs[row + 1];
+             ++nz) {
+            cols.push_back(local_to_global[local_col_idxs[nz]]);
+            vals.push_back(local_vals[nz]);
+        }
+        for (auto nz = non_local_row_ptrs[row];
+             nz < non_local_row_ptrs[row + 1]; ++nz) {
+            cols.push_back(non_local_to_global_data[non_local_col_idxs[nz]]);
+            vals.push_back(non_local_vals[nz]);
+        }
+    };
+
+    // the overlapping rows in the order they were added, in global indexing
+    std::vector<GlobalIndexType> overlap_idxs;
+    std::unordered_map<GlobalIndexType, size_type> overlap_map;
+    std::vector<size_type> overlap_row_ptrs{0};
+    std::vector<GlobalIndexType> overlap_cols;
+    std::vector<ValueType> overlap_vals;
+
+    // fetches the rows of the given indices, which are sorted by owner
+    auto fetch_rows = [&](const std::vector<GlobalIndexType>& idxs) {
+        std::vector<comm_index_type> request_sizes(num_parts);
+        std::vector<comm_index_type> request_offsets(num_parts + 1);
+        std::vector<comm_index_type> reply_sizes(num_parts);
+        std::vector<comm_index_type> reply_offsets(num_parts + 1);
+        for (auto idx : idxs) {
+            request_sizes[owner(idx)]++;
+        }
+        std::partial_sum(request_sizes.begin(), request_sizes.end(),
+                         request_offsets.begin() + 1);
+        comm_.all_to_all(host, request_sizes.data(), 1, reply_sizes.data(),
+                         1);
+        std::partial_sum(reply_sizes.begin(), reply_sizes.end(),
+                         reply_offsets.begin() + 1);
+        std::vector<GlobalIndexType> requested_idxs(reply_offsets.back());
+        comm_.all_to_all_v(host, idxs.data(), request_sizes.data(),
+                           request_offsets.data(), requested_idxs.data(),
+                           reply_sizes.data(), reply_offsets.data());
+
+        // answer with the requested rows of the owned part of the matrix
+        std::vector<comm_index_type> reply_row_nnz(requested_idxs.size());
+        std::vector<comm_index_type> reply_nnz_sizes(num_parts);
+        std::vector<comm_index_type> reply_nnz_offsets(num_parts + 1);
+        std::vector<GlobalIndexType> reply_cols;
+        std::vector<ValueType> reply_vals;
+        for (comm_index_type part = 0; part < num_parts; ++part) {
+            for (auto i = reply_offsets[part]; i < reply_offsets[part + 1];
+                 ++i) {
+                const auto begin = reply_cols.size();
+                append_owned_row(global_to_local(requested_idxs[i]),
+                                 reply_cols, reply_vals);
+                reply_row_nnz[i] =
+                    static_cast<comm_index_type>(reply_cols.size() - begin);
+                reply_nnz_sizes[part] += reply_row_nnz[i];
+            }
+        }
+        std::partial_sum(reply_nnz_sizes.begin(), reply_nnz_sizes.end(),
+                         reply_nnz_offsets.begin() + 1);
+        std::vector<comm_index_type> row_nnz(idxs.size());
+        comm_.all_to_all_v(host, reply_row_nnz.data(), reply_sizes.data(),
+                           reply_offsets.data(), row_nnz.data(),
+                           request_sizes.data(), request_offsets.data());
+        std::vector<comm_index_type> nnz_sizes(num_parts);
+        std::vector<comm_index_type> nnz_offsets(num_parts + 1);
+        for (comm_index_type part = 0; part < num_parts; ++part) {
+            for (auto i = request_offsets[part]; i < request_offsets[part + 1];
+                 ++i) {
+                nnz_sizes[part] += row_nnz[i];
+            }
+        }
+        std::partial_sum(nnz_sizes.begin(), nnz_sizes.end(),
+                         nnz_offsets.begin() + 1);
+        const auto old_nnz = overlap_cols.size();
+        overlap_cols.resize(old_nnz + nnz_offsets.back());
+        overlap_vals.resize(old_nnz + nnz_offsets.back());
+        comm_.all_to_all_v(host, reply_cols.data(), reply_nnz_sizes.data(),
+                           reply_nnz_offsets.data(),
+                           overlap_cols.data() + old_nnz, nnz_sizes.data(),
+                           nnz_offsets.data());
+        comm_.all_to_all_v(host, reply_vals.data(), reply_nnz_sizes.data(),
+                           reply_nnz_offsets.data(),
+                           overlap_vals.data() + old_nnz, nnz_sizes.data(),
+                           nnz_offsets.data());
+        for (auto nnz : row_nnz) {
+            overlap_row_ptrs.push_back(overlap_row_ptrs.back() + nnz);
+        }
+    };
+
+    // the first layer consists of the non-local columns, each further layer
+    // of the neighbors of the previous layer outside of the extended subdomain
+    std::vector<GlobalIndexType> layer_idxs(
+        non_local_to_global_data,
+        non_local_to_global_data + non_local_to_global.get_num_elems());
+    size_type layer_begin = 0;
+    for (size_type layer = 0; layer < parameters_.overlap; ++layer) {
+        if (layer > 0) {
+            layer_idxs.clear();
+            for (auto nz = overlap_row_ptrs[layer_begin];
+                 nz < overlap_row_ptrs.back(); ++nz) {
+                const auto idx = overlap_cols[nz];
+                if (owner(idx) != rank &&
+                    overlap_map.find(idx) == overlap_map.end()) {
+                    layer_idxs.push_back(idx);
+                }
+            }
+        }
+        std::sort(layer_idxs.begin(), layer_idxs.end(), by_owner);
+        layer_idxs.erase(std::unique(layer_idxs.begin(), layer_idxs.end()),
+                         layer_idxs.end());
+        layer_begin = overlap_idxs.size();
+        for (auto idx : layer_idxs) {
+            overlap_map[idx] = overlap_idxs.size();
+            overlap_idxs.push_back(idx);
+        }
+        fetch_rows(layer_idxs);
+    }
+
+    // number the overlapping rows by owner, so the overlapping part of the
+    // right-hand side can be received contiguously
+    std::vector<GlobalIndexType> recv_idxs(overlap_idxs);
+    std::sort(recv_idxs.begin(), recv_idxs.end(), by_owner);
+    std::vector<LocalIndexType> overlap_to_ext(overlap_idxs.size());
+    overlap_recv_sizes_.assign(num_parts, 0);
+    overlap_recv_offsets_.assign(num_parts + 1, 0);
+    overlap_send_sizes_.assign(num_parts, 0);
+    overlap_send_offsets_.assign(num_parts + 1, 0);
+    for (size_type i = 0; i < recv_idxs.size(); ++i) {
+        overlap_to_ext[overlap_map[recv_idxs[i]]] =
+            static_cast<LocalIndexType>(num_local_rows + i);
+        overlap_recv_sizes_[owner(recv_idxs[i])]++;
+    }
+    std::partial_sum(overlap_recv_sizes_.begin(), overlap_recv_sizes_.end(),
+                     overlap_recv_offsets_.begin() + 1);
+    comm_.all_to_all(host, overlap_recv_sizes_.data(), 1,
+                     overlap_send_sizes_.data(), 1);
+    std::partial_sum(overlap_send_sizes_.begin(), overlap_send_sizes_.end(),
+                     overlap_send_offsets_.begin() + 1);
+    std::vector<GlobalIndexType> send_idxs(overlap_send_offsets_.back());
+    comm_.all_to_all_v(host, recv_idxs.data(), overlap_recv_sizes_.data(),
+                       overlap_recv_offsets_.data(), send_idxs.data(),
+                       overlap_send_sizes_.data(),
+                       overlap_send_offsets_.data());
+    array<LocalIndexType> gather_idxs{host, send_idxs.size()};
+    for (size_type i = 0; i < send_idxs.size(); ++i) {
+        gather_idxs.get_data()[i] = global_to_local(send_idxs[i]);
+    }
+    overlap_gather_idxs_ = gather_idxs;
+
+    // assemble the extended matrix, dropping the couplings of the outermost
+    // layer to unknowns outside of the extended subdomain
+    const auto ext_size = num_local_rows + overlap_idxs.size();
+    matrix_data<ValueType, LocalIndexType> ext_data{dim<2>{ext_size, ext_size}};
+    for (size_type row = 0; row < num_local_rows; ++row) {
+        for (auto nz = local_row_ptrs[row]; nz < local_row_ptrs[row + 1];
+             ++nz) {
+            ext_data.nonzeros.emplace_back(row, local_col_idxs[nz],
+                                           local_vals[nz]);
+        }
+        for (auto nz = non_local_row_ptrs[row];
+             nz < non_local_row_ptrs[row + 1]; ++nz) {
+            const auto idx = non_local_to_global_data[non_local_col_idxs[nz]];
+            ext_data.nonzeros.emplace_back(
+                row, overlap_to_ext[overlap_map[idx]], non_local_vals[nz]);
+        }
+    }
+    for (size_type i = 0; i < overlap_idxs.size(); ++i) {
+        for (auto nz = overlap_row_ptrs[i]; nz < overlap_row_ptrs[i + 1];
+             ++nz) {
+            const auto idx = overlap_cols[nz];
+            if (owner(idx) == rank) {
+                ext_data.nonzeros.emplace_back(
+                    overlap_to_ext[i], global_to_local(idx), overlap_vals[nz]);
+            } else {
+                const auto it = overlap_map.find(idx);
+                if (it != overlap_map.end()) {
+                    ext_data.nonzeros.emplace_back(overlap_to_ext[i],
+                                                   overlap_to_ext[it->second],
+                                                   overlap_vals[nz]);
+                }
+            }
+        }
+    }
+    ext_data.ensure_row_major_order();
+    auto ext_mtx = share(csr_type::create(exec));
+    ext_mtx->read(ext_data);
+    return ext_mtx;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate_coarse(
+    const Matrix<ValueType, LocalIndexType, GlobalIndexType>* system_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, LocalIndexType>;
+    using Dense = matrix::Dense<ValueType>;
+    auto exec = this->get_executor();
+    auto host = exec->get_master();
+    const auto rank = comm_.rank();
+    const auto num_parts = comm_.size();
+    const auto num_local_rows =
+        system_matrix->get_local_matrix()->get_size()[0];
+    std::unique_ptr<Dense> coarse_mtx;
+    if (parameters_.coarse_space) {
+        // Galerkin product Z^H A Z, the local contributions are summed up
+        const auto coarse_space = parameters_.coarse_space;
+        const auto local_space = coarse_space->get_local_vector();
+        GKO_ASSERT_EQUAL_ROWS(local_space, system_matrix->get_local_matrix());
+        const auto coarse_size = coarse_space->get_size()[1];
+        auto product =
+            Vector<ValueType>::create(exec, comm_, coarse_space->get_size(),
+                                      local_space->get_size());
+        system_matrix->apply(coarse_space, product);
+        auto restriction = share(as<Dense>(local_space->conj_transpose()));
+        auto local_coarse_mtx =
+            Dense::create(exec, dim<2>{coarse_size, coarse_size});
+        restriction->apply(product->get_local_vector(), local_coarse_mtx);
+        coarse_mtx = gko::clone(host, local_coarse_mtx);
+        coarse_restriction_ = restriction;
+        coarse_prolongation_ = gko::clone(exec, local_space);
+    } else {
+        // one aggregate per rank: the own row of the coarse matrix contains
+        // the sum of the couplings to the aggregate of each rank
+        if (system_matrix->get_col_partition() == nullptr) {
+            GKO_NOT_SUPPORTED(system_matrix);
+        }
+        auto col_partition = make_temporary_clone(
+            host, system_matrix->get_col_partition().get());
+        const auto col_part_ids = col_partition->get_part_ids();
+        const auto coarse_size = static_cast<size_type>(num_parts);
+        auto local_mtx = csr_type::create(host);
+        auto non_local_mtx = csr_type::create(host);
+        as<ConvertibleTo<csr_type>>(system_matrix->get_local_matrix())
+            ->convert_to(local_mtx);
+        as<ConvertibleTo<csr_type>>(system_matrix->get_non_local_matrix())
+            ->convert_to(non_local_mtx);
+        const array<GlobalIndexType> non_local_to_global{
+            host, system_matrix->get_non_local_to_global()};
+        coarse_mtx = Dense::create(host, dim<2>{coarse_size, coarse_size});
+        coarse_mtx->fill(zero<ValueType>());
+        for (size_type nz = 0; nz < local_mtx->get_num_stored_elements();
+             ++nz) {
+            coarse_mtx->at(rank, rank) += local_mtx->get_const_values()[nz];
+        }
+        const auto non_local_col_idxs = non_local_mtx->get_const_col_idxs();
+        for (size_type nz = 0; nz < non_local_mtx->get_num_stored_elements();
+             ++nz) {
+            const auto idx =
+                non_local_to_global.get_const_data()[non_local_col_idxs[nz]];
+            const auto part =
+                col_part_ids[find_range(col_partition.get(), idx)];
+            coarse_mtx->at(rank, part) += non_local_mtx->get_const_values()[nz];
+        }
+        matrix_data<ValueType, LocalIndexType> restriction_data{
+            dim<2>{coarse_size, num_local_rows}};
+        matrix_data<ValueType, LocalIndexType> prolongation_data{
+            dim<2>{num_local_rows, coarse_size}};
+        for (size_type row = 0; row < num_local_rows; ++row) {
+            restriction_data.nonzeros.emplace_back(rank, row,
+                                                   one<ValueType>());
+            prolongation_data.nonzeros.emplace_back(row, rank,
+                                                    one<ValueType>());
+        }
+        auto restriction = share(csr_type::create(exec));
+        auto prolongation = share(csr_type::create(exec));
+        restriction->read(restriction_data);
+        prolongation->read(prolongation_data);
+        coarse_restriction_ = restriction;
+        coarse_prolongation_ = prolongation;
+    }
+    comm_.all_reduce(host, coarse_mtx->get_values(),
+                     static_cast<int>(coarse_mtx->get_num_stored_elements()),
+                     MPI_SUM);
+    if (!parameters_.coarse_space) {
+        // ranks without unknowns have an empty aggregate
+        const auto local_size = static_cast<GlobalIndexType>(num_local_rows);
+        std::vector<GlobalIndexType> local_sizes(num_parts);
+        comm_.all_gather(host, &local_size, 1, local_sizes.data(), 1);
+        for (comm_index_type part = 0; part < num_parts; ++part) {
+            if (local_sizes[part] == 0) {
+                coarse_mtx->at(part, part) = one<ValueType>();
+            }
+        }
+    }
+    coarse_inverse_ = gko::clone(exec, invert_dense(coarse_mtx.get()));
 }
 
 
@@ -540,6 +540,103 @@ void Vector<ValueType>::compute_norm1(ptr_param<LinOp> result,
 }
 
 
+template <typename ValueType>
+void Vector<ValueType>::compute_conj_dots(
+    const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+    const std::vector<local_vector_type*>& results)
+{
+    if (pairs.empty()) {
+        return;
+    }
+    array<char> tmp{pairs.front().first->get_executor()};
+    compute_conj_dots(pairs, results, tmp);
+}
+
+
+template <typename ValueType>
+void Vector<ValueType>::compute_conj_dots(
+    const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+    const std::vector<local_vector_type*>& results, array<char>& tmp)
+{
+    GKO_ASSERT_EQ(pairs.size(), results.size());
+    if (pairs.empty()) {
+        return;
+    }
+    const auto first = pairs.front().first;
+    auto exec = first->get_executor();
+    const auto comm = first->get_communicator();
+    const auto num_pairs = pairs.size();
+    const auto num_cols = first->get_size()[1];
+    for (size_type i = 0; i < num_pairs; ++i) {
+        GKO_ASSERT_EQUAL_DIMENSIONS(pairs[i].first, first);
+        GKO_ASSERT_EQUAL_DIMENSIONS(pairs[i].second, first);
+        GKO_ASSERT_EQUAL_DIMENSIONS(results[i], dim<2>(1, num_cols));
+        pairs[i].first->get_local_vector()->compute_conj_dot(
+            pairs[i].second->get_local_vector(), results[i], tmp);
+    }
+    // pack the local results to reduce them all at once
+    const auto& buffer = first->multi_reduction_buffer_;
+    buffer.init(mpi::requires_host_buffer(exec, comm) ? exec->get_master()
+                                                      : exec,
+                dim<2>{num_pairs, num_cols});
+    auto buffer_exec = buffer->get_executor();
+    for (size_type i = 0; i < num_pairs; ++i) {
+        buffer_exec->copy_from(results[i]->get_executor(), num_cols,
+                               results[i]->get_const_values(),
+                               buffer->get_values() + i * num_cols);
+    }
+    exec->synchronize();
+    comm.all_reduce(buffer_exec, buffer->get_values(),
+                    static_cast<int>(num_pairs * num_cols), MPI_SUM);
+    for (size_type i = 0; i < num_pairs; ++i) {
+        results[i]->get_executor()->copy_from(
+            buffer_exec, num_cols, buffer->get_const_values() + i * num_cols,
+            results[i]->get_values());
+    }
+}
+
+
+template <typename ValueType>
+mpi::request Vector<ValueType>::i_compute_conj_dots(
+    const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+    ptr_param<local_vector_type> result)
+{
+    if (pairs.empty()) {
+        return {};
+    }
+    array<char> tmp{pairs.front().first->get_executor()};
+    return i_compute_conj_dots(pairs, result, tmp);
+}
+
+
+template <typename ValueType>
+mpi::request Vector<ValueType>::i_compute_conj_dots(
+    const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+    ptr_param<local_vector_type> result, array<char>& tmp)
+{
+    if (pairs.empty()) {
+        return {};
+    }
+    const auto first = pairs.front().first;
+    const auto comm = first->get_communicator();
+    const auto num_pairs = pairs.size();
+    const auto num_cols = first->get_size()[1];
+    GKO_ASSERT_EQUAL_DIMENSIONS(result, dim<2>(num_pairs, num_cols));
+    GKO_ASSERT_EQ(result->get_stride(), num_cols);
+    for (size_type i = 0; i < num_pairs; ++i) {
+        GKO_ASSERT_EQUAL_DIMENSIONS(pairs[i].first, first);
+        GKO_ASSERT_EQUAL_DIMENSIONS(pairs[i].second, first);
+        auto row = result->create_submatrix(span{i, i + 1}, span{0, num_cols});
+        pairs[i].first->get_local_vector()->compute_conj_dot(
+            pairs[i].second->get_local_vector(), row, tmp);
+    }
+    first->get_executor()->synchronize();
+    result->get_executor()->synchronize();
+    return comm.i_all_reduce(result->get_executor(), result->get_values(),
+                             static_cast<int>(num_pairs * num_cols), MPI_SUM);
+}
+
+
 template <typename ValueType>
 void Vector<ValueType>::compute_squared_norm2(ptr_param<LinOp> result) const
 {
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/factorization/cholesky.hpp>
 
 
+#include <memory>
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/types.hpp>
@@ -114,39 +117,62 @@ std::unique_ptr<LinOp> Cholesky<ValueType, IndexType>::generate_impl(
         exec->run(make_forest_from_factor(factors.get(), *forest));
     }
     // setup lookup structure on factors
-    array<IndexType> storage_offsets{exec, num_rows + 1};
-    array<int64> row_descs{exec, num_rows};
-    array<IndexType> diag_idxs{exec, num_rows};
-    array<IndexType> transpose_idxs{exec, factors->get_num_stored_elements()};
+    struct lookup_data {
+        array<IndexType> storage_offsets;
+        array<int64> row_descs;
+        array<IndexType> diag_idxs;
+        array<IndexType> transpose_idxs;
+        array<int32> storage;
+        array<int> tmp;
+        std::unique_ptr<gko::factorization::elimination_forest<IndexType>>
+            forest;
+    };
+    auto lookup = std::make_shared<lookup_data>(lookup_data{
+        array<IndexType>{exec, num_rows + 1}, array<int64>{exec, num_rows},
+        array<IndexType>{exec, num_rows},
+        array<IndexType>{exec, factors->get_num_stored_elements()},
+        array<int32>{exec}, array<int>{exec}, std::move(forest)});
     const auto allowed_sparsity = gko::matrix::csr::sparsity_type::bitmap |
                                   gko::matrix::csr::sparsity_type::full |
                                   gko::matrix::csr::sparsity_type::hash;
     exec->run(make_build_lookup_offsets(
         factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_data()));
-    const auto storage_size = static_cast<size_type>(
-        exec->copy_val_to_host(storage_offsets.get_const_data() + num_rows));
-    array<int32> storage{exec, storage_size};
+        allowed_sparsity, lookup->storage_offsets.get_data()));
+    const auto storage_size = static_cast<size_type>(exec->copy_val_to_host(
+        lookup->storage_offsets.get_const_data() + num_rows));
+    lookup->storage.resize_and_reset(storage_size);
     exec->run(make_build_lookup(
         factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_const_data(),
-        row_descs.get_data(), storage.get_data()));
-    // initialize factors
-    exec->run(make_fill_array(factors->get_values(),
-                              factors->get_num_stored_elements(),
-                              zero<ValueType>()));
-    exec->run(make_initialize(mtx.get(), storage_offsets.get_const_data(),
-                              row_descs.get_const_data(),
-                              storage.get_const_data(), diag_idxs.get_data(),
-                              transpose_idxs.get_data(), factors.get()));
-    // run numerical factorization
-    array<int> tmp{exec};
-    exec->run(make_factorize(
-        storage_offsets.get_const_data(), row_descs.get_const_data(),
-        storage.get_const_data(), diag_idxs.get_const_data(),
-        transpose_idxs.get_const_data(), *forest, factors.get(), tmp));
-    return factorization_type::create_from_combined_cholesky(
+        allowed_sparsity, lookup->storage_offsets.get_const_data(),
+        lookup->row_descs.get_data(), lookup->storage.get_data()));
+    // the numerical factorization only depends on the lookup structure and
+    // the elimination forest, so it can be repeated for new values with the
+    // same sparsity pattern
+    auto numeric_factorization = [exec, lookup](const LinOp* new_matrix,
+                                                matrix_type* factors) {
+        const auto mtx = copy_and_convert_to<matrix_type>(exec, new_matrix);
+        // initialize factors
+        exec->run(make_fill_array(factors->get_values(),
+                                  factors->get_num_stored_elements(),
+                                  zero<ValueType>()));
+        exec->run(make_initialize(
+            mtx.get(), lookup->storage_offsets.get_const_data(),
+            lookup->row_descs.get_const_data(),
+            lookup->storage.get_const_data(), lookup->diag_idxs.get_data(),
+            lookup->transpose_idxs.get_data(), factors));
+        // run numerical factorization
+        exec->run(make_factorize(lookup->storage_offsets.get_const_data(),
+                                 lookup->row_descs.get_const_data(),
+                                 lookup->storage.get_const_data(),
+                                 lookup->diag_idxs.get_const_data(),
+                                 lookup->transpose_idxs.get_const_data(),
+                                 *lookup->forest, factors, lookup->tmp));
+    };
+    numeric_factorization(mtx.get(), factors.get());
+    auto result = factorization_type::create_from_combined_cholesky(
         std::move(factors));
+    result->numeric_factorization_ = std::move(numeric_factorization);
+    return result;
 }
 
 
@@ -36,11 +36,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/types.hpp>
 
 
+#include "core/factorization/cholesky_kernels.hpp"
+
+
 namespace gko {
 namespace factorization {
 namespace {
 
 
+GKO_REGISTER_OPERATION(compute_skeleton_tree, cholesky::compute_skeleton_tree);
+
+
 template <typename IndexType>
 void compute_elim_forest_parent_impl(std::shared_ptr<const Executor> host_exec,
                                      const IndexType* row_ptrs,
@@ -177,9 +183,19 @@ void compute_elim_forest(const matrix::Csr<ValueType, IndexType>* mtx,
     const auto num_rows = static_cast<IndexType>(host_mtx->get_size()[0]);
     forest =
         std::make_unique<elimination_forest<IndexType>>(host_exec, num_rows);
-    compute_elim_forest_parent_impl(host_exec, host_mtx->get_const_row_ptrs(),
-                                    host_mtx->get_const_col_idxs(), num_rows,
-                                    forest->parents.get_data());
+    // The spanning forest of the lower triangle that is minimal wrt. the row
+    // index has the same elimination forest as the matrix, but only at most
+    // num_rows - 1 edges. It can be computed in parallel on the host.
+    array<IndexType> skeleton_row_ptrs{host_exec,
+                                       static_cast<size_type>(num_rows + 1)};
+    array<IndexType> skeleton_cols{host_exec, static_cast<size_type>(num_rows)};
+    host_exec->run(make_compute_skeleton_tree(
+        host_mtx->get_const_row_ptrs(), host_mtx->get_const_col_idxs(),
+        host_mtx->get_size()[0], skeleton_row_ptrs.get_data(),
+        skeleton_cols.get_data()));
+    compute_elim_forest_parent_impl(
+        host_exec, skeleton_row_ptrs.get_const_data(),
+        skeleton_cols.get_const_data(), num_rows, forest->parents.get_data());
     compute_elim_forest_children_impl(forest->parents.get_const_data(),
                                       num_rows, forest->child_ptrs.get_data(),
                                       forest->children.get_data());
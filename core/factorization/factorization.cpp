@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/factorization/factorization.hpp>
 
 
+#include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
@@ -139,6 +140,22 @@ Factorization<ValueType, IndexType>::get_combined() const
 }
 
 
+template <typename ValueType, typename IndexType>
+void Factorization<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+    const auto combined = this->get_combined();
+    if (!numeric_factorization_ || !combined) {
+        GKO_NOT_SUPPORTED(this);
+    }
+    // the combined factors are owned by this factorization, they are only
+    // handed out as const to prevent modification by users
+    numeric_factorization_(new_matrix.get(),
+                           const_cast<matrix_type*>(combined.get()));
+}
+
+
 template <typename ValueType, typename IndexType>
 Factorization<ValueType, IndexType>::Factorization(const Factorization& fact)
     : Factorization{fact.get_executor()}
@@ -163,6 +180,11 @@ Factorization<ValueType, IndexType>::operator=(const Factorization& fact)
         EnableLinOp<Factorization<ValueType, IndexType>>::operator=(fact);
         storage_type_ = fact.storage_type_;
         *factors_ = *fact.factors_;
+        // the symbolic data is only available on the original executor
+        numeric_factorization_ =
+            fact.get_executor() == this->get_executor()
+                ? fact.numeric_factorization_
+                : nullptr;
     }
     return *this;
 }
@@ -178,8 +200,11 @@ Factorization<ValueType, IndexType>::operator=(Factorization&& fact)
         storage_type_ = std::exchange(fact.storage_type_, storage_type::empty);
         factors_ =
             std::exchange(fact.factors_, fact.factors_->create_default());
+        numeric_factorization_ =
+            std::exchange(fact.numeric_factorization_, nullptr);
         if (factors_->get_executor() != this->get_executor()) {
             factors_ = factors_->clone(this->get_executor());
+            numeric_factorization_ = nullptr;
         }
     }
     return *this;
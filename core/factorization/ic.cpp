@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/ic_kernels.hpp"
+#include "core/matrix/csr_kernels.hpp"
 
 
 namespace gko {
@@ -57,6 +58,7 @@ GKO_REGISTER_OPERATION(add_diagonal_elements,
 GKO_REGISTER_OPERATION(initialize_row_ptrs_l,
                        factorization::initialize_row_ptrs_l);
 GKO_REGISTER_OPERATION(initialize_l, factorization::initialize_l);
+GKO_REGISTER_OPERATION(csr_conj_transpose, csr::conj_transpose);
 
 
 }  // anonymous namespace
@@ -121,6 +123,42 @@ std::unique_ptr<Composition<ValueType>> Ic<ValueType, IndexType>::generate(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Ic<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto local_system_matrix = matrix_type::create(exec);
+    as<ConvertibleTo<matrix_type>>(new_matrix.get())
+        ->convert_to(local_system_matrix);
+
+    if (!parameters_.skip_sorting) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    exec->run(ic_factorization::make_add_diagonal_elements(
+        local_system_matrix.get(), false));
+
+    exec->run(ic_factorization::make_compute(local_system_matrix.get()));
+
+    // The sparsity pattern of the factors is unchanged, so the existing
+    // factors can be overwritten. They are owned by this object and only
+    // handed out as const.
+    const auto l_factor =
+        std::const_pointer_cast<matrix_type>(this->get_l_factor());
+    exec->run(ic_factorization::make_initialize_l(local_system_matrix.get(),
+                                                  l_factor.get(), false));
+    if (this->get_operators().size() == 2) {
+        exec->run(ic_factorization::make_csr_conj_transpose(
+            l_factor.get(),
+            std::const_pointer_cast<matrix_type>(this->get_lt_factor()).get()));
+    }
+}
+
+
 #define GKO_DECLARE_IC(ValueType, IndexType) class Ic<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC);
 
@@ -38,11 +38,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/ilu_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
 
 
 namespace gko {
@@ -57,6 +60,40 @@ GKO_REGISTER_OPERATION(add_diagonal_elements,
 GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
                        factorization::initialize_row_ptrs_l_u);
 GKO_REGISTER_OPERATION(initialize_l_u, factorization::initialize_l_u);
+GKO_REGISTER_HOST_OPERATION(symbolic_ilu, factorization::symbolic_ilu);
+
+
+/**
+ * Computes the combined incomplete LU factors L + U - I of the given sorted
+ * matrix. For fill_level 0, they are computed in-place on the sparsity pattern
+ * of the matrix, otherwise on the ILU(k) sparsity pattern using the numerical
+ * phase of the exact LU factorization restricted to this pattern.
+ */
+template <typename ValueType, typename IndexType>
+std::shared_ptr<const matrix::Csr<ValueType, IndexType>> compute_factors(
+    std::shared_ptr<matrix::Csr<ValueType, IndexType>> system_matrix,
+    size_type fill_level)
+{
+    const auto exec = system_matrix->get_executor();
+    if (fill_level == 0) {
+        // Add explicit diagonal zero elements if they are missing
+        exec->run(make_add_diagonal_elements(system_matrix.get(), false));
+        exec->run(make_compute_ilu(system_matrix.get()));
+        return system_matrix;
+    }
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> pattern;
+    exec->run(make_symbolic_ilu(system_matrix.get(), fill_level, pattern));
+    auto symbolic =
+        share(matrix::SparsityCsr<ValueType, IndexType>::create(exec));
+    pattern->move_to(symbolic);
+    return experimental::factorization::Lu<ValueType, IndexType>::build()
+        .with_symbolic_factorization(symbolic)
+        .with_checked_lookup(true)
+        .with_skip_sorting(true)
+        .on(exec)
+        ->generate(system_matrix)
+        ->get_combined();
+}
 
 
 }  // anonymous namespace
@@ -73,7 +110,7 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
 
     // Converts the system matrix to CSR.
     // Throws an exception if it is not convertible.
-    auto local_system_matrix = matrix_type::create(exec);
+    auto local_system_matrix = share(matrix_type::create(exec));
     as<ConvertibleTo<matrix_type>>(system_matrix.get())
         ->convert_to(local_system_matrix);
 
@@ -81,21 +118,17 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
         local_system_matrix->sort_by_column_index();
     }
 
-    // Add explicit diagonal zero elements if they are missing
-    exec->run(ilu_factorization::make_add_diagonal_elements(
-        local_system_matrix.get(), false));
-
     // Compute LU factorization
-    exec->run(ilu_factorization::make_compute_ilu(local_system_matrix.get()));
+    const auto factors = ilu_factorization::compute_factors(
+        local_system_matrix, parameters_.fill_level);
 
     // Separate L and U factors: nnz
-    const auto matrix_size = local_system_matrix->get_size();
+    const auto matrix_size = factors->get_size();
     const auto num_rows = matrix_size[0];
     array<IndexType> l_row_ptrs{exec, num_rows + 1};
     array<IndexType> u_row_ptrs{exec, num_rows + 1};
     exec->run(ilu_factorization::make_initialize_row_ptrs_l_u(
-        local_system_matrix.get(), l_row_ptrs.get_data(),
-        u_row_ptrs.get_data()));
+        factors.get(), l_row_ptrs.get_data(), u_row_ptrs.get_data()));
 
     // Get nnz from device memory
     auto l_nnz = static_cast<size_type>(
@@ -117,13 +150,42 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
 
     // Separate L and U: columns and values
     exec->run(ilu_factorization::make_initialize_l_u(
-        local_system_matrix.get(), l_factor.get(), u_factor.get()));
+        factors.get(), l_factor.get(), u_factor.get()));
 
     return Composition<ValueType>::create(std::move(l_factor),
                                           std::move(u_factor));
 }
 
 
+template <typename ValueType, typename IndexType>
+void Ilu<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto local_system_matrix = share(matrix_type::create(exec));
+    as<ConvertibleTo<matrix_type>>(new_matrix.get())
+        ->convert_to(local_system_matrix);
+
+    if (!parameters_.skip_sorting) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    const auto factors = ilu_factorization::compute_factors(
+        local_system_matrix, parameters_.fill_level);
+
+    // The sparsity pattern of L and U is unchanged, so the existing factors
+    // can be overwritten. They are owned by this object and only handed out
+    // as const.
+    exec->run(ilu_factorization::make_initialize_l_u(
+        factors.get(),
+        std::const_pointer_cast<matrix_type>(this->get_l_factor()).get(),
+        std::const_pointer_cast<matrix_type>(this->get_u_factor()).get()));
+}
+
+
 #define GKO_DECLARE_ILU(ValueType, IndexType) class Ilu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU);
 
@@ -63,13 +63,33 @@ namespace kernels {
                    const IndexType* lookup_offsets, const int64* lookup_descs, \
                    const int32* lookup_storage, const IndexType* diag_idxs,    \
                    matrix::Csr<ValueType, IndexType>* factors,                 \
-                   array<int>& tmp_storage)
+                   bool checked_lookup, array<int>& tmp_storage)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                  \
-    template <typename ValueType, typename IndexType> \
-    GKO_DECLARE_LU_INITIALIZE(ValueType, IndexType);  \
-    template <typename ValueType, typename IndexType> \
+#define GKO_DECLARE_LU_SYMBOLIC_FACTORIZE(IndexType)                       \
+    void symbolic_factorize(std::shared_ptr<const DefaultExecutor> exec,   \
+                            const IndexType* row_ptrs,                     \
+                            const IndexType* col_idxs, size_type num_rows, \
+                            IndexType* out_row_ptrs,                       \
+                            array<IndexType>& out_col_idxs)
+
+
+#define GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL(IndexType)            \
+    void symbolic_factorize_fill_level(                                    \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const IndexType* row_ptrs, const IndexType* col_idxs,              \
+        size_type num_rows, size_type fill_level, IndexType* out_row_ptrs, \
+        array<IndexType>& out_col_idxs)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                         \
+    template <typename IndexType>                            \
+    GKO_DECLARE_LU_SYMBOLIC_FACTORIZE(IndexType);            \
+    template <typename IndexType>                            \
+    GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL(IndexType); \
+    template <typename ValueType, typename IndexType>        \
+    GKO_DECLARE_LU_INITIALIZE(ValueType, IndexType);         \
+    template <typename ValueType, typename IndexType>        \
     GKO_DECLARE_LU_FACTORIZE(ValueType, IndexType)
 
 
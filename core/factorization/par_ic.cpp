@@ -65,6 +65,7 @@ GKO_REGISTER_OPERATION(initialize_l, factorization::initialize_l);
 GKO_REGISTER_OPERATION(init_factor, par_ic_factorization::init_factor);
 GKO_REGISTER_OPERATION(compute_factor, par_ic_factorization::compute_factor);
 GKO_REGISTER_OPERATION(csr_transpose, csr::transpose);
+GKO_REGISTER_OPERATION(csr_conj_transpose, csr::conj_transpose);
 GKO_REGISTER_OPERATION(convert_ptrs_to_idxs, components::convert_ptrs_to_idxs);
 
 
@@ -147,6 +148,57 @@ std::unique_ptr<Composition<ValueType>> ParIc<ValueType, IndexType>::generate(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIc<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(new_matrix.get())
+        ->convert_to(csr_system_matrix);
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
+    }
+
+    exec->run(par_ic_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
+
+    // The sparsity pattern of the factors is unchanged, so the existing
+    // factors can be overwritten. They are owned by this object and only
+    // handed out as const.
+    const auto l_factor =
+        std::const_pointer_cast<matrix_type>(this->get_l_factor());
+    exec->run(par_ic_factorization::make_initialize_l(csr_system_matrix.get(),
+                                                      l_factor.get(), false));
+
+    const auto l_nnz = l_factor->get_num_stored_elements();
+    auto l_vals_view = make_array_view(exec, l_nnz, l_factor->get_values());
+    auto a_vals = array<ValueType>{exec, l_vals_view};
+    auto a_row_idxs = array<IndexType>{exec, l_nnz};
+    auto a_col_idxs = make_array_view(exec, l_nnz, l_factor->get_col_idxs());
+    auto a_lower_coo =
+        CooMatrix::create(exec, l_factor->get_size(), std::move(a_vals),
+                          std::move(a_col_idxs), std::move(a_row_idxs));
+
+    exec->run(par_ic_factorization::make_init_factor(l_factor.get()));
+
+    exec->run(par_ic_factorization::make_compute_factor(
+        parameters_.iterations, a_lower_coo.get(), l_factor.get()));
+
+    if (this->get_operators().size() == 2) {
+        exec->run(par_ic_factorization::make_csr_conj_transpose(
+            l_factor.get(),
+            std::const_pointer_cast<matrix_type>(this->get_lt_factor()).get()));
+    }
+}
+
+
 #define GKO_DECLARE_PAR_IC(ValueType, IndexType) \
     class ParIc<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_IC);
@@ -164,6 +164,53 @@ ParIlu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIlu<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(new_matrix.get())
+        ->convert_to(csr_system_matrix);
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
+    }
+
+    exec->run(par_ilu_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
+
+    // The sparsity pattern of L and U is unchanged, so the existing factors
+    // can be overwritten. They are owned by this object and only handed out
+    // as const.
+    const auto l_factor =
+        std::const_pointer_cast<l_matrix_type>(this->get_l_factor());
+    const auto u_factor =
+        std::const_pointer_cast<u_matrix_type>(this->get_u_factor());
+    exec->run(par_ilu_factorization::make_initialize_l_u(
+        csr_system_matrix.get(), l_factor.get(), u_factor.get()));
+
+    auto u_factor_transpose_lin_op = u_factor->transpose();
+    auto u_factor_transpose =
+        static_cast<u_matrix_type*>(u_factor_transpose_lin_op.get());
+
+    auto coo_system_matrix = CooMatrix::create(exec);
+    csr_system_matrix->move_to(coo_system_matrix);
+
+    exec->run(par_ilu_factorization::make_compute_l_u_factors(
+        parameters_.iterations, coo_system_matrix.get(), l_factor.get(),
+        u_factor_transpose));
+
+    exec->run(par_ilu_factorization::make_csr_transpose(u_factor_transpose,
+                                                        u_factor.get()));
+}
+
+
 #define GKO_DECLARE_PAR_ILU(ValueType, IndexType) \
     class ParIlu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILU);
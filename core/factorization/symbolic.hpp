@@ -69,6 +69,25 @@ template <typename ValueType, typename IndexType>
 void symbolic_lu(const matrix::Csr<ValueType, IndexType>* mtx,
                  std::unique_ptr<matrix::Csr<ValueType, IndexType>>& factors);
 
+/**
+ * Computes the sparsity pattern of the incomplete LU factorization ILU(k) of
+ * the given matrix based on the level of fill of each entry, see Saad,
+ * "Iterative Methods for Sparse Linear Systems," 2nd ed., SIAM 2003,
+ * Sec. 10.3.3.
+ * The entries of the matrix have level 0, and eliminating the entry (i, k)
+ * with the entry (k, j) creates fill-in (i, j) with level
+ * lev(i, k) + lev(k, j) + 1. Only fill-in up to level fill_level is kept.
+ * The diagonal is always part of the pattern.
+ *
+ * @param mtx  the input matrix
+ * @param fill_level  the maximum level of fill-in entries
+ * @param factors  the output factors stored in a combined pattern
+ */
+template <typename ValueType, typename IndexType>
+void symbolic_ilu(const matrix::Csr<ValueType, IndexType>* mtx,
+                  size_type fill_level,
+                  std::unique_ptr<matrix::Csr<ValueType, IndexType>>& factors);
+
 
 }  // namespace factorization
 }  // namespace gko
@@ -0,0 +1,144 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/multigrid/classical_coarsening.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/utils.hpp"
+#include "core/multigrid/classical_coarsening_kernels.hpp"
+#include "core/multigrid/galerkin_kernels.hpp"
+
+
+namespace gko {
+namespace multigrid {
+namespace classical_coarsening {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_strength,
+                       classical_coarsening::compute_strength);
+GKO_REGISTER_OPERATION(select_coarse_points,
+                       classical_coarsening::select_coarse_points);
+GKO_REGISTER_OPERATION(compute_interpolation,
+                       classical_coarsening::compute_interpolation);
+GKO_REGISTER_OPERATION(compute_rap_symbolic, galerkin::compute_rap_symbolic);
+GKO_REGISTER_OPERATION(compute_rap_numeric, galerkin::compute_rap_numeric);
+
+
+}  // anonymous namespace
+}  // namespace classical_coarsening
+
+
+template <typename ValueType, typename IndexType>
+void ClassicalCoarsening<ValueType, IndexType>::generate()
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using real_type = remove_complex<ValueType>;
+    auto exec = this->get_executor();
+    const auto num_rows = this->system_matrix_->get_size()[0];
+    const csr_type* rs_op = dynamic_cast<const csr_type*>(system_matrix_.get());
+    std::shared_ptr<const csr_type> rs_op_shared_ptr{};
+    // If system matrix is not csr or need sorting, generate the csr.
+    if (!parameters_.skip_sorting || !rs_op) {
+        rs_op_shared_ptr = convert_to_with_sorting<csr_type>(
+            exec, system_matrix_, parameters_.skip_sorting);
+        rs_op = rs_op_shared_ptr.get();
+        // keep the same precision data in fine_op
+        this->set_fine_op(rs_op_shared_ptr);
+    }
+    auto strength = csr_type::create(exec, rs_op->get_size());
+    exec->run(classical_coarsening::make_compute_strength(
+        rs_op, static_cast<real_type>(parameters_.strength_threshold),
+        strength.get()));
+    // the rows of the transpose list the rows strongly depending on a row
+    auto strength_transposed = as<csr_type>(strength->transpose());
+    IndexType num_coarse{};
+    exec->run(classical_coarsening::make_select_coarse_points(
+        strength.get(), strength_transposed.get(), coarse_map_, &num_coarse));
+    auto prolongator = share(csr_type::create(
+        exec, gko::dim<2>{num_rows, static_cast<size_type>(num_coarse)}));
+    exec->run(classical_coarsening::make_compute_interpolation(
+        rs_op, strength.get(), coarse_map_, prolongator.get()));
+    auto restriction = share(as<csr_type>(prolongator->transpose()));
+    // Galerkin product R A P without storing A P
+    auto coarse_matrix = share(csr_type::create(
+        exec, gko::dim<2>{restriction->get_size()[0],
+                          prolongator->get_size()[1]}));
+    exec->run(classical_coarsening::make_compute_rap_symbolic(
+        restriction.get(), rs_op, prolongator.get(), coarse_matrix.get()));
+    exec->run(classical_coarsening::make_compute_rap_numeric(
+        restriction.get(), rs_op, prolongator.get(), coarse_matrix.get()));
+
+    this->set_multigrid_level(prolongator, coarse_matrix, restriction);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ClassicalCoarsening<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> fine_op)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(system_matrix_, fine_op);
+    auto exec = this->get_executor();
+    system_matrix_ = fine_op;
+    auto rs_op = convert_to_with_sorting<csr_type>(exec, system_matrix_,
+                                                   parameters_.skip_sorting);
+    this->set_fine_op(rs_op);
+    auto prolongator = as<csr_type>(this->get_prolong_op());
+    auto restriction = as<csr_type>(this->get_restrict_op());
+    // the sparsity pattern of the coarse matrix is unchanged, so only its
+    // values need to be recomputed
+    auto coarse_matrix = share(gko::clone(as<csr_type>(this->get_coarse_op())));
+    exec->run(classical_coarsening::make_compute_rap_numeric(
+        restriction.get(), rs_op.get(), prolongator.get(),
+        coarse_matrix.get()));
+
+    this->set_multigrid_level(prolongator, coarse_matrix, restriction);
+}
+
+
+#define GKO_DECLARE_CLASSICAL_COARSENING(_vtype, _itype) \
+    class ClassicalCoarsening<_vtype, _itype>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CLASSICAL_COARSENING);
+
+
+}  // namespace multigrid
+}  // namespace gko
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/matrix/csr_builder.hpp"
+#include "core/multigrid/galerkin_kernels.hpp"
 
 
 namespace gko {
@@ -59,6 +60,7 @@ namespace {
 
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
 GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
+GKO_REGISTER_OPERATION(compute_rap_numeric, galerkin::compute_rap_numeric);
 
 
 }  // anonymous namespace
@@ -118,6 +120,30 @@ void FixedCoarsening<ValueType, IndexType>::generate()
 }
 
 
+template <typename ValueType, typename IndexType>
+void FixedCoarsening<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> fine_op)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(system_matrix_, fine_op);
+    auto exec = this->get_executor();
+    system_matrix_ = fine_op;
+    auto fixed_coarsening_op = convert_to_with_sorting<csr_type>(
+        exec, system_matrix_, parameters_.skip_sorting);
+    this->set_fine_op(fixed_coarsening_op);
+    auto prolongator = as<csr_type>(this->get_prolong_op());
+    auto restriction = as<csr_type>(this->get_restrict_op());
+    // the sparsity pattern of the coarse matrix is unchanged, so only its
+    // values need to be recomputed
+    auto coarse_matrix = share(gko::clone(as<csr_type>(this->get_coarse_op())));
+    exec->run(fixed_coarsening::make_compute_rap_numeric(
+        restriction.get(), fixed_coarsening_op.get(), prolongator.get(),
+        coarse_matrix.get()));
+
+    this->set_multigrid_level(prolongator, coarse_matrix, restriction);
+}
+
+
 #define GKO_DECLARE_FIXED_COARSENING(_vtype, _itype) \
     class FixedCoarsening<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FIXED_COARSENING);
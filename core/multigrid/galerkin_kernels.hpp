@@ -0,0 +1,101 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_MULTIGRID_GALERKIN_KERNELS_HPP_
+#define GKO_CORE_MULTIGRID_GALERKIN_KERNELS_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace galerkin {
+
+
+/**
+ * Computes the sparsity pattern of the Galerkin product R * A * P row by row
+ * without forming A * P. The column indices of every row of the output are
+ * sorted, its values are left uninitialized.
+ */
+#define GKO_DECLARE_GALERKIN_COMPUTE_RAP_SYMBOLIC(ValueType, IndexType) \
+    void compute_rap_symbolic(                                          \
+        std::shared_ptr<const DefaultExecutor> exec,                    \
+        const matrix::Csr<ValueType, IndexType>* restriction,           \
+        const matrix::Csr<ValueType, IndexType>* mtx,                   \
+        const matrix::Csr<ValueType, IndexType>* prolongator,           \
+        matrix::Csr<ValueType, IndexType>* coarse)
+
+/**
+ * Computes the values of the Galerkin product R * A * P into the sparsity
+ * pattern of coarse computed by compute_rap_symbolic. It can be rerun
+ * whenever the values, but not the sparsity patterns, of the inputs change.
+ */
+#define GKO_DECLARE_GALERKIN_COMPUTE_RAP_NUMERIC(ValueType, IndexType) \
+    void compute_rap_numeric(                                          \
+        std::shared_ptr<const DefaultExecutor> exec,                   \
+        const matrix::Csr<ValueType, IndexType>* restriction,          \
+        const matrix::Csr<ValueType, IndexType>* mtx,                  \
+        const matrix::Csr<ValueType, IndexType>* prolongator,          \
+        matrix::Csr<ValueType, IndexType>* coarse)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                 \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_GALERKIN_COMPUTE_RAP_SYMBOLIC(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_GALERKIN_COMPUTE_RAP_NUMERIC(ValueType, IndexType)
+
+
+}  // namespace galerkin
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(galerkin,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_GALERKIN_KERNELS_HPP_
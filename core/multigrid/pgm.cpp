@@ -33,13 +33,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/polymorphic_object.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/base/utils.hpp>
-#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
@@ -50,6 +57,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
+#include "core/distributed/helpers.hpp"
 #include "core/matrix/csr_builder.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
 
@@ -66,11 +74,7 @@ GKO_REGISTER_OPERATION(renumber, pgm::renumber);
 GKO_REGISTER_OPERATION(find_strongest_neighbor, pgm::find_strongest_neighbor);
 GKO_REGISTER_OPERATION(assign_to_exist_agg, pgm::assign_to_exist_agg);
 GKO_REGISTER_OPERATION(sort_agg, pgm::sort_agg);
-GKO_REGISTER_OPERATION(map_row, pgm::map_row);
-GKO_REGISTER_OPERATION(map_col, pgm::map_col);
-GKO_REGISTER_OPERATION(sort_row_major, pgm::sort_row_major);
-GKO_REGISTER_OPERATION(count_unrepeated_nnz, pgm::count_unrepeated_nnz);
-GKO_REGISTER_OPERATION(compute_coarse_coo, pgm::compute_coarse_coo);
+GKO_REGISTER_OPERATION(compute_coarse_csr, pgm::compute_coarse_csr);
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
 GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
@@ -102,75 +106,42 @@ template <typename ValueType, typename IndexType>
 std::shared_ptr<matrix::Csr<ValueType, IndexType>> generate_coarse(
     std::shared_ptr<const Executor> exec,
     const matrix::Csr<ValueType, IndexType>* fine_csr, IndexType num_agg,
-    const gko::array<IndexType>& agg)
+    const gko::array<IndexType>& agg,
+    const matrix::SparsityCsr<ValueType, IndexType>* restrict_sparsity)
 {
-    const auto num = fine_csr->get_size()[0];
-    const auto nnz = fine_csr->get_num_stored_elements();
-    gko::array<IndexType> row_idxs(exec, nnz);
-    gko::array<IndexType> col_idxs(exec, nnz);
-    gko::array<ValueType> vals(exec, nnz);
-    exec->copy_from(exec, nnz, fine_csr->get_const_values(), vals.get_data());
-    // map row_ptrs to coarse row index
-    exec->run(pgm::make_map_row(num, fine_csr->get_const_row_ptrs(),
-                                agg.get_const_data(), row_idxs.get_data()));
-    // map col_idxs to coarse col index
-    exec->run(pgm::make_map_col(nnz, fine_csr->get_const_col_idxs(),
-                                agg.get_const_data(), col_idxs.get_data()));
-    // sort by row, col
-    exec->run(pgm::make_sort_row_major(nnz, row_idxs.get_data(),
-                                       col_idxs.get_data(), vals.get_data()));
-    // compute the total nnz and create the fine csr
-    size_type coarse_nnz = 0;
-    exec->run(pgm::make_count_unrepeated_nnz(nnz, row_idxs.get_const_data(),
-                                             col_idxs.get_const_data(),
-                                             &coarse_nnz));
-    // reduce by key (row, col)
-    auto coarse_coo = matrix::Coo<ValueType, IndexType>::create(
-        exec,
-        gko::dim<2>{static_cast<size_type>(num_agg),
-                    static_cast<size_type>(num_agg)},
-        coarse_nnz);
-    exec->run(pgm::make_compute_coarse_coo(
-        nnz, row_idxs.get_const_data(), col_idxs.get_const_data(),
-        vals.get_const_data(), coarse_coo.get()));
-    // use move_to
-    auto coarse_csr = matrix::Csr<ValueType, IndexType>::create(exec);
-    coarse_csr->move_from(coarse_coo);
+    auto coarse_csr = matrix::Csr<ValueType, IndexType>::create(
+        exec, gko::dim<2>{static_cast<size_type>(num_agg),
+                          static_cast<size_type>(num_agg)});
+    // the restriction operator lists the fine rows of each aggregate
+    exec->run(pgm::make_compute_coarse_csr(
+        fine_csr, agg.get_const_data(), restrict_sparsity->get_const_row_ptrs(),
+        restrict_sparsity->get_const_col_idxs(), coarse_csr.get()));
     return std::move(coarse_csr);
 }
 
 
-}  // namespace
-
-
+/**
+ * Computes the aggregates of the rows of pgm_op and returns their number.
+ */
 template <typename ValueType, typename IndexType>
-void Pgm<ValueType, IndexType>::generate()
+IndexType aggregate(
+    std::shared_ptr<const Executor> exec,
+    const matrix::Csr<ValueType, IndexType>* pgm_op,
+    const typename multigrid::Pgm<ValueType, IndexType>::parameters_type&
+        parameters,
+    array<IndexType>& agg)
 {
-    using csr_type = matrix::Csr<ValueType, IndexType>;
     using real_type = remove_complex<ValueType>;
-    using weight_csr_type = remove_complex<csr_type>;
-    auto exec = this->get_executor();
-    const auto num_rows = this->system_matrix_->get_size()[0];
-    array<IndexType> strongest_neighbor(this->get_executor(), num_rows);
-    array<IndexType> intermediate_agg(this->get_executor(),
-                                      parameters_.deterministic * num_rows);
-    // Only support csr matrix currently.
-    const csr_type* pgm_op =
-        dynamic_cast<const csr_type*>(system_matrix_.get());
-    std::shared_ptr<const csr_type> pgm_op_shared_ptr{};
-    // If system matrix is not csr or need sorting, generate the csr.
-    if (!parameters_.skip_sorting || !pgm_op) {
-        pgm_op_shared_ptr = convert_to_with_sorting<csr_type>(
-            exec, system_matrix_, parameters_.skip_sorting);
-        pgm_op = pgm_op_shared_ptr.get();
-        // keep the same precision data in fine_op
-        this->set_fine_op(pgm_op_shared_ptr);
-    }
+    using weight_csr_type = remove_complex<matrix::Csr<ValueType, IndexType>>;
+    const auto num_rows = pgm_op->get_size()[0];
+    array<IndexType> strongest_neighbor(exec, num_rows);
+    array<IndexType> intermediate_agg(exec,
+                                      parameters.deterministic * num_rows);
     // Initial agg = -1
-    exec->run(pgm::make_fill_array(agg_.get_data(), agg_.get_num_elems(),
+    exec->run(pgm::make_fill_array(agg.get_data(), agg.get_num_elems(),
                                    -one<IndexType>()));
     IndexType num_unagg = num_rows;
-    IndexType num_unagg_prev = num_rows;
+    IndexType num_unaggprev = num_rows;
     // TODO: if mtx is a hermitian matrix, weight_mtx = abs(mtx)
     // compute weight_mtx = (abs(mtx) + abs(mtx'))/2;
     auto abs_mtx = pgm_op->compute_absolute();
@@ -182,35 +153,435 @@ void Pgm<ValueType, IndexType>::generate()
     abs_mtx->apply(half_scalar, identity, half_scalar, weight_mtx);
     // Extract the diagonal value of matrix
     auto diag = weight_mtx->extract_diagonal();
-    for (int i = 0; i < parameters_.max_iterations; i++) {
+    for (int i = 0; i < parameters.max_iterations; i++) {
         // Find the strongest neighbor of each row
         exec->run(pgm::make_find_strongest_neighbor(
-            weight_mtx.get(), diag.get(), agg_, strongest_neighbor));
+            weight_mtx.get(), diag.get(), agg, strongest_neighbor));
         // Match edges
-        exec->run(pgm::make_match_edge(strongest_neighbor, agg_));
+        exec->run(pgm::make_match_edge(strongest_neighbor, agg));
         // Get the num_unagg
-        exec->run(pgm::make_count_unagg(agg_, &num_unagg));
+        exec->run(pgm::make_count_unagg(agg, &num_unagg));
         // no new match, all match, or the ratio of num_unagg/num is lower
         // than parameter.max_unassigned_ratio
-        if (num_unagg == 0 || num_unagg == num_unagg_prev ||
-            num_unagg < parameters_.max_unassigned_ratio * num_rows) {
+        if (num_unagg == 0 || num_unagg == num_unaggprev ||
+            num_unagg < parameters.max_unassigned_ratio * num_rows) {
             break;
         }
-        num_unagg_prev = num_unagg;
+        num_unaggprev = num_unagg;
     }
     // Handle the left unassign points
-    if (num_unagg != 0 && parameters_.deterministic) {
+    if (num_unagg != 0 && parameters.deterministic) {
         // copy the agg to intermediate_agg
-        intermediate_agg = agg_;
+        intermediate_agg = agg;
     }
     if (num_unagg != 0) {
         // Assign all left points
         exec->run(pgm::make_assign_to_exist_agg(weight_mtx.get(), diag.get(),
-                                                agg_, intermediate_agg));
+                                                agg, intermediate_agg));
     }
     IndexType num_agg = 0;
     // Renumber the index
-    exec->run(pgm::make_renumber(agg_, &num_agg));
+    exec->run(pgm::make_renumber(agg, &num_agg));
+    return num_agg;
+
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+using partition_type =
+    experimental::distributed::Partition<LocalIndexType, GlobalIndexType>;
+
+using experimental::distributed::comm_index_type;
+
+
+/**
+ * Calls fn with system_matrix cast to the distributed matrix type with the
+ * given value and local index type.
+ */
+template <typename ValueType, typename IndexType, typename GlobalIndexType,
+          typename Function>
+bool try_run_distributed(const LinOp* system_matrix, Function& fn,
+                         std::true_type)
+{
+    using matrix_type =
+        experimental::distributed::Matrix<ValueType, IndexType,
+                                          GlobalIndexType>;
+    if (auto fine = dynamic_cast<const matrix_type*>(system_matrix)) {
+        fn(fine);
+        return true;
+    }
+    return false;
+}
+
+
+// the global index type can not be smaller than the local index type
+template <typename ValueType, typename IndexType, typename GlobalIndexType,
+          typename Function>
+bool try_run_distributed(const LinOp*, Function&, std::false_type)
+{
+    return false;
+}
+
+
+template <typename ValueType, typename IndexType, typename Function>
+void run_distributed(const LinOp* system_matrix, Function fn)
+{
+    using is_valid_int32 =
+        std::integral_constant<bool, sizeof(IndexType) <= sizeof(int32)>;
+    if (!try_run_distributed<ValueType, IndexType, int32>(system_matrix, fn,
+                                                          is_valid_int32{}) &&
+        !try_run_distributed<ValueType, IndexType, int64>(system_matrix, fn,
+                                                          std::true_type{})) {
+        GKO_NOT_SUPPORTED(system_matrix);
+    }
+}
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+size_type find_range(
+    const partition_type<LocalIndexType, GlobalIndexType>* host_partition,
+    GlobalIndexType idx)
+{
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto it =
+        std::upper_bound(range_bounds + 1,
+                         range_bounds + host_partition->get_num_ranges() + 1,
+                         idx);
+    return static_cast<size_type>(std::distance(range_bounds + 1, it));
+}
+
+
+/**
+ * Returns the global indices owned by the given part, ordered by their local
+ * index.
+ */
+template <typename LocalIndexType, typename GlobalIndexType>
+std::vector<GlobalIndexType> get_owned_indices(
+    const partition_type<LocalIndexType, GlobalIndexType>* host_partition,
+    comm_index_type part)
+{
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    std::vector<GlobalIndexType> owned;
+    for (size_type range = 0; range < host_partition->get_num_ranges();
+         range++) {
+        if (part_ids[range] == part) {
+            for (auto idx = range_bounds[range]; idx < range_bounds[range + 1];
+                 idx++) {
+                owned.push_back(idx);
+            }
+        }
+    }
+    return owned;
+}
+
+
+/**
+ * Returns the global coarse index of each local row, where the aggregates are
+ * numbered consecutively by rank. agg_offsets is set to the global index of
+ * the first aggregate of each rank.
+ */
+template <typename IndexType, typename GlobalIndexType>
+std::vector<GlobalIndexType> compute_global_aggregates(
+    experimental::mpi::communicator comm,
+    std::shared_ptr<const Executor> host_exec, const array<IndexType>& agg,
+    std::vector<GlobalIndexType>& agg_offsets)
+{
+    const array<IndexType> host_agg{host_exec, agg};
+    const auto agg_data = host_agg.get_const_data();
+    const auto num_rows = host_agg.get_num_elems();
+    // the aggregates are numbered consecutively and are not empty
+    const GlobalIndexType num_agg =
+        num_rows == 0
+            ? 0
+            : static_cast<GlobalIndexType>(
+                  *std::max_element(agg_data, agg_data + num_rows) + 1);
+    std::vector<GlobalIndexType> num_aggs(comm.size());
+    comm.all_gather(host_exec, &num_agg, 1, num_aggs.data(), 1);
+    agg_offsets.assign(comm.size() + 1, 0);
+    std::partial_sum(num_aggs.begin(), num_aggs.end(), agg_offsets.begin() + 1);
+    std::vector<GlobalIndexType> global_agg(num_rows);
+    for (size_type row = 0; row < num_rows; row++) {
+        global_agg[row] = agg_offsets[comm.rank()] + agg_data[row];
+    }
+    return global_agg;
+}
+
+
+/**
+ * Builds the contiguous coarse partition. Each rank owns its own aggregates,
+ * unless the coarse matrix is agglomerated onto fewer ranks.
+ */
+template <typename LocalIndexType, typename GlobalIndexType>
+std::shared_ptr<partition_type<LocalIndexType, GlobalIndexType>>
+build_coarse_partition(std::shared_ptr<const Executor> exec,
+                       const std::vector<GlobalIndexType>& agg_offsets,
+                       size_type min_coarse_rows_per_rank)
+{
+    const auto num_ranks = static_cast<comm_index_type>(agg_offsets.size() - 1);
+    const auto num_coarse = static_cast<size_type>(agg_offsets.back());
+    auto num_targets = num_ranks;
+    if (min_coarse_rows_per_rank > 0 &&
+        num_coarse < min_coarse_rows_per_rank * num_ranks) {
+        num_targets = static_cast<comm_index_type>(std::max<size_type>(
+            num_coarse / min_coarse_rows_per_rank, 1));
+    }
+    // the aggregates of rank r are moved to rank r * num_targets / num_ranks,
+    // which keeps the coarse numbering contiguous
+    std::vector<GlobalIndexType> ranges(num_ranks + 1, agg_offsets.back());
+    for (comm_index_type rank = num_ranks - 1; rank >= 0; rank--) {
+        ranges[rank * num_targets / num_ranks] = agg_offsets[rank];
+    }
+    return share(partition_type<LocalIndexType, GlobalIndexType>::
+                     build_from_contiguous(
+                         exec, array<GlobalIndexType>{exec, ranges.begin(),
+                                                      ranges.end()}));
+}
+
+
+/**
+ * Returns the global coarse index of each non-local column of fine, which is
+ * owned by another rank.
+ */
+template <typename ValueType, typename IndexType, typename GlobalIndexType>
+std::vector<GlobalIndexType> fetch_non_local_aggregates(
+    const experimental::distributed::Matrix<ValueType, IndexType,
+                                            GlobalIndexType>* fine,
+    const partition_type<IndexType, GlobalIndexType>* host_partition,
+    const std::vector<GlobalIndexType>& global_agg)
+{
+    auto comm = fine->get_communicator();
+    auto host_exec = fine->get_executor()->get_master();
+    const auto num_ranks = comm.size();
+    const array<GlobalIndexType> non_local_to_global{
+        host_exec, fine->get_non_local_to_global()};
+    const auto num_non_local = non_local_to_global.get_num_elems();
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    const auto starting_idxs = host_partition->get_range_starting_indices();
+    // request the aggregates by the local index on their owner
+    std::vector<comm_index_type> owners(num_non_local);
+    std::vector<int> request_sizes(num_ranks);
+    std::vector<int> request_offsets(num_ranks + 1);
+    for (size_type i = 0; i < num_non_local; i++) {
+        const auto range = find_range(host_partition,
+                                      non_local_to_global.get_const_data()[i]);
+        owners[i] = part_ids[range];
+        request_sizes[owners[i]]++;
+    }
+    std::partial_sum(request_sizes.begin(), request_sizes.end(),
+                     request_offsets.begin() + 1);
+    std::vector<GlobalIndexType> requests(num_non_local);
+    std::vector<int> request_positions(num_non_local);
+    auto positions = request_offsets;
+    for (size_type i = 0; i < num_non_local; i++) {
+        const auto global = non_local_to_global.get_const_data()[i];
+        const auto range = find_range(host_partition, global);
+        request_positions[i] = positions[owners[i]]++;
+        requests[request_positions[i]] =
+            starting_idxs[range] + (global - range_bounds[range]);
+    }
+    std::vector<int> reply_sizes(num_ranks);
+    std::vector<int> reply_offsets(num_ranks + 1);
+    comm.all_to_all(host_exec, request_sizes.data(), 1, reply_sizes.data(),
+                    1);
+    std::partial_sum(reply_sizes.begin(), reply_sizes.end(),
+                     reply_offsets.begin() + 1);
+    std::vector<GlobalIndexType> received(reply_offsets.back());
+    comm.all_to_all_v(host_exec, requests.data(), request_sizes.data(),
+                      request_offsets.data(), received.data(),
+                      reply_sizes.data(), reply_offsets.data());
+    for (auto& value : received) {
+        value = global_agg[value];
+    }
+    std::vector<GlobalIndexType> replies(num_non_local);
+    comm.all_to_all_v(host_exec, received.data(), reply_sizes.data(),
+                      reply_offsets.data(), replies.data(),
+                      request_sizes.data(), request_offsets.data());
+    std::vector<GlobalIndexType> non_local_agg(num_non_local);
+    for (size_type i = 0; i < num_non_local; i++) {
+        non_local_agg[i] = replies[request_positions[i]];
+    }
+    return non_local_agg;
+}
+
+
+/**
+ * Computes the coarse matrix R * A * P, where each row of A contributes to the
+ * row of its aggregate.
+ */
+template <typename ValueType, typename IndexType, typename GlobalIndexType>
+std::shared_ptr<
+    experimental::distributed::Matrix<ValueType, IndexType, GlobalIndexType>>
+generate_distributed_coarse(
+    const experimental::distributed::Matrix<ValueType, IndexType,
+                                            GlobalIndexType>* fine,
+    const std::vector<GlobalIndexType>& global_agg,
+    std::shared_ptr<const partition_type<IndexType, GlobalIndexType>>
+        coarse_partition)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using matrix_type =
+        experimental::distributed::Matrix<ValueType, IndexType,
+                                          GlobalIndexType>;
+    auto exec = fine->get_executor();
+    auto host_exec = exec->get_master();
+    auto comm = fine->get_communicator();
+    auto host_partition =
+        make_temporary_clone(host_exec, fine->get_row_partition());
+    const auto non_local_agg =
+        fetch_non_local_aggregates(fine, host_partition.get(), global_agg);
+    auto local = csr_type::create(host_exec);
+    auto non_local = csr_type::create(host_exec);
+    as<ConvertibleTo<csr_type>>(fine->get_local_matrix())->convert_to(local);
+    as<ConvertibleTo<csr_type>>(fine->get_non_local_matrix())
+        ->convert_to(non_local);
+    const auto num_coarse =
+        static_cast<size_type>(coarse_partition->get_size());
+    matrix_data<ValueType, GlobalIndexType> data{
+        dim<2>{num_coarse, num_coarse}};
+    for (size_type row = 0; row < local->get_size()[0]; row++) {
+        for (auto nz = local->get_const_row_ptrs()[row];
+             nz < local->get_const_row_ptrs()[row + 1]; nz++) {
+            data.nonzeros.emplace_back(
+                global_agg[row], global_agg[local->get_const_col_idxs()[nz]],
+                local->get_const_values()[nz]);
+        }
+        for (auto nz = non_local->get_const_row_ptrs()[row];
+             nz < non_local->get_const_row_ptrs()[row + 1]; nz++) {
+            data.nonzeros.emplace_back(
+                global_agg[row],
+                non_local_agg[non_local->get_const_col_idxs()[nz]],
+                non_local->get_const_values()[nz]);
+        }
+    }
+    // each coarse row is only assembled on a single rank, so summing the
+    // duplicates locally reduces the exchanged volume considerably
+    data.sum_duplicates();
+    auto coarse = matrix_type::create(exec, comm);
+    coarse->read_distributed(
+        data, coarse_partition,
+        experimental::distributed::assembly_mode::communicate);
+    return share(std::move(coarse));
+}
+
+
+/**
+ * Generates the prolongation, coarse and restriction operator of a distributed
+ * Pgm level.
+ */
+template <typename ValueType, typename IndexType, typename GlobalIndexType>
+std::tuple<std::shared_ptr<const LinOp>, std::shared_ptr<const LinOp>,
+           std::shared_ptr<const LinOp>>
+generate_distributed_level(
+    const experimental::distributed::Matrix<ValueType, IndexType,
+                                            GlobalIndexType>* fine,
+    const typename multigrid::Pgm<ValueType, IndexType>::parameters_type&
+        parameters,
+    array<IndexType>& agg)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using matrix_type =
+        experimental::distributed::Matrix<ValueType, IndexType,
+                                          GlobalIndexType>;
+    auto exec = fine->get_executor();
+    auto host_exec = exec->get_master();
+    auto comm = fine->get_communicator();
+    auto row_partition = fine->get_row_partition();
+    auto host_partition = make_temporary_clone(host_exec, row_partition);
+    auto host_col_partition =
+        make_temporary_clone(host_exec, fine->get_col_partition());
+    // the aggregates of the non-local columns are looked up by their row
+    const auto num_ranges = host_partition->get_num_ranges();
+    if (num_ranges != host_col_partition->get_num_ranges() ||
+        !std::equal(host_partition->get_range_bounds(),
+                    host_partition->get_range_bounds() + num_ranges + 1,
+                    host_col_partition->get_range_bounds()) ||
+        !std::equal(host_partition->get_part_ids(),
+                    host_partition->get_part_ids() + num_ranges,
+                    host_col_partition->get_part_ids())) {
+        GKO_NOT_SUPPORTED(fine);
+    }
+    auto local = convert_to_with_sorting<csr_type>(
+        exec, fine->get_local_matrix(), parameters.skip_sorting);
+    agg.resize_and_reset(local->get_size()[0]);
+    aggregate(exec, local.get(), parameters, agg);
+
+    std::vector<GlobalIndexType> agg_offsets;
+    const auto global_agg =
+        compute_global_aggregates(comm, host_exec, agg, agg_offsets);
+    auto coarse_partition = build_coarse_partition<IndexType>(
+        exec, agg_offsets, parameters.min_coarse_rows_per_rank);
+    const auto num_coarse =
+        static_cast<size_type>(coarse_partition->get_size());
+    const auto num_fine = fine->get_size()[0];
+    const auto owned_rows =
+        get_owned_indices(host_partition.get(), comm.rank());
+    matrix_data<ValueType, GlobalIndexType> prolong_data{
+        dim<2>{num_fine, num_coarse}};
+    matrix_data<ValueType, GlobalIndexType> restrict_data{
+        dim<2>{num_coarse, num_fine}};
+    for (size_type row = 0; row < owned_rows.size(); row++) {
+        prolong_data.nonzeros.emplace_back(owned_rows[row], global_agg[row],
+                                           one<ValueType>());
+        restrict_data.nonzeros.emplace_back(global_agg[row], owned_rows[row],
+                                            one<ValueType>());
+    }
+    auto prolong = matrix_type::create(exec, comm);
+    prolong->read_distributed(prolong_data, row_partition, coarse_partition);
+    auto restrict_op = matrix_type::create(exec, comm);
+    restrict_op->read_distributed(
+        restrict_data, coarse_partition, row_partition,
+        experimental::distributed::assembly_mode::communicate);
+    auto coarse = generate_distributed_coarse(
+        fine, global_agg,
+        std::shared_ptr<const partition_type<IndexType, GlobalIndexType>>(
+            std::move(coarse_partition)));
+    return std::make_tuple(share(std::move(prolong)), coarse,
+                           share(std::move(restrict_op)));
+}
+
+
+#endif  // GINKGO_BUILD_MPI
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::generate()
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    auto exec = this->get_executor();
+#if GINKGO_BUILD_MPI
+    if (gko::detail::is_distributed(system_matrix_.get())) {
+        run_distributed<ValueType, IndexType>(
+            system_matrix_.get(), [this](auto fine) {
+                const auto level =
+                    generate_distributed_level(fine, parameters_, agg_);
+                this->set_multigrid_level(std::get<0>(level),
+                                          std::get<1>(level),
+                                          std::get<2>(level));
+            });
+        return;
+    }
+#endif
+    // Only support csr matrix currently.
+    const csr_type* pgm_op =
+        dynamic_cast<const csr_type*>(system_matrix_.get());
+    std::shared_ptr<const csr_type> pgm_op_shared_ptr{};
+    // If system matrix is not csr or need sorting, generate the csr.
+    if (!parameters_.skip_sorting || !pgm_op) {
+        pgm_op_shared_ptr = convert_to_with_sorting<csr_type>(
+            exec, system_matrix_, parameters_.skip_sorting);
+        pgm_op = pgm_op_shared_ptr.get();
+        // keep the same precision data in fine_op
+        this->set_fine_op(pgm_op_shared_ptr);
+    }
+    auto num_agg = aggregate(exec, pgm_op, parameters_, agg_);
 
     gko::dim<2>::dimension_type coarse_dim = num_agg;
     auto fine_dim = system_matrix_->get_size()[0];
@@ -226,14 +597,61 @@ void Pgm<ValueType, IndexType>::generate()
                     restrict_sparsity->get_col_idxs());
 
     // Construct the coarse matrix
-    // TODO: improve it
-    auto coarse_matrix = generate_coarse(exec, pgm_op, num_agg, agg_);
+    auto coarse_matrix = generate_coarse(exec, pgm_op, num_agg, agg_,
+                                         restrict_sparsity.get());
 
     this->set_multigrid_level(prolong_row_gather, coarse_matrix,
                               restrict_sparsity);
 }
 
 
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> fine_op)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using sparsity_type = matrix::SparsityCsr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(system_matrix_, fine_op);
+    auto exec = this->get_executor();
+    system_matrix_ = fine_op;
+#if GINKGO_BUILD_MPI
+    if (gko::detail::is_distributed(fine_op.get())) {
+        run_distributed<ValueType, IndexType>(
+            fine_op.get(), [this, &exec](auto fine) {
+                using matrix_type = std::decay_t<decltype(*fine)>;
+                // the aggregates and the coarse partition are unchanged
+                std::vector<typename matrix_type::global_index_type>
+                    agg_offsets;
+                const auto global_agg = compute_global_aggregates(
+                    fine->get_communicator(), exec->get_master(), agg_,
+                    agg_offsets);
+                auto coarse_matrix = generate_distributed_coarse(
+                    fine, global_agg,
+                    as<matrix_type>(this->get_coarse_op())
+                        ->get_row_partition());
+                this->set_fine_op(system_matrix_);
+                this->set_multigrid_level(this->get_prolong_op(),
+                                          coarse_matrix,
+                                          this->get_restrict_op());
+            });
+        return;
+    }
+#endif
+    auto pgm_op = convert_to_with_sorting<csr_type>(exec, system_matrix_,
+                                                    parameters_.skip_sorting);
+    this->set_fine_op(pgm_op);
+    // the aggregates and thus the transfer operators are unchanged
+    auto restrict_sparsity = as<sparsity_type>(this->get_restrict_op());
+    auto coarse_matrix = generate_coarse(
+        exec, pgm_op.get(),
+        static_cast<IndexType>(restrict_sparsity->get_size()[0]), agg_,
+        restrict_sparsity.get());
+
+    this->set_multigrid_level(this->get_prolong_op(), coarse_matrix,
+                              restrict_sparsity);
+}
+
+
 #define GKO_DECLARE_PGM(_vtype, _itype) class Pgm<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM);
 
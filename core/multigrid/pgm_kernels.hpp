@@ -113,6 +113,14 @@ namespace pgm {
                             const IndexType* col_idxs, const ValueType* vals, \
                             matrix::Coo<ValueType, IndexType>* coarse_coo)
 
+#define GKO_DECLARE_PGM_COMPUTE_COARSE_CSR(ValueType, IndexType) \
+    void compute_coarse_csr(                                     \
+        std::shared_ptr<const DefaultExecutor> exec,             \
+        const matrix::Csr<ValueType, IndexType>* fine_csr,       \
+        const IndexType* agg, const IndexType* agg_ptrs,         \
+        const IndexType* agg_rows,                               \
+        matrix::Csr<ValueType, IndexType>* coarse_csr)
+
 
 #define GKO_DECLARE_ALL_AS_TEMPLATES                               \
     template <typename IndexType>                                  \
@@ -136,7 +144,9 @@ namespace pgm {
     template <typename ValueType, typename IndexType>              \
     GKO_DECLARE_PGM_SORT_ROW_MAJOR(ValueType, IndexType);          \
     template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType)
+    GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType);      \
+    template <typename ValueType, typename IndexType>              \
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR(ValueType, IndexType)
 
 
 }  // namespace pgm
@@ -0,0 +1,99 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_MULTIGRID_SMOOTHED_AGGREGATION_KERNELS_HPP_
+#define GKO_CORE_MULTIGRID_SMOOTHED_AGGREGATION_KERNELS_HPP_
+
+
+#include <ginkgo/core/multigrid/smoothed_aggregation.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace smoothed_aggregation {
+
+
+#define GKO_DECLARE_SMOOTHED_AGGREGATION_FILTER_MATRIX(ValueType, IndexType) \
+    void filter_matrix(std::shared_ptr<const DefaultExecutor> exec,          \
+                       const matrix::Csr<ValueType, IndexType>* mtx,         \
+                       remove_complex<ValueType> threshold,                  \
+                       matrix::Csr<ValueType, IndexType>* filtered)
+
+#define GKO_DECLARE_SMOOTHED_AGGREGATION_AGGREGATE(ValueType, IndexType) \
+    void aggregate(std::shared_ptr<const DefaultExecutor> exec,          \
+                   const matrix::Csr<ValueType, IndexType>* filtered,    \
+                   array<IndexType>& agg, IndexType* num_agg)
+
+#define GKO_DECLARE_SMOOTHED_AGGREGATION_COMPUTE_PROLONGATOR(ValueType, \
+                                                             IndexType) \
+    void compute_prolongator(                                           \
+        std::shared_ptr<const DefaultExecutor> exec,                    \
+        const matrix::Csr<ValueType, IndexType>* filtered,              \
+        const array<IndexType>& agg, remove_complex<ValueType> damping, \
+        matrix::Csr<ValueType, IndexType>* prolongator)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                      \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_SMOOTHED_AGGREGATION_FILTER_MATRIX(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_SMOOTHED_AGGREGATION_AGGREGATE(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_SMOOTHED_AGGREGATION_COMPUTE_PROLONGATOR(ValueType, IndexType)
+
+
+}  // namespace smoothed_aggregation
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(smoothed_aggregation,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_SMOOTHED_AGGREGATION_KERNELS_HPP_
@@ -0,0 +1,116 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/fsai.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/utils.hpp"
+#include "core/preconditioner/fsai_kernels.hpp"
+
+
+namespace gko {
+namespace preconditioner {
+namespace fsai {
+namespace {
+
+
+GKO_REGISTER_OPERATION(generate, fsai::generate);
+
+
+}  // anonymous namespace
+}  // namespace fsai
+
+
+template <typename ValueType, typename IndexType>
+void Fsai<ValueType, IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+    const auto exec = this->get_executor();
+    auto csr_matrix = convert_to_with_sorting<const matrix_type>(
+        exec, system_matrix, parameters_.skip_sorting);
+    auto lower_factor =
+        share(matrix_type::create(exec, csr_matrix->get_size()));
+    exec->run(fsai::make_generate(csr_matrix.get(), parameters_.steps,
+                                  parameters_.step_size, parameters_.tolerance,
+                                  lower_factor.get()));
+    upper_factor_ = as<matrix_type>(share(lower_factor->conj_transpose()));
+    lower_factor_ = std::move(lower_factor);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Fsai<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            using Vector = std::decay_t<decltype(*dense_x)>;
+            auto tmp = Vector::create_with_config_of(dense_x);
+            lower_factor_->apply(dense_b, tmp);
+            upper_factor_->apply(tmp, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Fsai<ValueType, IndexType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                            const LinOp* beta, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            using Vector = std::decay_t<decltype(*dense_x)>;
+            auto tmp = Vector::create_with_config_of(dense_x);
+            lower_factor_->apply(dense_b, tmp);
+            upper_factor_->apply(dense_alpha, tmp, dense_beta, dense_x);
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_FSAI(ValueType, IndexType) class Fsai<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FSAI);
+
+
+}  // namespace preconditioner
+}  // namespace gko
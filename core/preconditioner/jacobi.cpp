@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
 
 
 #include "core/base/extended_float.hpp"
@@ -334,7 +335,25 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp* system_matrix,
         auto csr_mtx = convert_to_with_sorting<csr_type>(exec, system_matrix,
                                                          skip_sorting);
         if (parameters_.block_pointers.get_data() == nullptr) {
-            this->detect_blocks(csr_mtx.get());
+            auto fbcsr_mtx =
+                dynamic_cast<const matrix::Fbcsr<ValueType, IndexType>*>(
+                    system_matrix);
+            if (fbcsr_mtx && fbcsr_mtx->get_block_size() <=
+                                 static_cast<int>(parameters_.max_block_size)) {
+                // use the natural blocking of the variables
+                const auto block_size = fbcsr_mtx->get_block_size();
+                num_blocks_ = fbcsr_mtx->get_num_block_rows();
+                array<IndexType> block_ptrs{exec->get_master(),
+                                            num_blocks_ + 1};
+                for (size_type block = 0; block <= num_blocks_; ++block) {
+                    block_ptrs.get_data()[block] = block * block_size;
+                }
+                parameters_.block_pointers = block_ptrs;
+                blocks_.resize_and_reset(
+                    storage_scheme_.compute_storage_space(num_blocks_));
+            } else {
+                this->detect_blocks(csr_mtx.get());
+            }
         }
         const auto all_block_opt =
             parameters_.storage_optimization.of_all_blocks;
@@ -0,0 +1,154 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/preconditioner/sor.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+#include "core/base/utils.hpp"
+#include "core/factorization/factorization_kernels.hpp"
+#include "core/preconditioner/sor_kernels.hpp"
+
+
+namespace gko {
+namespace preconditioner {
+namespace sor {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l,
+                       factorization::initialize_row_ptrs_l);
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
+                       factorization::initialize_row_ptrs_l_u);
+GKO_REGISTER_OPERATION(initialize_weighted_l, sor::initialize_weighted_l);
+GKO_REGISTER_OPERATION(initialize_weighted_l_u, sor::initialize_weighted_l_u);
+
+
+}  // anonymous namespace
+}  // namespace sor
+
+
+template <typename ValueType, typename IndexType>
+Sor<ValueType, IndexType>::Sor(std::shared_ptr<const Executor> exec,
+                               const parameters_type& params)
+    : EnablePolymorphicObject<Sor, LinOpFactory>(std::move(exec)),
+      parameters_(params)
+{}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>> Sor<ValueType, IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    auto product =
+        std::unique_ptr<composition_type>(static_cast<composition_type*>(
+            this->LinOpFactory::generate(std::move(system_matrix)).release()));
+    return product;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> Sor<ValueType, IndexType>::generate_impl(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+    const auto exec = this->get_executor();
+    const auto size = system_matrix->get_size();
+    const auto num_rows = size[0];
+    auto csr_matrix = convert_to_with_sorting<const matrix_type>(
+        exec, system_matrix, parameters_.skip_sorting);
+
+    // the factors are sorted by construction and always contain the diagonal
+    std::shared_ptr<const LinOpFactory> l_solver_factory =
+        parameters_.l_solver;
+    if (!l_solver_factory) {
+        l_solver_factory =
+            solver::LowerTrs<ValueType, IndexType>::build().on(exec);
+    }
+    array<IndexType> l_row_ptrs{exec, num_rows + 1};
+    if (parameters_.symmetric) {
+        std::shared_ptr<const LinOpFactory> u_solver_factory =
+            parameters_.u_solver;
+        if (!u_solver_factory) {
+            u_solver_factory =
+                solver::UpperTrs<ValueType, IndexType>::build().on(exec);
+        }
+        array<IndexType> u_row_ptrs{exec, num_rows + 1};
+        exec->run(sor::make_initialize_row_ptrs_l_u(
+            csr_matrix.get(), l_row_ptrs.get_data(), u_row_ptrs.get_data()));
+        const auto l_nnz = static_cast<size_type>(
+            exec->copy_val_to_host(l_row_ptrs.get_const_data() + num_rows));
+        const auto u_nnz = static_cast<size_type>(
+            exec->copy_val_to_host(u_row_ptrs.get_const_data() + num_rows));
+        auto l_mtx =
+            share(matrix_type::create(exec, size, array<ValueType>{exec, l_nnz},
+                                      array<IndexType>{exec, l_nnz},
+                                      std::move(l_row_ptrs)));
+        auto u_mtx =
+            share(matrix_type::create(exec, size, array<ValueType>{exec, u_nnz},
+                                      array<IndexType>{exec, u_nnz},
+                                      std::move(u_row_ptrs)));
+        exec->run(sor::make_initialize_weighted_l_u(
+            csr_matrix.get(), parameters_.relaxation_factor, l_mtx.get(),
+            u_mtx.get()));
+        // the composition applies its operators from right to left, so the
+        // forward sweep needs to be the last operator
+        return composition_type::create(u_solver_factory->generate(u_mtx),
+                                        l_solver_factory->generate(l_mtx));
+    } else {
+        exec->run(sor::make_initialize_row_ptrs_l(csr_matrix.get(),
+                                                  l_row_ptrs.get_data()));
+        const auto l_nnz = static_cast<size_type>(
+            exec->copy_val_to_host(l_row_ptrs.get_const_data() + num_rows));
+        auto l_mtx =
+            share(matrix_type::create(exec, size, array<ValueType>{exec, l_nnz},
+                                      array<IndexType>{exec, l_nnz},
+                                      std::move(l_row_ptrs)));
+        exec->run(sor::make_initialize_weighted_l(
+            csr_matrix.get(), parameters_.relaxation_factor, l_mtx.get()));
+        return composition_type::create(l_solver_factory->generate(l_mtx));
+    }
+}
+
+
+#define GKO_DECLARE_SOR(ValueType, IndexType) class Sor<ValueType, IndexType>
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR);
+
+
+}  // namespace preconditioner
+}  // namespace gko
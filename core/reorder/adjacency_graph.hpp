@@ -0,0 +1,103 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_REORDER_ADJACENCY_GRAPH_HPP_
+#define GKO_CORE_REORDER_ADJACENCY_GRAPH_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/sparsity_csr.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace detail {
+
+
+/**
+ * Computes the adjacency matrix (i.e. the pattern without diagonal entries)
+ * of the undirected graph of a square matrix on the host.
+ *
+ * @param host_exec  the executor to store the adjacency matrix on
+ * @param system_matrix  the input matrix, it needs to be convertible to Csr
+ * @param symmetric_sparsity  if true, the sparsity pattern of the input is
+ *                            assumed to be symmetric. Otherwise, the pattern
+ *                            of A + A^T is used.
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::SparsityCsr<ValueType, IndexType>>
+compute_adjacency_graph(std::shared_ptr<const Executor> host_exec,
+                        std::shared_ptr<const LinOp> system_matrix,
+                        bool symmetric_sparsity)
+{
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+    using sparsity_type = matrix::SparsityCsr<ValueType, IndexType>;
+    // most matrix formats are convertible to Csr, but not to SparsityCsr, so we
+    // take the detour through Csr
+    const auto csr_mtx =
+        copy_and_convert_to<matrix_type>(host_exec, system_matrix);
+    if (symmetric_sparsity) {
+        return copy_and_convert_to<sparsity_type>(host_exec, csr_mtx)
+            ->to_adjacency_matrix();
+    }
+    matrix_data<ValueType, IndexType> data;
+    csr_mtx->write(data);
+    const auto nnz = data.nonzeros.size();
+    for (size_type i = 0; i < nnz; i++) {
+        // only the pattern matters, this avoids cancellation
+        data.nonzeros[i].value = one<ValueType>();
+        const auto entry = data.nonzeros[i];
+        data.nonzeros.emplace_back(entry.column, entry.row, entry.value);
+    }
+    data.sum_duplicates();
+    auto symmetric_mtx = sparsity_type::create(host_exec);
+    symmetric_mtx->read(data);
+    return symmetric_mtx->to_adjacency_matrix();
+}
+
+
+}  // namespace detail
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_ADJACENCY_GRAPH_HPP_
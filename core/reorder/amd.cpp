@@ -0,0 +1,109 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/amd.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/reorder/adjacency_graph.hpp"
+#include "core/reorder/amd_ordering.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace {
+
+
+GKO_REGISTER_HOST_OPERATION(amd_order, detail::amd_order);
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+Amd<ValueType, IndexType>::Amd(std::shared_ptr<const Executor> exec,
+                               const parameters_type& params)
+    : EnablePolymorphicObject<Amd, LinOpFactory>(std::move(exec)),
+      parameters_(params)
+{}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Permutation<IndexType>>
+Amd<ValueType, IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    auto product =
+        std::unique_ptr<permutation_type>(static_cast<permutation_type*>(
+            this->LinOpFactory::generate(std::move(system_matrix)).release()));
+    return product;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> Amd<ValueType, IndexType>::generate_impl(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+    const auto exec = this->get_executor();
+    const auto host_exec = exec->get_master();
+    const auto num_rows = system_matrix->get_size()[0];
+    const auto adjacency_mtx =
+        detail::compute_adjacency_graph<ValueType, IndexType>(
+            host_exec, std::move(system_matrix),
+            parameters_.symmetric_sparsity);
+    array<IndexType> permutation{host_exec, num_rows};
+    exec->run(make_amd_order(host_exec, static_cast<IndexType>(num_rows),
+                             adjacency_mtx->get_const_row_ptrs(),
+                             adjacency_mtx->get_const_col_idxs(),
+                             parameters_.dense_threshold,
+                             permutation.get_data()));
+    permutation.set_executor(exec);
+    return permutation_type::create(exec, dim<2>{num_rows, num_rows},
+                                    std::move(permutation));
+}
+
+
+#define GKO_DECLARE_AMD(ValueType, IndexType) class Amd<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_AMD);
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
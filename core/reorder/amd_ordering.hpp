@@ -0,0 +1,392 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_REORDER_AMD_ORDERING_HPP_
+#define GKO_CORE_REORDER_AMD_ORDERING_HPP_
+
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace detail {
+
+
+enum class node_status : unsigned char {
+    /** an uneliminated (super)variable */
+    variable,
+    /** an eliminated variable that represents its uneliminated neighbors */
+    element,
+    /** an element that was absorbed into another element */
+    absorbed,
+    /** a variable that was merged into another supervariable */
+    merged,
+    /** a dense row, which is ordered last */
+    dense
+};
+
+
+/**
+ * Computes an approximate minimum degree ordering of the graph described by
+ * the symmetric adjacency matrix (without diagonal entries) given by row_ptrs
+ * and col_idxs.
+ *
+ * The node lists of the quotient graph are stored in-place in a copy of the
+ * adjacency lists: Eliminating a pivot can only shrink the lists of its
+ * neighbors, since they either referenced the pivot itself or one of the
+ * elements absorbed into it. The variable lists of the elements are stored
+ * contiguously in the order of their creation and compacted when too many of
+ * them belong to absorbed elements.
+ */
+template <typename IndexType>
+void amd_order(std::shared_ptr<const Executor> host_exec, IndexType num_rows,
+               const IndexType* row_ptrs, const IndexType* col_idxs,
+               double dense_threshold, IndexType* permutation)
+{
+    const auto n = num_rows;
+    if (n == 0) {
+        return;
+    }
+    // node lists: elements first, followed by variables
+    vector<IndexType> lists(col_idxs, col_idxs + row_ptrs[n], {host_exec});
+    vector<IndexType> list_begin(row_ptrs, row_ptrs + n, {host_exec});
+    vector<IndexType> list_length(n, 0, {host_exec});
+    vector<IndexType> num_elements(n, 0, {host_exec});
+    // variable lists of the elements
+    vector<IndexType> element_lists(host_exec);
+    vector<IndexType> element_begin(n, 0, {host_exec});
+    vector<IndexType> element_length(n, 0, {host_exec});
+    vector<IndexType> element_weight(n, 0, {host_exec});
+    vector<IndexType> elements(host_exec);
+    size_type live_element_entries{};
+    vector<node_status> status(n, node_status::variable, {host_exec});
+    // supervariables and their members in elimination order
+    vector<IndexType> weight(n, 1, {host_exec});
+    vector<IndexType> next_member(n, -1, {host_exec});
+    vector<IndexType> last_member(n, {host_exec});
+    std::iota(last_member.begin(), last_member.end(), IndexType{});
+    // doubly-linked lists of variables with the same approximate degree
+    vector<IndexType> degree(n, 0, {host_exec});
+    vector<IndexType> bucket_head(n, -1, {host_exec});
+    vector<IndexType> bucket_next(n, -1, {host_exec});
+    vector<IndexType> bucket_prev(n, -1, {host_exec});
+    const auto insert_bucket = [&](IndexType var) {
+        const auto head = bucket_head[degree[var]];
+        bucket_prev[var] = -1;
+        bucket_next[var] = head;
+        if (head >= 0) {
+            bucket_prev[head] = var;
+        }
+        bucket_head[degree[var]] = var;
+    };
+    const auto remove_bucket = [&](IndexType var) {
+        const auto prev = bucket_prev[var];
+        const auto next = bucket_next[var];
+        if (prev >= 0) {
+            bucket_next[prev] = next;
+        } else {
+            bucket_head[degree[var]] = next;
+        }
+        if (next >= 0) {
+            bucket_prev[next] = prev;
+        }
+    };
+    // workspace
+    vector<IndexType> mark(n, -1, {host_exec});
+    vector<IndexType> external(n, -1, {host_exec});
+    vector<IndexType> hash(n, 0, {host_exec});
+    vector<IndexType> touched(host_exec);
+    vector<IndexType> pivot_vars(host_exec);
+
+    // remove dense rows from the graph
+    const auto dense_limit =
+        dense_threshold > 0.0
+            ? std::max(16.0,
+                       dense_threshold * std::sqrt(static_cast<double>(n)))
+            : static_cast<double>(n);
+    IndexType num_dense{};
+    for (IndexType row = 0; row < n; row++) {
+        if (row_ptrs[row + 1] - row_ptrs[row] > dense_limit) {
+            status[row] = node_status::dense;
+            num_dense++;
+        }
+    }
+    for (IndexType row = 0; row < n; row++) {
+        const auto begin = list_begin[row];
+        IndexType length{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (status[col_idxs[nz]] != node_status::dense) {
+                lists[begin + length++] = col_idxs[nz];
+            }
+        }
+        list_length[row] = length;
+        degree[row] = length;
+        if (status[row] == node_status::variable) {
+            insert_bucket(row);
+        }
+    }
+
+    IndexType num_ordered{};
+    IndexType remaining = n - num_dense;
+    IndexType min_degree{};
+    while (remaining > 0) {
+        while (bucket_head[min_degree] < 0) {
+            min_degree++;
+        }
+        const auto pivot = bucket_head[min_degree];
+        remove_bucket(pivot);
+        // the pivot becomes an element containing all of its neighbor
+        // variables and the variables of the elements it absorbs
+        const auto lp_begin = static_cast<IndexType>(element_lists.size());
+        IndexType lp_weight{};
+        mark[pivot] = pivot;
+        const auto add_to_pivot = [&](IndexType var) {
+            if (status[var] == node_status::variable && mark[var] != pivot) {
+                mark[var] = pivot;
+                element_lists.push_back(var);
+                lp_weight += weight[var];
+            }
+        };
+        const auto pivot_begin = list_begin[pivot];
+        const auto pivot_vars_begin = pivot_begin + num_elements[pivot];
+        for (auto idx = pivot_begin; idx < pivot_vars_begin; idx++) {
+            const auto elem = lists[idx];
+            if (status[elem] == node_status::element) {
+                const auto elem_begin = element_begin[elem];
+                for (auto i = elem_begin; i < elem_begin + element_length[elem];
+                     i++) {
+                    add_to_pivot(element_lists[i]);
+                }
+                status[elem] = node_status::absorbed;
+                live_element_entries -= element_length[elem];
+            }
+        }
+        for (auto idx = pivot_vars_begin;
+             idx < pivot_begin + list_length[pivot]; idx++) {
+            add_to_pivot(lists[idx]);
+        }
+        const auto lp_end = static_cast<IndexType>(element_lists.size());
+        status[pivot] = node_status::element;
+        num_elements[pivot] = 0;
+        list_length[pivot] = 0;
+        element_begin[pivot] = lp_begin;
+        element_length[pivot] = lp_end - lp_begin;
+        element_weight[pivot] = lp_weight;
+        elements.push_back(pivot);
+        live_element_entries += lp_end - lp_begin;
+        for (auto member = pivot; member >= 0; member = next_member[member]) {
+            permutation[num_ordered++] = member;
+        }
+        remaining -= weight[pivot];
+
+        // compute |Le \ Lp| for all elements e adjacent to Lp
+        for (auto idx = lp_begin; idx < lp_end; idx++) {
+            const auto var = element_lists[idx];
+            remove_bucket(var);
+            const auto begin = list_begin[var];
+            for (auto i = begin; i < begin + num_elements[var]; i++) {
+                const auto elem = lists[i];
+                if (status[elem] == node_status::element) {
+                    if (external[elem] < 0) {
+                        external[elem] = element_weight[elem];
+                        touched.push_back(elem);
+                    }
+                    external[elem] -= weight[var];
+                }
+            }
+        }
+        // prune the lists of all variables in Lp and update their degrees
+        for (auto idx = lp_begin; idx < lp_end; idx++) {
+            const auto var = element_lists[idx];
+            const auto begin = list_begin[var];
+            const auto old_num_elements = num_elements[var];
+            const auto old_length = list_length[var];
+            IndexType new_num_elements{};
+            IndexType external_weight{};
+            IndexType var_hash{};
+            for (auto i = begin; i < begin + old_num_elements; i++) {
+                const auto elem = lists[i];
+                if (status[elem] != node_status::element) {
+                    continue;
+                }
+                if (external[elem] == 0) {
+                    // aggressive absorption: Le is a subset of Lp
+                    status[elem] = node_status::absorbed;
+                    live_element_entries -= element_length[elem];
+                    continue;
+                }
+                external_weight += external[elem];
+                var_hash += elem;
+                lists[begin + new_num_elements++] = elem;
+            }
+            const auto vars_begin = begin + old_num_elements;
+            IndexType new_num_vars{};
+            IndexType adjacent_weight{};
+            for (auto i = vars_begin; i < begin + old_length; i++) {
+                const auto neighbor = lists[i];
+                // variables in Lp are now represented by the pivot element
+                if (status[neighbor] != node_status::variable ||
+                    mark[neighbor] == pivot) {
+                    continue;
+                }
+                adjacent_weight += weight[neighbor];
+                var_hash += neighbor;
+                lists[vars_begin + new_num_vars++] = neighbor;
+            }
+            // insert the pivot between the elements and variables. The
+            // variable was either adjacent to the pivot or to an element
+            // absorbed into it, so the list has space for it.
+            const auto lists_it = lists.begin();
+            if (new_num_elements < old_num_elements) {
+                std::copy(lists_it + vars_begin,
+                          lists_it + vars_begin + new_num_vars,
+                          lists_it + begin + new_num_elements + 1);
+            } else {
+                std::copy_backward(lists_it + vars_begin,
+                                   lists_it + vars_begin + new_num_vars,
+                                   lists_it + vars_begin + new_num_vars + 1);
+            }
+            lists[begin + new_num_elements] = pivot;
+            num_elements[var] = new_num_elements + 1;
+            list_length[var] = new_num_elements + 1 + new_num_vars;
+            hash[var] = (var_hash + pivot) % n;
+            const auto lp_external = lp_weight - weight[var];
+            degree[var] = std::min(
+                {adjacent_weight + lp_external + external_weight,
+                 degree[var] + lp_external, remaining - weight[var]});
+        }
+        for (auto elem : touched) {
+            external[elem] = -1;
+        }
+        touched.clear();
+
+        // detect indistinguishable variables in Lp and merge them
+        pivot_vars.assign(element_lists.begin() + lp_begin,
+                          element_lists.begin() + lp_end);
+        std::sort(pivot_vars.begin(), pivot_vars.end(),
+                  [&](IndexType a, IndexType b) {
+                      return std::tie(hash[a], a) < std::tie(hash[b], b);
+                  });
+        for (auto var : pivot_vars) {
+            const auto begin = lists.begin() + list_begin[var];
+            std::sort(begin, begin + num_elements[var]);
+            std::sort(begin + num_elements[var], begin + list_length[var]);
+        }
+        const auto num_pivot_vars = static_cast<IndexType>(pivot_vars.size());
+        for (IndexType i = 0; i < num_pivot_vars; i++) {
+            const auto var = pivot_vars[i];
+            if (status[var] != node_status::variable) {
+                continue;
+            }
+            const auto var_begin = lists.begin() + list_begin[var];
+            for (auto j = i + 1;
+                 j < num_pivot_vars && hash[pivot_vars[j]] == hash[var]; j++) {
+                const auto other = pivot_vars[j];
+                if (status[other] != node_status::variable ||
+                    num_elements[other] != num_elements[var] ||
+                    list_length[other] != list_length[var]) {
+                    continue;
+                }
+                const auto other_begin = lists.begin() + list_begin[other];
+                if (std::equal(var_begin, var_begin + list_length[var],
+                               other_begin)) {
+                    weight[var] += weight[other];
+                    degree[var] -= weight[other];
+                    weight[other] = 0;
+                    status[other] = node_status::merged;
+                    list_length[other] = 0;
+                    num_elements[other] = 0;
+                    next_member[last_member[var]] = other;
+                    last_member[var] = last_member[other];
+                }
+            }
+        }
+        for (auto var : pivot_vars) {
+            if (status[var] == node_status::variable) {
+                degree[var] = std::max(degree[var], IndexType{});
+                insert_bucket(var);
+                min_degree = std::min(min_degree, degree[var]);
+            }
+        }
+
+        // remove the lists of absorbed elements if they use too much space
+        if (element_lists.size() > 2 * live_element_entries + n) {
+            IndexType new_size{};
+            IndexType num_live_elements{};
+            for (auto elem : elements) {
+                if (status[elem] != node_status::element) {
+                    continue;
+                }
+                const auto elem_begin = element_begin[elem];
+                element_begin[elem] = new_size;
+                for (auto i = elem_begin; i < elem_begin + element_length[elem];
+                     i++) {
+                    const auto var = element_lists[i];
+                    if (status[var] == node_status::variable) {
+                        element_lists[new_size++] = var;
+                    }
+                }
+                element_length[elem] = new_size - element_begin[elem];
+                elements[num_live_elements++] = elem;
+            }
+            element_lists.resize(new_size);
+            elements.resize(num_live_elements);
+            live_element_entries = new_size;
+        }
+    }
+    for (IndexType row = 0; row < n; row++) {
+        if (status[row] == node_status::dense) {
+            permutation[num_ordered++] = row;
+        }
+    }
+}
+
+
+}  // namespace detail
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_AMD_ORDERING_HPP_
@@ -0,0 +1,866 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
+#define GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/reorder/amd_ordering.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace detail {
+
+
+/**
+ * An undirected graph in CSR format with vertex and edge weights. The
+ * adjacency lists must be symmetric and must not contain self-loops.
+ */
+template <typename IndexType>
+struct weighted_graph {
+    weighted_graph(std::shared_ptr<const Executor> exec,
+                   IndexType num_vertices)
+        : row_ptrs(num_vertices + 1, 0, {exec}),
+          col_idxs(exec),
+          edge_weights(exec),
+          vertex_weights(num_vertices, 1, {exec})
+    {}
+
+    IndexType get_num_vertices() const
+    {
+        return static_cast<IndexType>(vertex_weights.size());
+    }
+
+    IndexType get_total_weight() const
+    {
+        return std::accumulate(vertex_weights.begin(), vertex_weights.end(),
+                               IndexType{});
+    }
+
+    vector<IndexType> row_ptrs;
+    vector<IndexType> col_idxs;
+    vector<IndexType> edge_weights;
+    vector<IndexType> vertex_weights;
+};
+
+
+/** The side of a vertex in a bisection, or the vertex separator. */
+enum class graph_side : uint8 { left, right, separator };
+
+
+inline graph_side opposite(graph_side side)
+{
+    return side == graph_side::left ? graph_side::right : graph_side::left;
+}
+
+
+/**
+ * Coarsens the graph using heavy-edge matching: Visiting the vertices in
+ * random order, each unmatched vertex is matched with the unmatched neighbor
+ * connected by the heaviest edge, as long as the combined vertex weight stays
+ * below max_vertex_weight. Each matched pair or unmatched vertex becomes a
+ * coarse vertex, coarse_map stores the coarse vertex for each fine vertex.
+ */
+template <typename IndexType>
+weighted_graph<IndexType> coarsen(std::shared_ptr<const Executor> exec,
+                                  const weighted_graph<IndexType>& graph,
+                                  std::minstd_rand& rng,
+                                  IndexType max_vertex_weight,
+                                  vector<IndexType>& coarse_map)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    vector<IndexType> order(num_vertices, {exec});
+    std::iota(order.begin(), order.end(), IndexType{});
+    for (auto i = num_vertices - 1; i > 0; i--) {
+        std::swap(order[i], order[rng() % (i + 1)]);
+    }
+    vector<IndexType> match(num_vertices, -1, {exec});
+    for (auto vertex : order) {
+        if (match[vertex] >= 0) {
+            continue;
+        }
+        auto best = vertex;
+        IndexType best_weight{};
+        for (auto nz = graph.row_ptrs[vertex]; nz < graph.row_ptrs[vertex + 1];
+             nz++) {
+            const auto neighbor = graph.col_idxs[nz];
+            if (match[neighbor] < 0 && graph.edge_weights[nz] > best_weight &&
+                graph.vertex_weights[vertex] +
+                        graph.vertex_weights[neighbor] <=
+                    max_vertex_weight) {
+                best = neighbor;
+                best_weight = graph.edge_weights[nz];
+            }
+        }
+        match[vertex] = best;
+        match[best] = vertex;
+    }
+    // number the coarse vertices and group their fine vertices
+    coarse_map.assign(num_vertices, -1);
+    vector<IndexType> fine_vertices(exec);
+    fine_vertices.reserve(num_vertices);
+    IndexType num_coarse{};
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (coarse_map[vertex] < 0) {
+            coarse_map[vertex] = num_coarse;
+            fine_vertices.push_back(vertex);
+            if (match[vertex] != vertex) {
+                coarse_map[match[vertex]] = num_coarse;
+                fine_vertices.push_back(match[vertex]);
+            }
+            num_coarse++;
+        }
+    }
+    weighted_graph<IndexType> coarse{exec, num_coarse};
+    coarse.col_idxs.reserve(graph.col_idxs.size());
+    coarse.edge_weights.reserve(graph.col_idxs.size());
+    // position of the edge to a coarse neighbor in the current row
+    vector<IndexType> edge_pos(num_coarse, -1, {exec});
+    size_type fine_idx{};
+    for (IndexType coarse_vertex = 0; coarse_vertex < num_coarse;
+         coarse_vertex++) {
+        const auto row_begin = static_cast<IndexType>(coarse.col_idxs.size());
+        coarse.vertex_weights[coarse_vertex] = 0;
+        while (fine_idx < fine_vertices.size() &&
+               coarse_map[fine_vertices[fine_idx]] == coarse_vertex) {
+            const auto vertex = fine_vertices[fine_idx++];
+            coarse.vertex_weights[coarse_vertex] +=
+                graph.vertex_weights[vertex];
+            for (auto nz = graph.row_ptrs[vertex];
+                 nz < graph.row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = coarse_map[graph.col_idxs[nz]];
+                if (neighbor == coarse_vertex) {
+                    continue;
+                }
+                if (edge_pos[neighbor] >= row_begin) {
+                    coarse.edge_weights[edge_pos[neighbor]] +=
+                        graph.edge_weights[nz];
+                } else {
+                    edge_pos[neighbor] =
+                        static_cast<IndexType>(coarse.col_idxs.size());
+                    coarse.col_idxs.push_back(neighbor);
+                    coarse.edge_weights.push_back(graph.edge_weights[nz]);
+                }
+            }
+        }
+        coarse.row_ptrs[coarse_vertex + 1] =
+            static_cast<IndexType>(coarse.col_idxs.size());
+    }
+    return coarse;
+}
+
+
+/**
+ * Computes for each vertex the weight of its edges to the other side minus
+ * the weight of its edges to its own side, i.e. the reduction of the edge cut
+ * when moving it to the other side, and returns the edge cut.
+ */
+template <typename IndexType>
+IndexType compute_gains(const weighted_graph<IndexType>& graph,
+                        const vector<graph_side>& sides,
+                        vector<IndexType>& gains)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    IndexType cut{};
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        IndexType gain{};
+        for (auto nz = graph.row_ptrs[vertex]; nz < graph.row_ptrs[vertex + 1];
+             nz++) {
+            if (sides[graph.col_idxs[nz]] == sides[vertex]) {
+                gain -= graph.edge_weights[nz];
+            } else {
+                gain += graph.edge_weights[nz];
+                cut += graph.edge_weights[nz];
+            }
+        }
+        gains[vertex] = gain;
+    }
+    return cut / 2;
+}
+
+
+/**
+ * Improves a bisection using Fiduccia-Mattheyses refinement: In each pass,
+ * every vertex may move to the other side once, in the order of decreasing
+ * gain, as long as the weight of the target side stays below its maximum
+ * weight. Afterwards, the moves are rolled back to the balanced state with
+ * the smallest edge cut. If the input is not balanced, moves that reduce the
+ * imbalance are always allowed.
+ *
+ * @return the edge cut after refinement
+ */
+template <typename IndexType>
+IndexType refine_bisection(std::shared_ptr<const Executor> exec,
+                           const weighted_graph<IndexType>& graph,
+                           vector<graph_side>& sides,
+                           std::array<IndexType, 2> max_side_weights,
+                           int num_passes = 4)
+{
+    using entry = std::pair<IndexType, IndexType>;
+    const auto num_vertices = graph.get_num_vertices();
+    // stop a pass after this many moves without improvement
+    const auto max_futile_moves =
+        std::max<IndexType>(50, num_vertices / 50);
+    vector<IndexType> gains(num_vertices, {exec});
+    vector<uint8> locked(num_vertices, {exec});
+    vector<IndexType> moves(exec);
+    std::array<IndexType, 2> side_weights{};
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        side_weights[static_cast<int>(sides[vertex])] +=
+            graph.vertex_weights[vertex];
+    }
+    const auto is_balanced = [&] {
+        return side_weights[0] <= max_side_weights[0] &&
+               side_weights[1] <= max_side_weights[1];
+    };
+    const auto move = [&](IndexType vertex) {
+        const auto from = sides[vertex];
+        sides[vertex] = opposite(from);
+        side_weights[static_cast<int>(from)] -= graph.vertex_weights[vertex];
+        side_weights[static_cast<int>(sides[vertex])] +=
+            graph.vertex_weights[vertex];
+    };
+    auto cut = compute_gains(graph, sides, gains);
+    for (int pass = 0; pass < num_passes; pass++) {
+        std::priority_queue<entry, vector<entry>> queue{std::less<entry>{},
+                                                        vector<entry>{exec}};
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            queue.emplace(gains[vertex], vertex);
+        }
+        std::fill(locked.begin(), locked.end(), uint8{});
+        moves.clear();
+        auto best_cut = cut;
+        auto best_balanced = is_balanced();
+        size_type best_num_moves{};
+        IndexType futile_moves{};
+        while (!queue.empty() && futile_moves < max_futile_moves) {
+            const auto gain = queue.top().first;
+            const auto vertex = queue.top().second;
+            queue.pop();
+            // skip outdated entries
+            if (locked[vertex] || gain != gains[vertex]) {
+                continue;
+            }
+            const auto weight = graph.vertex_weights[vertex];
+            const auto from = static_cast<int>(sides[vertex]);
+            // excess weight of both sides after the move
+            const auto from_excess =
+                side_weights[from] - max_side_weights[from];
+            const auto to_excess =
+                side_weights[1 - from] + weight - max_side_weights[1 - from];
+            if (to_excess > 0 &&
+                (from_excess <= 0 || to_excess >= from_excess)) {
+                continue;
+            }
+            locked[vertex] = 1;
+            move(vertex);
+            moves.push_back(vertex);
+            cut -= gain;
+            gains[vertex] = -gain;
+            for (auto nz = graph.row_ptrs[vertex];
+                 nz < graph.row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = graph.col_idxs[nz];
+                const auto edge_weight = graph.edge_weights[nz];
+                if (sides[neighbor] == sides[vertex]) {
+                    gains[neighbor] -= 2 * edge_weight;
+                } else {
+                    gains[neighbor] += 2 * edge_weight;
+                }
+                if (!locked[neighbor]) {
+                    queue.emplace(gains[neighbor], neighbor);
+                }
+            }
+            const auto balanced = is_balanced();
+            if ((balanced && !best_balanced) ||
+                (balanced == best_balanced && cut < best_cut)) {
+                best_cut = cut;
+                best_balanced = balanced;
+                best_num_moves = moves.size();
+                futile_moves = 0;
+            } else {
+                futile_moves++;
+            }
+        }
+        for (auto i = moves.size(); i > best_num_moves; i--) {
+            move(moves[i - 1]);
+        }
+        cut = compute_gains(graph, sides, gains);
+        if (best_num_moves == 0) {
+            break;
+        }
+    }
+    return cut;
+}
+
+
+/**
+ * Computes an initial bisection of a (coarse) graph by greedy graph growing:
+ * Starting from a random vertex, vertices are added to the left side in
+ * breadth-first order until it contains the target weight. The best of
+ * several refined attempts is returned.
+ */
+template <typename IndexType>
+vector<graph_side> initial_bisection(std::shared_ptr<const Executor> exec,
+                                     const weighted_graph<IndexType>& graph,
+                                     std::minstd_rand& rng,
+                                     std::array<IndexType, 2> max_side_weights,
+                                     IndexType left_weight_target,
+                                     int num_attempts = 4)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    vector<graph_side> best_sides(num_vertices, graph_side::right, {exec});
+    vector<graph_side> sides(num_vertices, graph_side::right, {exec});
+    vector<uint8> queued(num_vertices, {exec});
+    vector<IndexType> queue(exec);
+    auto best_cut = std::numeric_limits<IndexType>::max();
+    for (int attempt = 0; attempt < num_attempts; attempt++) {
+        std::fill(sides.begin(), sides.end(), graph_side::right);
+        std::fill(queued.begin(), queued.end(), uint8{});
+        queue.clear();
+        IndexType left_weight{};
+        IndexType next_unqueued{};
+        const auto start = static_cast<IndexType>(rng() % num_vertices);
+        queue.push_back(start);
+        queued[start] = 1;
+        size_type queue_pos{};
+        while (left_weight < left_weight_target) {
+            if (queue_pos == queue.size()) {
+                // continue with another connected component
+                while (next_unqueued < num_vertices && queued[next_unqueued]) {
+                    next_unqueued++;
+                }
+                if (next_unqueued == num_vertices) {
+                    break;
+                }
+                queue.push_back(next_unqueued);
+                queued[next_unqueued] = 1;
+            }
+            const auto vertex = queue[queue_pos++];
+            sides[vertex] = graph_side::left;
+            left_weight += graph.vertex_weights[vertex];
+            for (auto nz = graph.row_ptrs[vertex];
+                 nz < graph.row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = graph.col_idxs[nz];
+                if (!queued[neighbor]) {
+                    queued[neighbor] = 1;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        const auto cut =
+            refine_bisection(exec, graph, sides, max_side_weights);
+        if (cut < best_cut) {
+            best_cut = cut;
+            best_sides = sides;
+        }
+    }
+    return best_sides;
+}
+
+
+/**
+ * Computes a balanced bisection with small edge cut using the multilevel
+ * scheme: The graph is coarsened by heavy-edge matching, the coarsest graph
+ * is bisected by greedy graph growing, and the bisection is projected back
+ * to the finer graphs and refined on each level.
+ *
+ * @param imbalance  the maximum relative amount by which the weight of
+ *                   either side may exceed its target weight
+ * @param left_fraction  the fraction of the total weight targeted for the
+ *                       left side
+ */
+template <typename IndexType>
+vector<graph_side> multilevel_bisection(std::shared_ptr<const Executor> exec,
+                                        const weighted_graph<IndexType>& graph,
+                                        unsigned seed, double imbalance = 0.05,
+                                        IndexType coarsest_size = 64,
+                                        double left_fraction = 0.5)
+{
+    std::minstd_rand rng{seed};
+    const auto total_weight = graph.get_total_weight();
+    const auto left_target =
+        static_cast<IndexType>(total_weight * left_fraction);
+    const auto max_weight = [&](double fraction) {
+        return std::max(
+            static_cast<IndexType>(total_weight * fraction * (1.0 + imbalance)),
+            static_cast<IndexType>(std::ceil(total_weight * fraction)));
+    };
+    const std::array<IndexType, 2> max_side_weights{
+        max_weight(left_fraction), max_weight(1.0 - left_fraction)};
+    // avoid coarse vertices that are too heavy to balance the bisection
+    const auto max_vertex_weight = std::max<IndexType>(
+        1, static_cast<IndexType>(1.5 * total_weight / coarsest_size));
+    std::vector<weighted_graph<IndexType>> coarse_graphs;
+    std::vector<vector<IndexType>> coarse_maps;
+    const auto get_level =
+        [&](size_type level) -> const weighted_graph<IndexType>& {
+        return level == 0 ? graph : coarse_graphs[level - 1];
+    };
+    while (get_level(coarse_graphs.size()).get_num_vertices() >
+           coarsest_size) {
+        const auto& fine = get_level(coarse_graphs.size());
+        vector<IndexType> coarse_map(exec);
+        auto coarse =
+            coarsen(exec, fine, rng, max_vertex_weight, coarse_map);
+        // stop if the matching stalls, e.g. for star-like graphs
+        if (coarse.get_num_vertices() > 0.9 * fine.get_num_vertices()) {
+            break;
+        }
+        coarse_graphs.push_back(std::move(coarse));
+        coarse_maps.push_back(std::move(coarse_map));
+    }
+    auto sides = initial_bisection(exec, get_level(coarse_graphs.size()), rng,
+                                   max_side_weights, left_target);
+    for (auto level = coarse_graphs.size(); level > 0; level--) {
+        const auto& fine = get_level(level - 1);
+        const auto& coarse_map = coarse_maps[level - 1];
+        vector<graph_side> fine_sides(fine.get_num_vertices(), {exec});
+        for (IndexType vertex = 0; vertex < fine.get_num_vertices();
+             vertex++) {
+            fine_sides[vertex] = sides[coarse_map[vertex]];
+        }
+        sides = std::move(fine_sides);
+        refine_bisection(exec, fine, sides, max_side_weights);
+    }
+    return sides;
+}
+
+
+/**
+ * Turns the edge separator of a bisection into a vertex separator by
+ * computing a minimum vertex cover of the cut edges: A maximum matching of
+ * the bipartite graph formed by the cut edges is computed using augmenting
+ * paths, and König's theorem gives the minimum vertex cover from the
+ * vertices reachable from unmatched left vertices via alternating paths.
+ */
+template <typename IndexType>
+void extract_vertex_separator(std::shared_ptr<const Executor> exec,
+                              const weighted_graph<IndexType>& graph,
+                              vector<graph_side>& sides)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    vector<IndexType> match(num_vertices, -1, {exec});
+    vector<IndexType> visited(num_vertices, -1, {exec});
+    vector<IndexType> discovered_by(num_vertices, -1, {exec});
+    // (left vertex, next edge to examine)
+    vector<std::pair<IndexType, IndexType>> stack(exec);
+    // left vertices are only matched to right vertices via cut edges
+    const auto is_cut_edge = [&](IndexType nz) {
+        return sides[graph.col_idxs[nz]] == graph_side::right;
+    };
+    for (IndexType root = 0; root < num_vertices; root++) {
+        if (sides[root] != graph_side::left) {
+            continue;
+        }
+        stack.clear();
+        stack.emplace_back(root, graph.row_ptrs[root]);
+        while (!stack.empty()) {
+            auto& top = stack.back();
+            const auto left = top.first;
+            if (top.second == graph.row_ptrs[left + 1]) {
+                stack.pop_back();
+                continue;
+            }
+            const auto nz = top.second++;
+            const auto right = graph.col_idxs[nz];
+            if (!is_cut_edge(nz) || visited[right] == root) {
+                continue;
+            }
+            visited[right] = root;
+            discovered_by[right] = left;
+            if (match[right] < 0) {
+                // flip the matching along the augmenting path
+                auto cur = right;
+                while (true) {
+                    const auto prev = discovered_by[cur];
+                    const auto next = match[prev];
+                    match[prev] = cur;
+                    match[cur] = prev;
+                    if (prev == root) {
+                        break;
+                    }
+                    cur = next;
+                }
+                break;
+            }
+            stack.emplace_back(match[right], graph.row_ptrs[match[right]]);
+        }
+    }
+    // find all vertices reachable via alternating paths from unmatched left
+    // vertices
+    vector<uint8> reached(num_vertices, {exec});
+    vector<IndexType> queue(exec);
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (sides[vertex] == graph_side::left && match[vertex] < 0) {
+            reached[vertex] = 1;
+            queue.push_back(vertex);
+        }
+    }
+    for (size_type i = 0; i < queue.size(); i++) {
+        const auto left = queue[i];
+        for (auto nz = graph.row_ptrs[left]; nz < graph.row_ptrs[left + 1];
+             nz++) {
+            const auto right = graph.col_idxs[nz];
+            if (!is_cut_edge(nz) || reached[right] ||
+                match[left] == right) {
+                continue;
+            }
+            reached[right] = 1;
+            const auto next = match[right];
+            if (next >= 0 && !reached[next]) {
+                reached[next] = 1;
+                queue.push_back(next);
+            }
+        }
+    }
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        const auto side = sides[vertex];
+        if ((side == graph_side::left && !reached[vertex]) ||
+            (side == graph_side::right && reached[vertex])) {
+            sides[vertex] = graph_side::separator;
+        }
+    }
+}
+
+
+/**
+ * A subgraph to be ordered by nested dissection, together with the original
+ * indices of its vertices and the output location for its ordering.
+ */
+template <typename IndexType>
+struct nd_subproblem {
+    weighted_graph<IndexType> graph;
+    vector<IndexType> vertices;
+    IndexType* permutation;
+};
+
+
+/** Creates the nested dissection subproblem for a whole graph. */
+template <typename IndexType>
+nd_subproblem<IndexType> create_nd_problem(
+    std::shared_ptr<const Executor> exec, IndexType num_vertices,
+    const IndexType* row_ptrs, const IndexType* col_idxs,
+    IndexType* permutation)
+{
+    nd_subproblem<IndexType> problem{
+        weighted_graph<IndexType>{exec, num_vertices},
+        vector<IndexType>(num_vertices, {exec}), permutation};
+    auto& graph = problem.graph;
+    const auto nnz = row_ptrs[num_vertices];
+    std::copy_n(row_ptrs, num_vertices + 1, graph.row_ptrs.begin());
+    graph.col_idxs.assign(col_idxs, col_idxs + nnz);
+    graph.edge_weights.assign(nnz, 1);
+    std::iota(problem.vertices.begin(), problem.vertices.end(), IndexType{});
+    return problem;
+}
+
+
+/**
+ * Performs a single step of nested dissection: Small subproblems are ordered
+ * completely using approximate minimum degree, larger ones are split by a
+ * vertex separator that is ordered last, and the two remaining parts are
+ * returned as new subproblems that can be ordered independently.
+ */
+template <typename IndexType>
+std::vector<nd_subproblem<IndexType>> nested_dissection_step(
+    std::shared_ptr<const Executor> exec, nd_subproblem<IndexType>& problem,
+    IndexType max_leaf_size)
+{
+    const auto& graph = problem.graph;
+    const auto num_vertices = graph.get_num_vertices();
+    std::vector<nd_subproblem<IndexType>> result;
+    const auto order_leaf = [&] {
+        vector<IndexType> leaf_permutation(num_vertices, {exec});
+        amd_order(exec, num_vertices, graph.row_ptrs.data(),
+                  graph.col_idxs.data(), 10.0, leaf_permutation.data());
+        for (IndexType i = 0; i < num_vertices; i++) {
+            problem.permutation[i] = problem.vertices[leaf_permutation[i]];
+        }
+    };
+    if (num_vertices <= max_leaf_size) {
+        order_leaf();
+        return result;
+    }
+    // derive the seed from the subproblem to get reproducible results
+    // independent of the order in which subproblems are processed
+    const auto seed = static_cast<unsigned>(problem.vertices[0]) * 2654435761u +
+                      static_cast<unsigned>(num_vertices);
+    auto sides = multilevel_bisection(exec, graph, seed);
+    extract_vertex_separator(exec, graph, sides);
+    std::array<IndexType, 3> sizes{};
+    vector<IndexType> local_idxs(num_vertices, {exec});
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        local_idxs[vertex] = sizes[static_cast<int>(sides[vertex])]++;
+    }
+    if (sizes[0] == 0 || sizes[1] == 0) {
+        order_leaf();
+        return result;
+    }
+    const std::array<IndexType, 3> offsets{0, sizes[0], sizes[0] + sizes[1]};
+    for (int side = 0; side < 2; side++) {
+        result.push_back(nd_subproblem<IndexType>{
+            weighted_graph<IndexType>{exec, sizes[side]},
+            vector<IndexType>(sizes[side], {exec}),
+            problem.permutation + offsets[side]});
+    }
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        const auto side = static_cast<int>(sides[vertex]);
+        const auto local = local_idxs[vertex];
+        if (side == 2) {
+            problem.permutation[offsets[2] + local] = problem.vertices[vertex];
+            continue;
+        }
+        auto& child = result[side];
+        child.vertices[local] = problem.vertices[vertex];
+        for (auto nz = graph.row_ptrs[vertex]; nz < graph.row_ptrs[vertex + 1];
+             nz++) {
+            const auto neighbor = graph.col_idxs[nz];
+            if (static_cast<int>(sides[neighbor]) == side) {
+                child.graph.col_idxs.push_back(local_idxs[neighbor]);
+            }
+        }
+        child.graph.row_ptrs[local + 1] =
+            static_cast<IndexType>(child.graph.col_idxs.size());
+    }
+    for (auto& child : result) {
+        child.graph.edge_weights.assign(child.graph.col_idxs.size(), 1);
+    }
+    return result;
+}
+
+
+
+/**
+ * A subgraph to be split into num_parts parts by recursive bisection,
+ * together with the original indices of its vertices and the first part ID
+ * it is mapped to.
+ */
+template <typename IndexType>
+struct kway_subproblem {
+    weighted_graph<IndexType> graph;
+    vector<IndexType> vertices;
+    experimental::distributed::comm_index_type first_part;
+    experimental::distributed::comm_index_type num_parts;
+};
+
+
+/** Creates the k-way partitioning subproblem for a whole graph. */
+template <typename IndexType>
+kway_subproblem<IndexType> create_kway_problem(
+    std::shared_ptr<const Executor> exec, IndexType num_vertices,
+    const IndexType* row_ptrs, const IndexType* col_idxs,
+    experimental::distributed::comm_index_type num_parts)
+{
+    kway_subproblem<IndexType> problem{
+        weighted_graph<IndexType>{exec, num_vertices},
+        vector<IndexType>(num_vertices, {exec}), 0, num_parts};
+    auto& graph = problem.graph;
+    const auto nnz = row_ptrs[num_vertices];
+    std::copy_n(row_ptrs, num_vertices + 1, graph.row_ptrs.begin());
+    graph.col_idxs.assign(col_idxs, col_idxs + nnz);
+    graph.edge_weights.assign(nnz, 1);
+    std::iota(problem.vertices.begin(), problem.vertices.end(), IndexType{});
+    return problem;
+}
+
+
+/**
+ * Returns the imbalance allowed for each bisection such that recursively
+ * bisecting into num_parts parts stays within the given total imbalance.
+ */
+inline double get_bisection_imbalance(
+    double imbalance, experimental::distributed::comm_index_type num_parts)
+{
+    const auto num_levels = std::max(1.0, std::ceil(std::log2(num_parts)));
+    return std::pow(1.0 + imbalance, 1.0 / num_levels) - 1.0;
+}
+
+
+/**
+ * Performs a single step of recursive bisection: Subproblems with a single
+ * part are mapped to this part, larger ones are bisected with target weights
+ * proportional to the number of parts on either side, and the two sides are
+ * returned as new subproblems that can be partitioned independently.
+ */
+template <typename IndexType>
+std::vector<kway_subproblem<IndexType>> kway_partition_step(
+    std::shared_ptr<const Executor> exec, kway_subproblem<IndexType>& problem,
+    double imbalance, experimental::distributed::comm_index_type* mapping)
+{
+    const auto& graph = problem.graph;
+    const auto num_vertices = graph.get_num_vertices();
+    std::vector<kway_subproblem<IndexType>> result;
+    if (problem.num_parts == 1 || num_vertices == 0) {
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            mapping[problem.vertices[vertex]] = problem.first_part;
+        }
+        return result;
+    }
+    const auto left_parts = problem.num_parts / 2;
+    // derive the seed from the subproblem to get reproducible results
+    // independent of the order in which subproblems are processed
+    const auto seed = static_cast<unsigned>(problem.vertices[0]) * 2654435761u +
+                      static_cast<unsigned>(num_vertices);
+    const auto sides = multilevel_bisection(
+        exec, graph, seed, imbalance, IndexType{64},
+        static_cast<double>(left_parts) / problem.num_parts);
+    std::array<IndexType, 2> sizes{};
+    vector<IndexType> local_idxs(num_vertices, {exec});
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        local_idxs[vertex] = sizes[static_cast<int>(sides[vertex])]++;
+    }
+    for (int side = 0; side < 2; side++) {
+        result.push_back(kway_subproblem<IndexType>{
+            weighted_graph<IndexType>{exec, sizes[side]},
+            vector<IndexType>(sizes[side], {exec}),
+            side == 0 ? problem.first_part : problem.first_part + left_parts,
+            side == 0 ? left_parts : problem.num_parts - left_parts});
+    }
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        const auto side = static_cast<int>(sides[vertex]);
+        const auto local = local_idxs[vertex];
+        auto& child = result[side];
+        child.vertices[local] = problem.vertices[vertex];
+        child.graph.vertex_weights[local] = graph.vertex_weights[vertex];
+        for (auto nz = graph.row_ptrs[vertex]; nz < graph.row_ptrs[vertex + 1];
+             nz++) {
+            const auto neighbor = graph.col_idxs[nz];
+            if (static_cast<int>(sides[neighbor]) == side) {
+                child.graph.col_idxs.push_back(local_idxs[neighbor]);
+                child.graph.edge_weights.push_back(graph.edge_weights[nz]);
+            }
+        }
+        child.graph.row_ptrs[local + 1] =
+            static_cast<IndexType>(child.graph.col_idxs.size());
+    }
+    return result;
+}
+
+
+/**
+ * Improves a k-way partition by greedy boundary refinement: In each pass,
+ * every vertex is moved to the adjacent part it has the most edges to, if
+ * that reduces the edge cut, or keeps it while improving the balance. Moves
+ * must keep the target part below the maximum part weight, vertices in
+ * overweight parts move to the best adjacent part regardless of the cut.
+ */
+template <typename IndexType>
+void refine_kway(std::shared_ptr<const Executor> exec, IndexType num_vertices,
+                 const IndexType* row_ptrs, const IndexType* col_idxs,
+                 experimental::distributed::comm_index_type num_parts,
+                 double imbalance,
+                 experimental::distributed::comm_index_type* mapping,
+                 int num_passes = 8)
+{
+    using part_type = experimental::distributed::comm_index_type;
+    const auto max_part_weight = std::max(
+        static_cast<IndexType>(num_vertices * (1.0 + imbalance) / num_parts),
+        static_cast<IndexType>(ceildiv(num_vertices, num_parts)));
+    vector<IndexType> part_weights(num_parts, 0, {exec});
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        part_weights[mapping[vertex]]++;
+    }
+    // number of edges from the current vertex to each part
+    vector<IndexType> connectivity(num_parts, 0, {exec});
+    vector<part_type> adjacent_parts(exec);
+    for (int pass = 0; pass < num_passes; pass++) {
+        IndexType num_moves{};
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            const auto own = mapping[vertex];
+            for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+                const auto part = mapping[col_idxs[nz]];
+                if (connectivity[part]++ == 0) {
+                    adjacent_parts.push_back(part);
+                }
+            }
+            const auto overweight = part_weights[own] > max_part_weight;
+            auto best = own;
+            for (auto part : adjacent_parts) {
+                if (part == own || part_weights[part] >= max_part_weight) {
+                    continue;
+                }
+                const auto improves =
+                    best == own
+                        ? overweight ||
+                              connectivity[part] > connectivity[own] ||
+                              (connectivity[part] == connectivity[own] &&
+                               part_weights[part] + 1 < part_weights[own])
+                        : connectivity[part] > connectivity[best];
+                if (improves) {
+                    best = part;
+                }
+            }
+            for (auto part : adjacent_parts) {
+                connectivity[part] = 0;
+            }
+            adjacent_parts.clear();
+            if (best != own) {
+                mapping[vertex] = best;
+                part_weights[own]--;
+                part_weights[best]++;
+                num_moves++;
+            }
+        }
+        if (num_moves == 0) {
+            break;
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
@@ -33,12 +33,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/reorder/nested_dissection.hpp>
 
 
+#include <algorithm>
 #include <memory>
 
 
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
-#include <ginkgo/core/base/temporary_clone.hpp>
-#include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
 #if GKO_HAVE_METIS
@@ -47,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/adjacency_graph.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 
 
 namespace gko {
@@ -55,6 +58,12 @@ namespace reorder {
 namespace {
 
 
+GKO_REGISTER_OPERATION(compute_ordering, nested_dissection::compute_ordering);
+
+
+#if GKO_HAVE_METIS
+
+
 std::string metis_error_message(idx_t metis_error)
 {
     switch (metis_error) {
@@ -135,6 +144,9 @@ void metis_nd<idx_t>(std::shared_ptr<const Executor> host_exec,
 GKO_REGISTER_HOST_OPERATION(metis_nd, metis_nd);
 
 
+#endif  // GKO_HAVE_METIS
+
+
 }  // namespace
 
 
@@ -165,24 +177,32 @@ std::unique_ptr<LinOp> NestedDissection<ValueType, IndexType>::generate_impl(
     GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
     const auto exec = this->get_executor();
     const auto host_exec = exec->get_master();
-    // most matrix formats are convertible to Csr, but not to SparsityCsr, so we
-    // take the detour through Csr
-    const auto csr_mtx = copy_and_convert_to<matrix_type>(exec, system_matrix);
-    const auto sparsity_mtx =
-        copy_and_convert_to<matrix::SparsityCsr<ValueType, IndexType>>(exec,
-                                                                       csr_mtx)
-            ->to_adjacency_matrix();
-    const auto host_mtx = make_temporary_clone(host_exec, sparsity_mtx);
-    const auto num_rows = host_mtx->get_size()[0];
+    const auto num_rows = system_matrix->get_size()[0];
+    const auto adjacency_mtx =
+        detail::compute_adjacency_graph<ValueType, IndexType>(
+            host_exec, std::move(system_matrix), false);
     array<IndexType> permutation(host_exec, num_rows);
-    array<IndexType> inv_permutation(host_exec, num_rows);
-    exec->run(make_metis_nd(host_exec, num_rows, host_mtx->get_const_row_ptrs(),
-                            host_mtx->get_const_col_idxs(),
-                            build_metis_options(parameters_.options),
-                            permutation.get_data(),
-                            inv_permutation.get_data()));
+#if GKO_HAVE_METIS
+    if (parameters_.use_metis) {
+        array<IndexType> inv_permutation(host_exec, num_rows);
+        exec->run(make_metis_nd(
+            host_exec, num_rows, adjacency_mtx->get_const_row_ptrs(),
+            adjacency_mtx->get_const_col_idxs(),
+            build_metis_options(parameters_.options), permutation.get_data(),
+            inv_permutation.get_data()));
+        permutation.set_executor(exec);
+        // we discard the inverse permutation
+        return permutation_type::create(exec, dim<2>{num_rows, num_rows},
+                                        std::move(permutation));
+    }
+#endif
+    const auto max_leaf_size =
+        std::max<size_type>(parameters_.max_leaf_size, 1);
+    host_exec->run(make_compute_ordering(
+        static_cast<IndexType>(num_rows), adjacency_mtx->get_const_row_ptrs(),
+        adjacency_mtx->get_const_col_idxs(),
+        static_cast<IndexType>(max_leaf_size), permutation.get_data()));
     permutation.set_executor(exec);
-    // we discard the inverse permutation
     return permutation_type::create(exec, dim<2>{num_rows, num_rows},
                                     std::move(permutation));
 }
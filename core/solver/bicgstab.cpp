@@ -231,9 +231,9 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // t = A * z
         this->get_system_matrix()->apply(z, t);
         // gamma = dot(s, t)
-        s->compute_conj_dot(t, gamma, reduction_tmp);
         // beta = dot(t, t)
-        t->compute_conj_dot(t, beta, reduction_tmp);
+        gko::detail::compute_conj_dots<ValueType>({{s, t}, {t, t}},
+                                                  {gamma, beta}, reduction_tmp);
         // omega = gamma / beta
         // x = x + alpha * y + omega * z
         // r = s - omega * t
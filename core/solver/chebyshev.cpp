@@ -0,0 +1,478 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/chebyshev.hpp>
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
+#include "core/solver/ir_kernels.hpp"
+#include "core/solver/solver_base.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace chebyshev {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, ir::initialize);
+GKO_REGISTER_OPERATION(init_update, chebyshev::init_update);
+GKO_REGISTER_OPERATION(update, chebyshev::update);
+
+
+/**
+ * Computes the largest eigenvalue of the symmetric tridiagonal matrix with
+ * diagonal `diag` and off-diagonal `off_diag` by bisection on its Sturm
+ * sequence.
+ */
+template <typename ValueType>
+ValueType max_tridiagonal_eigenvalue(const std::vector<ValueType>& diag,
+                                     const std::vector<ValueType>& off_diag)
+{
+    const auto size = diag.size();
+    // Gershgorin bounds for the spectrum
+    auto lower = diag[0];
+    auto upper = diag[0];
+    for (size_type i = 0; i < size; i++) {
+        const auto radius = (i > 0 ? abs(off_diag[i - 1]) : ValueType{}) +
+                            (i + 1 < size ? abs(off_diag[i]) : ValueType{});
+        lower = std::min(lower, diag[i] - radius);
+        upper = std::max(upper, diag[i] + radius);
+    }
+    // number of eigenvalues smaller than the shift
+    auto count_below = [&](ValueType shift) {
+        size_type count{};
+        auto pivot = diag[0] - shift;
+        for (size_type i = 0; i < size; i++) {
+            if (i > 0) {
+                pivot = diag[i] - shift -
+                        off_diag[i - 1] * off_diag[i - 1] / pivot;
+            }
+            if (pivot == zero<ValueType>()) {
+                pivot = std::numeric_limits<ValueType>::epsilon();
+            }
+            count += pivot < zero<ValueType>() ? 1 : 0;
+        }
+        return count;
+    };
+    const auto tolerance = std::numeric_limits<ValueType>::epsilon() *
+                           std::max(abs(lower), abs(upper));
+    while (upper - lower > tolerance) {
+        const auto mid = (lower + upper) / 2;
+        if (mid <= lower || mid >= upper) {
+            break;
+        }
+        if (count_below(mid) == size) {
+            upper = mid;
+        } else {
+            lower = mid;
+        }
+    }
+    return upper;
+}
+
+
+}  // anonymous namespace
+}  // namespace chebyshev
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::estimate_foci()
+{
+    using Vector = matrix::Dense<ValueType>;
+    using real_type = remove_complex<ValueType>;
+    const auto num_rows = this->get_size()[0];
+    if (num_rows == 0) {
+        return;
+    }
+    if (gko::detail::is_distributed(this->get_system_matrix().get())) {
+        GKO_NOT_SUPPORTED(this->get_system_matrix());
+    }
+    auto exec = this->get_executor();
+    auto system_matrix = this->get_system_matrix();
+    auto preconditioner = this->get_preconditioner();
+    // The Lanczos coefficients are obtained from preconditioned CG steps
+    // on a pseudo-random right-hand side with zero initial guess.
+    auto r = Vector::create(exec, dim<2>{num_rows, 1});
+    r->read(matrix_data<ValueType>(r->get_size(),
+                                   std::uniform_real_distribution<>(-1.0, 1.0),
+                                   std::default_random_engine(42)));
+    auto z = Vector::create_with_config_of(r);
+    auto p = Vector::create_with_config_of(r);
+    auto q = Vector::create_with_config_of(r);
+    auto dot = Vector::create(exec, dim<2>{1, 1});
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto scalar = Vector::create(exec, dim<2>{1, 1});
+    array<char> reduction_tmp{exec};
+    auto host_dot = [&] {
+        return real(exec->copy_val_to_host(dot->get_const_values()));
+    };
+
+    std::vector<real_type> alpha;
+    std::vector<real_type> beta;
+    preconditioner->apply(r, z);
+    r->compute_conj_dot(z, dot, reduction_tmp);
+    auto rho = host_dot();
+    const auto initial_rho = rho;
+    p->copy_from(z);
+    for (size_type i = 0; i < parameters_.estimation_iters && rho > 0; i++) {
+        system_matrix->apply(p, q);
+        p->compute_conj_dot(q, dot, reduction_tmp);
+        const auto p_q = host_dot();
+        if (!(p_q > 0)) {
+            break;
+        }
+        alpha.push_back(rho / p_q);
+        // r = r - alpha * q
+        scalar->fill(-alpha.back());
+        r->add_scaled(scalar, q);
+        preconditioner->apply(r, z);
+        r->compute_conj_dot(z, dot, reduction_tmp);
+        const auto next_rho = host_dot();
+        beta.push_back(next_rho / rho);
+        rho = next_rho;
+        if (rho <= std::numeric_limits<real_type>::epsilon() * initial_rho) {
+            // the Krylov space is exhausted
+            break;
+        }
+        // p = z + beta * p
+        scalar->fill(beta.back());
+        p->scale(scalar);
+        p->add_scaled(one_op, z);
+    }
+    if (alpha.empty()) {
+        GKO_UNSUPPORTED_MATRIX_PROPERTY(
+            "the foci can only be estimated for symmetric positive definite "
+            "systems");
+    }
+    // Lanczos tridiagonal matrix from the CG coefficients
+    const auto size = alpha.size();
+    std::vector<real_type> diag(size);
+    std::vector<real_type> off_diag(size);
+    for (size_type i = 0; i < size; i++) {
+        diag[i] = one<real_type>() / alpha[i];
+        if (i > 0) {
+            diag[i] += beta[i - 1] / alpha[i - 1];
+        }
+        off_diag[i] = std::sqrt(beta[i]) / alpha[i];
+    }
+    const auto max_eigenvalue =
+        chebyshev::max_tridiagonal_eigenvalue(diag, off_diag);
+    foci_ = std::make_pair(
+        static_cast<ValueType>(parameters_.estimate_lower_factor *
+                               max_eigenvalue),
+        static_cast<ValueType>(parameters_.estimate_upper_factor *
+                               max_eigenvalue));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_foci(foci_)
+        .with_default_initial_guess(this->get_default_initial_guess())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_foci(conj(foci_.first), conj(foci_.second))
+        .with_default_initial_guess(this->get_default_initial_guess())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    this->apply_with_initial_guess_impl(b, x,
+                                        this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* b, LinOp* x, initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_b, auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            this->apply_dense_impl(dense_b, dense_x, guess);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void Chebyshev<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                            VectorType* dense_x,
+                                            initial_guess_mode guess) const
+{
+    using ws = workspace_traits<Chebyshev>;
+    constexpr uint8 relative_stopping_id{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(residual, dense_b);
+    GKO_SOLVER_VECTOR(inner_solution, dense_b);
+    GKO_SOLVER_VECTOR(update_solution, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    auto& stop_status = this->template create_workspace_array<stopping_status>(
+        ws::stop, dense_b->get_size()[1]);
+    exec->run(chebyshev::make_initialize(&stop_status));
+    if (guess != initial_guess_mode::zero) {
+        residual->copy_from(dense_b);
+        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, residual);
+    }
+    // zero input the residual is dense_b
+    const VectorType* residual_ptr =
+        guess == initial_guess_mode::zero ? dense_b : residual;
+
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
+        residual_ptr);
+
+    const auto center = (foci_.second + foci_.first) / ValueType{2};
+    const auto foci_direction = (foci_.second - foci_.first) / ValueType{2};
+    // the scalars only depend on the foci, so they are computed on the host
+    auto alpha = one<ValueType>();
+    int iter = -1;
+    while (true) {
+        ++iter;
+
+        if (iter == 0) {
+            // In iter 0, the iteration and residual are updated.
+            bool all_stopped = stop_criterion->update()
+                                   .num_iterations(iter)
+                                   .residual(residual_ptr)
+                                   .solution(dense_x)
+                                   .check(relative_stopping_id, true,
+                                          &stop_status, &one_changed);
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, dense_x, iter, residual_ptr, nullptr, nullptr,
+                &stop_status, all_stopped);
+            if (all_stopped) {
+                break;
+            }
+        } else {
+            // In the other iterations, the residual can be updated separately.
+            bool all_stopped = stop_criterion->update()
+                                   .num_iterations(iter)
+                                   .solution(dense_x)
+                                   // we have the residual check later
+                                   .ignore_residual_check(true)
+                                   .check(relative_stopping_id, false,
+                                          &stop_status, &one_changed);
+            if (all_stopped) {
+                this->template log<log::Logger::iteration_complete>(
+                    this, dense_b, dense_x, iter, nullptr, nullptr, nullptr,
+                    &stop_status, all_stopped);
+                break;
+            }
+            residual_ptr = residual;
+            // residual = b - A * x
+            residual->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
+                                             residual);
+            all_stopped = stop_criterion->update()
+                              .num_iterations(iter)
+                              .residual(residual_ptr)
+                              .solution(dense_x)
+                              .check(relative_stopping_id, true, &stop_status,
+                                     &one_changed);
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, dense_x, iter, residual_ptr, nullptr, nullptr,
+                &stop_status, all_stopped);
+            if (all_stopped) {
+                break;
+            }
+        }
+
+        if (this->get_preconditioner()->apply_uses_initial_guess()) {
+            // Use the residual as the initial guess of the inner solver.
+            inner_solution->copy_from(residual_ptr);
+        }
+        // inner_solution = preconditioner * residual
+        this->get_preconditioner()->apply(residual_ptr, inner_solution);
+
+        if (iter == 0) {
+            // alpha = 1 / center
+            // update_solution = inner_solution
+            // x = x + alpha * update_solution
+            alpha = one<ValueType>() / center;
+            exec->run(chebyshev::make_init_update(
+                alpha, gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x)));
+        } else {
+            // beta = (foci_direction * alpha / 2)^2 (halved in iteration 1)
+            // alpha = 1 / (center - beta / alpha)
+            // update_solution = inner_solution + beta * update_solution
+            // x = x + alpha * update_solution
+            const auto scaled_direction = foci_direction * alpha;
+            const auto beta =
+                iter == 1 ? scaled_direction * scaled_direction / ValueType{2}
+                          : scaled_direction * scaled_direction / ValueType{4};
+            alpha = one<ValueType>() / (center - beta / alpha);
+            exec->run(chebyshev::make_update(
+                alpha, beta, gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x)));
+        }
+    }
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                      const LinOp* beta, LinOp* x) const
+{
+    this->apply_with_initial_guess_impl(alpha, b, beta, x,
+                                        this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* alpha, const LinOp* b, const LinOp* beta, LinOp* x,
+    initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_alpha, auto dense_b, auto dense_beta,
+                      auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get(), guess);
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_arrays(const Solver&)
+{
+    return 1;
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_vectors(const Solver&)
+{
+    return 5;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "residual", "inner_solution", "update_solution", "one", "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::scalars(const Solver&)
+{
+    return {};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::vectors(const Solver&)
+{
+    return {residual, inner_solution, update_solution};
+}
+
+
+#define GKO_DECLARE_CHEBYSHEV(_type) class Chebyshev<_type>
+#define GKO_DECLARE_CHEBYSHEV_TRAITS(_type) \
+    struct workspace_traits<Chebyshev<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
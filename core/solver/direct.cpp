@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/factorization/factorization.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
 #include <ginkgo/core/solver/solver_base.hpp>
 
 
@@ -56,9 +57,29 @@ std::unique_ptr<LinOp> Direct<ValueType, IndexType>::conj_transpose() const
     GKO_NOT_IMPLEMENTED;
 
 
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+    if (!this->get_system_matrix()) {
+        GKO_NOT_SUPPORTED(this);
+    }
+    if (permutation_.get_num_elems() > 0) {
+        new_matrix =
+            as<Permutable<IndexType>>(new_matrix)->permute(&permutation_);
+    }
+    // the factors are shared with the triangular solvers, so they pick up
+    // the new values without being regenerated
+    std::const_pointer_cast<factorization_type>(this->get_system_matrix())
+        ->refactorize(new_matrix);
+}
+
+
 template <typename ValueType, typename IndexType>
 Direct<ValueType, IndexType>::Direct(const Direct& other)
-    : EnableLinOp<Direct>{other.get_executor()}
+    : EnableLinOp<Direct>{other.get_executor()},
+      permutation_{other.get_executor()}
 {
     *this = other;
 }
@@ -66,7 +87,8 @@ Direct<ValueType, IndexType>::Direct(const Direct& other)
 
 template <typename ValueType, typename IndexType>
 Direct<ValueType, IndexType>::Direct(Direct&& other)
-    : EnableLinOp<Direct>{other.get_executor()}
+    : EnableLinOp<Direct>{other.get_executor()},
+      permutation_{other.get_executor()}
 {
     *this = std::move(other);
 }
@@ -83,6 +105,7 @@ Direct<ValueType, IndexType>& Direct<ValueType, IndexType>::operator=(
         const auto exec = this->get_executor();
         lower_solver_ = other.lower_solver_->clone(exec);
         upper_solver_ = other.upper_solver_->clone(exec);
+        permutation_ = other.permutation_;
     }
     return *this;
 }
@@ -99,6 +122,7 @@ Direct<ValueType, IndexType>& Direct<ValueType, IndexType>::operator=(
         const auto exec = this->get_executor();
         lower_solver_ = std::move(other.lower_solver_);
         upper_solver_ = std::move(other.upper_solver_);
+        permutation_ = std::move(other.permutation_);
     }
     return *this;
 }
@@ -106,7 +130,7 @@ Direct<ValueType, IndexType>& Direct<ValueType, IndexType>::operator=(
 
 template <typename ValueType, typename IndexType>
 Direct<ValueType, IndexType>::Direct(std::shared_ptr<const Executor> exec)
-    : EnableLinOp<Direct>{exec}
+    : EnableLinOp<Direct>{exec}, permutation_{exec}
 {}
 
 
@@ -114,16 +138,27 @@ template <typename ValueType, typename IndexType>
 static std::shared_ptr<const factorization::Factorization<ValueType, IndexType>>
 generate_factorization(
     std::shared_ptr<const LinOpFactory> factorization_factory,
-    std::shared_ptr<const LinOp> system_matrix)
+    std::shared_ptr<const LinOpFactory> reordering_factory,
+    std::shared_ptr<const LinOp> system_matrix, array<IndexType>& permutation)
 {
     if (auto factorization = std::dynamic_pointer_cast<
             const factorization::Factorization<ValueType, IndexType>>(
             system_matrix)) {
         return factorization;
-    } else {
-        return as<factorization::Factorization<ValueType, IndexType>>(
-            factorization_factory->generate(system_matrix));
     }
+    if (reordering_factory) {
+        const auto reordering = as<matrix::Permutation<IndexType>>(
+            reordering_factory->generate(system_matrix));
+        permutation = make_const_array_view(
+                          reordering->get_executor(),
+                          reordering->get_permutation_size(),
+                          reordering->get_const_permutation())
+                          .copy_to_array();
+        system_matrix =
+            as<Permutable<IndexType>>(system_matrix)->permute(&permutation);
+    }
+    return as<factorization::Factorization<ValueType, IndexType>>(
+        factorization_factory->generate(system_matrix));
 }
 
 
@@ -131,12 +166,12 @@ template <typename ValueType, typename IndexType>
 Direct<ValueType, IndexType>::Direct(const Factory* factory,
                                      std::shared_ptr<const LinOp> system_matrix)
     : EnableLinOp<Direct>{factory->get_executor(), system_matrix->get_size()},
-      gko::solver::EnableSolverBase<
-          Direct, factorization::Factorization<ValueType, IndexType>>{
-          generate_factorization<ValueType, IndexType>(
-              factory->get_parameters().factorization, system_matrix)}
+      permutation_{factory->get_executor()}
 {
     using factorization::storage_type;
+    this->set_system_matrix(generate_factorization<ValueType, IndexType>(
+        factory->get_parameters().factorization,
+        factory->get_parameters().reordering, system_matrix, permutation_));
     const auto factors = this->get_system_matrix();
     const auto exec = this->get_executor();
     const auto type = factors->get_storage_type();
@@ -196,8 +231,17 @@ void Direct<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
             this->setup_workspace();
             auto intermediate = this->create_workspace_op_with_config_of(
                 ws::intermediate, dense_b);
-            lower_solver_->apply(dense_b, intermediate);
-            upper_solver_->apply(intermediate, dense_x);
+            if (permutation_.get_num_elems() == 0) {
+                lower_solver_->apply(dense_b, intermediate);
+                upper_solver_->apply(intermediate, dense_x);
+                return;
+            }
+            auto permuted = this->create_workspace_op_with_config_of(
+                ws::permuted, dense_b);
+            dense_b->row_permute(&permutation_, permuted);
+            lower_solver_->apply(permuted, intermediate);
+            upper_solver_->apply(intermediate, permuted);
+            permuted->inverse_row_permute(&permutation_, dense_x);
         },
         b, x);
 }
@@ -219,9 +263,20 @@ void Direct<ValueType, IndexType>::apply_impl(const LinOp* alpha,
             this->setup_workspace();
             auto intermediate = this->create_workspace_op_with_config_of(
                 ws::intermediate, dense_b);
-            lower_solver_->apply(dense_b, intermediate);
-            upper_solver_->apply(dense_alpha, intermediate, dense_beta,
-                                 dense_x);
+            if (permutation_.get_num_elems() == 0) {
+                lower_solver_->apply(dense_b, intermediate);
+                upper_solver_->apply(dense_alpha, intermediate, dense_beta,
+                                     dense_x);
+                return;
+            }
+            auto permuted = this->create_workspace_op_with_config_of(
+                ws::permuted, dense_b);
+            dense_b->row_permute(&permutation_, permuted);
+            lower_solver_->apply(permuted, intermediate);
+            upper_solver_->apply(intermediate, permuted);
+            permuted->inverse_row_permute(&permutation_, intermediate);
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, intermediate);
         },
         alpha, b, beta, x);
 }
@@ -252,7 +307,7 @@ template <typename ValueType, typename IndexType>
 int workspace_traits<gko::experimental::solver::Direct<ValueType, IndexType>>::
     num_vectors(const Solver&)
 {
-    return 1;
+    return 2;
 }
 
 
@@ -260,7 +315,7 @@ template <typename ValueType, typename IndexType>
 std::vector<std::string> workspace_traits<gko::experimental::solver::Direct<
     ValueType, IndexType>>::op_names(const Solver&)
 {
-    return {"intermediate"};
+    return {"intermediate", "permuted"};
 }
 
 
@@ -284,7 +339,7 @@ template <typename ValueType, typename IndexType>
 std::vector<int> workspace_traits<gko::experimental::solver::Direct<
     ValueType, IndexType>>::vectors(const Solver&)
 {
-    return {intermediate};
+    return {intermediate, permuted};
 }
 
 
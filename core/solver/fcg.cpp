@@ -160,8 +160,8 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      */
     while (true) {
         this->get_preconditioner()->apply(r, z);
-        r->compute_conj_dot(z, rho, reduction_tmp);
-        t->compute_conj_dot(z, rho_t, reduction_tmp);
+        gko::detail::compute_conj_dots<ValueType>({{r, z}, {t, z}},
+                                                  {rho, rho_t}, reduction_tmp);
 
         ++iter;
         bool all_stopped =
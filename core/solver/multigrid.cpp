@@ -43,6 +43,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/base/utils_helper.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/preconditioner/schwarz.hpp>
+#include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/factorization/lu.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
@@ -55,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core/base/dispatch_helper.hpp"
 #include "core/components/fill_array_kernels.hpp"
+#include "core/distributed/helpers.hpp"
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/multigrid_kernels.hpp"
 #include "core/solver/solver_base.hpp"
@@ -109,23 +113,87 @@ casting(const T& x)
 }
 
 /**
- * as_vec gives a shortcut for casting pointer to dense.
+ * as_real_vec gives a shortcut for casting pointer to dense with real type.
  */
 template <typename ValueType>
-auto as_vec(std::shared_ptr<LinOp> x)
+auto as_real_vec(std::shared_ptr<LinOp> x)
 {
-    return std::static_pointer_cast<matrix::Dense<ValueType>>(x);
+    return std::static_pointer_cast<matrix::Dense<remove_complex<ValueType>>>(
+        x);
 }
 
 
 /**
- * as_real_vec gives a shortcut for casting pointer to dense with real type.
+ * Wraps the factory of a non-distributed smoother or solver into a
+ * block-Jacobi Schwarz preconditioner if the matrix is distributed.
+ *
+ * @tparam ValueType  the value type of the matrix
  */
 template <typename ValueType>
-auto as_real_vec(std::shared_ptr<LinOp> x)
+std::shared_ptr<const LinOpFactory> wrap_for_distributed(
+    const LinOp* matrix, std::shared_ptr<const LinOpFactory> local_factory)
 {
-    return std::static_pointer_cast<matrix::Dense<remove_complex<ValueType>>>(
-        x);
+#if GINKGO_BUILD_MPI
+    using experimental::distributed::Matrix;
+    using experimental::distributed::preconditioner::Schwarz;
+    auto exec = local_factory->get_executor();
+    if (dynamic_cast<const Matrix<ValueType, int32, int32>*>(matrix)) {
+        return Schwarz<ValueType, int32, int32>::build()
+            .with_local_solver_factory(local_factory)
+            .on(exec);
+    }
+    if (dynamic_cast<const Matrix<ValueType, int32, int64>*>(matrix)) {
+        return Schwarz<ValueType, int32, int64>::build()
+            .with_local_solver_factory(local_factory)
+            .on(exec);
+    }
+    if (dynamic_cast<const Matrix<ValueType, int64, int64>*>(matrix)) {
+        return Schwarz<ValueType, int64, int64>::build()
+            .with_local_solver_factory(local_factory)
+            .on(exec);
+    }
+#endif
+    return local_factory;
+}
+
+
+/**
+ * Creates a vector with nrhs columns that matches the rows of the matrix. It
+ * is a distributed vector with the row distribution of the matrix if the
+ * matrix is distributed.
+ *
+ * @tparam ValueType  the value type of the matrix
+ */
+template <typename ValueType>
+std::shared_ptr<LinOp> create_vector(std::shared_ptr<const Executor> exec,
+                                     const LinOp* matrix, size_type nrhs)
+{
+    const dim<2> size{matrix->get_size()[0], nrhs};
+#if GINKGO_BUILD_MPI
+    using experimental::distributed::Matrix;
+    if (gko::detail::is_distributed(matrix)) {
+        std::shared_ptr<const LinOp> local;
+        if (auto mtx =
+                dynamic_cast<const Matrix<ValueType, int32, int32>*>(matrix)) {
+            local = mtx->get_local_matrix();
+        } else if (auto mtx = dynamic_cast<
+                       const Matrix<ValueType, int32, int64>*>(matrix)) {
+            local = mtx->get_local_matrix();
+        } else if (auto mtx = dynamic_cast<
+                       const Matrix<ValueType, int64, int64>*>(matrix)) {
+            local = mtx->get_local_matrix();
+        } else {
+            GKO_NOT_SUPPORTED(matrix);
+        }
+        return experimental::distributed::Vector<ValueType>::create(
+            exec,
+            dynamic_cast<const experimental::distributed::DistributedBase*>(
+                matrix)
+                ->get_communicator(),
+            size, dim<2>{local->get_size()[0], nrhs});
+    }
+#endif
+    return matrix::Dense<ValueType>::create(exec, size);
 }
 
 
@@ -144,12 +212,14 @@ void handle_list(
     auto list_size = smoother_list.size();
     auto gen_default_smoother = [&] {
         auto exec = matrix->get_executor();
-        return share(build_smoother(preconditioner::Jacobi<ValueType>::build()
-                                        .with_max_block_size(1u)
-                                        .on(exec),
-                                    iteration,
-                                    casting<ValueType>(relaxation_factor))
-                         ->generate(matrix));
+        return share(
+            build_smoother(
+                wrap_for_distributed<ValueType>(
+                    matrix.get(), preconditioner::Jacobi<ValueType>::build()
+                                      .with_max_block_size(1u)
+                                      .on(exec)),
+                iteration, casting<ValueType>(relaxation_factor))
+                ->generate(matrix));
     };
     if (list_size != 0) {
         auto temp_index = list_size == 1 ? 0 : index;
@@ -244,12 +314,12 @@ struct MultigridState {
      *
      * @param level  the current level index
      * @param cycle  the multigrid cycle
-     * @param current_nrows  the number of rows of current fine matrix
-     * @param next_nrows  the number of rows of next coarse matrix
+     * @param current_op  the fine matrix of the current level
+     * @param next_op  the coarse matrix of the current level
      */
     template <typename ValueType>
     void allocate_memory(int level, multigrid::cycle cycle,
-                         size_type current_nrows, size_type next_nrows);
+                         const LinOp* current_op, const LinOp* next_op);
 
     /**
      * run the cycle of the level
@@ -299,7 +369,6 @@ void MultigridState::generate(const LinOp* system_matrix_in,
     system_matrix = system_matrix_in;
     multigrid = multigrid_in;
     nrhs = nrhs_in;
-    auto current_nrows = system_matrix->get_size()[0];
     auto mg_level_list = multigrid->get_mg_level_list();
     auto list_size = mg_level_list.size();
     auto cycle = multigrid->get_cycle();
@@ -311,50 +380,43 @@ void MultigridState::generate(const LinOp* system_matrix_in,
     clear_and_reserve(neg_one_list, list_size);
     // Allocate memory first such that reusing allocation in each iter.
     for (int i = 0; i < mg_level_list.size(); i++) {
-        auto next_nrows = mg_level_list.at(i)->get_coarse_op()->get_size()[0];
         auto mg_level = mg_level_list.at(i);
 
         run<gko::multigrid::EnableMultigridLevel, float, double,
             std::complex<float>, std::complex<double>>(
             mg_level,
-            [&, this](auto mg_level, auto i, auto cycle, auto current_nrows,
-                      auto next_nrows) {
+            [&, this](auto mg_level, auto i, auto cycle) {
                 using value_type =
                     typename std::decay_t<decltype(*mg_level)>::value_type;
-                using vec = matrix::Dense<value_type>;
-                this->allocate_memory<value_type>(i, cycle, current_nrows,
-                                                  next_nrows);
-                auto exec = as<LinOp>(multigrid->get_mg_level_list().at(i))
-                                ->get_executor();
+                this->allocate_memory<value_type>(
+                    i, cycle, mg_level->get_fine_op().get(),
+                    mg_level->get_coarse_op().get());
             },
-            i, cycle, current_nrows, next_nrows);
-
-        current_nrows = next_nrows;
+            i, cycle);
     }
 }
 
 
 template <typename ValueType>
 void MultigridState::allocate_memory(int level, multigrid::cycle cycle,
-                                     size_type current_nrows,
-                                     size_type next_nrows)
+                                     const LinOp* current_op,
+                                     const LinOp* next_op)
 {
     using vec = matrix::Dense<ValueType>;
-    using norm_vec = matrix::Dense<remove_complex<ValueType>>;
 
     auto exec =
         as<LinOp>(multigrid->get_mg_level_list().at(level))->get_executor();
-    r_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
+    r_list.emplace_back(create_vector<ValueType>(exec, current_op, nrhs));
     if (level != 0) {
         // allocate the previous level
-        g_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
-        e_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
+        g_list.emplace_back(create_vector<ValueType>(exec, current_op, nrhs));
+        e_list.emplace_back(create_vector<ValueType>(exec, current_op, nrhs));
         next_one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
     }
     if (level + 1 == multigrid->get_mg_level_list().size()) {
         // the last level allocate the g, e for coarsest solver
-        g_list.emplace_back(vec::create(exec, dim<2>{next_nrows, nrhs}));
-        e_list.emplace_back(vec::create(exec, dim<2>{next_nrows, nrhs}));
+        g_list.emplace_back(create_vector<ValueType>(exec, next_op, nrhs));
+        e_list.emplace_back(create_vector<ValueType>(exec, next_op, nrhs));
         next_one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
     }
     one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
@@ -420,8 +482,8 @@ void MultigridState::run_cycle(multigrid::cycle cycle, size_type level,
             } else {
                 // x in first level is already filled by zero outside.
                 if (level != 0) {
-                    dynamic_cast<matrix::Dense<ValueType>*>(x)->fill(
-                        zero<ValueType>());
+                    gko::detail::vector_dispatch<ValueType>(
+                        x, [](auto vec) { vec->fill(zero<ValueType>()); });
                 }
                 pre_smoother->apply(b, x);
             }
@@ -442,7 +504,8 @@ void MultigridState::run_cycle(multigrid::cycle cycle, size_type level,
     // next level
     if (level + 1 == total_level) {
         // the coarsest solver use the last level valuetype
-        as_vec<ValueType>(e)->fill(zero<ValueType>());
+        gko::detail::vector_dispatch<ValueType>(
+            e.get(), [](auto vec) { vec->fill(zero<ValueType>()); });
     }
     auto next_level_matrix =
         (level + 1 < total_level)
@@ -516,30 +579,7 @@ void Multigrid::generate()
             break;
         }
 
-        run<gko::multigrid::EnableMultigridLevel, float, double,
-            std::complex<float>, std::complex<double>>(
-            mg_level,
-            [this](auto mg_level, auto index, auto matrix) {
-                using value_type =
-                    typename std::decay_t<decltype(*mg_level)>::value_type;
-                handle_list<value_type>(
-                    index, matrix, parameters_.pre_smoother, pre_smoother_list_,
-                    parameters_.smoother_iters, parameters_.smoother_relax);
-                if (parameters_.mid_case ==
-                    multigrid::mid_smooth_type::standalone) {
-                    handle_list<value_type>(
-                        index, matrix, parameters_.mid_smoother,
-                        mid_smoother_list_, parameters_.smoother_iters,
-                        parameters_.smoother_relax);
-                }
-                if (!parameters_.post_uses_pre) {
-                    handle_list<value_type>(
-                        index, matrix, parameters_.post_smoother,
-                        post_smoother_list_, parameters_.smoother_iters,
-                        parameters_.smoother_relax);
-                }
-            },
-            index, mg_level->get_fine_op());
+        this->generate_smoothers(index, mg_level);
 
         mg_level_list_.emplace_back(mg_level);
         matrix = mg_level_list_.back()->get_coarse_op();
@@ -551,25 +591,96 @@ void Multigrid::generate()
     }
     // Generate at least one level
     GKO_ASSERT_EQ(level > 0, true);
-    auto last_mg_level = mg_level_list_.back();
+    this->generate_coarsest_solver(level, mg_level_list_.back());
+}
+
+
+void Multigrid::update_values(std::shared_ptr<const LinOp> new_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this->get_system_matrix(), new_matrix);
+    this->set_system_matrix(new_matrix);
+    pre_smoother_list_.clear();
+    mid_smoother_list_.clear();
+    post_smoother_list_.clear();
+    auto matrix = this->get_system_matrix();
+    for (size_type level = 0; level < mg_level_list_.size(); level++) {
+        auto index = level_selector_(level, matrix.get());
+        GKO_ENSURE_IN_BOUNDS(index, parameters_.mg_level.size());
+        // update a copy, since the levels may be shared with copies of this
+        // solver. The transfer operators are shared between both copies.
+        auto mg_level = as<gko::multigrid::MultigridLevel>(share(
+            as<PolymorphicObject>(mg_level_list_.at(level))->clone()));
+        mg_level->update_values(matrix);
+
+        this->generate_smoothers(index, mg_level);
+
+        mg_level_list_.at(level) = mg_level;
+        matrix = mg_level->get_coarse_op();
+    }
+    if (parameters_.post_uses_pre) {
+        post_smoother_list_ = pre_smoother_list_;
+    }
+    this->generate_coarsest_solver(mg_level_list_.size(),
+                                   mg_level_list_.back());
+}
 
-    // generate coarsest solver
+
+void Multigrid::generate_smoothers(
+    size_type index,
+    std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level)
+{
+    run<gko::multigrid::EnableMultigridLevel, float, double,
+        std::complex<float>, std::complex<double>>(
+        mg_level,
+        [this](auto mg_level, auto index, auto matrix) {
+            using value_type =
+                typename std::decay_t<decltype(*mg_level)>::value_type;
+            handle_list<value_type>(
+                index, matrix, parameters_.pre_smoother, pre_smoother_list_,
+                parameters_.smoother_iters, parameters_.smoother_relax);
+            if (parameters_.mid_case ==
+                multigrid::mid_smooth_type::standalone) {
+                handle_list<value_type>(
+                    index, matrix, parameters_.mid_smoother,
+                    mid_smoother_list_, parameters_.smoother_iters,
+                    parameters_.smoother_relax);
+            }
+            if (!parameters_.post_uses_pre) {
+                handle_list<value_type>(
+                    index, matrix, parameters_.post_smoother,
+                    post_smoother_list_, parameters_.smoother_iters,
+                    parameters_.smoother_relax);
+            }
+        },
+        index, mg_level->get_fine_op());
+}
+
+
+void Multigrid::generate_coarsest_solver(
+    size_type level,
+    std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level)
+{
     run<gko::multigrid::EnableMultigridLevel, float, double,
         std::complex<float>, std::complex<double>>(
-        last_mg_level,
+        mg_level,
         [this](auto mg_level, auto level, auto matrix) {
             using value_type =
                 typename std::decay_t<decltype(*mg_level)>::value_type;
             auto exec = this->get_executor();
-            // default coarse grid solver, direct LU
+            // default coarse grid solver, direct LU. On distributed matrices,
+            // it is applied to the local matrix of each rank, which is exact
+            // if the coarse matrix is agglomerated onto a single rank.
             // TODO: maybe remove fixed index type
             auto gen_default_solver = [&] {
-                return experimental::solver::Direct<value_type, int32>::build()
-                    .with_factorization(
-                        experimental::factorization::Lu<value_type,
+                return wrap_for_distributed<value_type>(
+                           matrix.get(),
+                           experimental::solver::Direct<value_type,
                                                         int32>::build()
-                            .on(exec))
-                    .on(exec)
+                               .with_factorization(
+                                   experimental::factorization::Lu<
+                                       value_type, int32>::build()
+                                       .on(exec))
+                               .on(exec))
                     ->generate(matrix);
             };
             if (parameters_.coarsest_solver.size() == 0) {
@@ -586,7 +697,7 @@ void Multigrid::generate()
                 }
             }
         },
-        level, matrix);
+        level, mg_level->get_coarse_op());
 }
 
 
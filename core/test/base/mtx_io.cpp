@@ -597,6 +597,55 @@ TEST(MtxReader, ReadsComplexBinary)
 }
 
 
+TEST(MtxReader, ReadsBinaryRows)
+{
+    gko::matrix_data<double, gko::int64> orig_data{
+        gko::dim<2>{6, 4},
+        {{0, 1, 1.0}, {1, 0, 2.0}, {1, 3, 3.0}, {3, 2, 4.0}, {4, 0, 5.0}}};
+    std::stringstream ss;
+    gko::write_binary_raw(ss, orig_data);
+
+    auto data = gko::read_binary_raw_rows<float, gko::int32>(ss, 1, 4);
+
+    ASSERT_EQ(data.size, gko::dim<2>(6, 4));
+    ASSERT_EQ(data.nonzeros.size(), 3);
+    ASSERT_EQ(data.nonzeros[0].row, 1);
+    ASSERT_EQ(data.nonzeros[1].row, 1);
+    ASSERT_EQ(data.nonzeros[2].row, 3);
+    ASSERT_EQ(data.nonzeros[0].column, 0);
+    ASSERT_EQ(data.nonzeros[1].column, 3);
+    ASSERT_EQ(data.nonzeros[2].column, 2);
+    ASSERT_EQ(data.nonzeros[0].value, 2.0f);
+    ASSERT_EQ(data.nonzeros[1].value, 3.0f);
+    ASSERT_EQ(data.nonzeros[2].value, 4.0f);
+}
+
+
+TEST(MtxReader, ReadsEmptyBinaryRows)
+{
+    gko::matrix_data<double, gko::int32> orig_data{
+        gko::dim<2>{6, 4}, {{0, 1, 1.0}, {4, 0, 5.0}}};
+    std::stringstream ss;
+    gko::write_binary_raw(ss, orig_data);
+
+    auto data = gko::read_binary_raw_rows<double, gko::int32>(ss, 1, 4);
+
+    ASSERT_EQ(data.size, gko::dim<2>(6, 4));
+    ASSERT_EQ(data.nonzeros.size(), 0);
+}
+
+
+TEST(MtxReader, ReadBinaryRowsFailsForUnsortedData)
+{
+    auto raw_data = build_binary_real_data();
+    std::stringstream ss{std::string{reinterpret_cast<char*>(raw_data.data()),
+                                     raw_data.size() * sizeof(gko::uint64)}};
+
+    ASSERT_THROW((gko::read_binary_raw_rows<double, gko::int32>(ss, 0, 1)),
+                 gko::StreamError);
+}
+
+
 TEST(MtxReader, ReadsGenericBinary)
 {
     auto raw_data = build_binary_real_data();
@@ -30,7 +30,9 @@ THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************<GINKGO LICENSE>*******************************/
 
+#include <array>
 #include <memory>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -1450,6 +1452,77 @@ TYPED_TEST(MpiBindings, NonBlockingAllToAllVWorksCorrectly)
 }
 
 
+TYPED_TEST(MpiBindings, NeighborAllToAllVWorksCorrectly)
+{
+    auto world = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = world.rank();
+    auto num_ranks = world.size();
+    auto prev = (my_rank + num_ranks - 1) % num_ranks;
+    auto next = (my_rank + 1) % num_ranks;
+    // every rank sends one value to its successor and two values to its
+    // predecessor, and receives in the opposite order
+    auto comm = gko::experimental::mpi::communicator(
+        world, std::vector<int>{next, prev}, std::vector<int>{prev, next});
+    auto send_array = gko::array<TypeParam>{
+        this->ref,
+        I<TypeParam>{static_cast<TypeParam>(my_rank),
+                     static_cast<TypeParam>(my_rank + 1),
+                     static_cast<TypeParam>(my_rank + 2)}};
+    auto recv_array = gko::array<TypeParam>{this->ref, 3};
+    auto ref_array = gko::array<TypeParam>{
+        this->ref,
+        I<TypeParam>{static_cast<TypeParam>(next),
+                     static_cast<TypeParam>(next + 1),
+                     static_cast<TypeParam>(prev + 2)}};
+    std::array<int, 2> scounts{2, 1};
+    std::array<int, 2> soffsets{0, 2};
+    std::array<int, 2> rcounts{2, 1};
+    std::array<int, 2> roffsets{0, 2};
+
+    comm.neighbor_all_to_all_v(
+        this->ref, send_array.get_const_data(), scounts.data(),
+        soffsets.data(), recv_array.get_data(), rcounts.data(),
+        roffsets.data());
+
+    GKO_ASSERT_ARRAY_EQ(recv_array, ref_array);
+}
+
+
+TYPED_TEST(MpiBindings, NonBlockingNeighborAllToAllVWorksCorrectly)
+{
+    auto world = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = world.rank();
+    auto num_ranks = world.size();
+    auto prev = (my_rank + num_ranks - 1) % num_ranks;
+    auto next = (my_rank + 1) % num_ranks;
+    auto comm = gko::experimental::mpi::communicator(
+        world, std::vector<int>{next, prev}, std::vector<int>{prev, next});
+    auto send_array = gko::array<TypeParam>{
+        this->ref,
+        I<TypeParam>{static_cast<TypeParam>(my_rank),
+                     static_cast<TypeParam>(my_rank + 1),
+                     static_cast<TypeParam>(my_rank + 2)}};
+    auto recv_array = gko::array<TypeParam>{this->ref, 3};
+    auto ref_array = gko::array<TypeParam>{
+        this->ref,
+        I<TypeParam>{static_cast<TypeParam>(next),
+                     static_cast<TypeParam>(next + 1),
+                     static_cast<TypeParam>(prev + 2)}};
+    std::array<int, 2> scounts{2, 1};
+    std::array<int, 2> soffsets{0, 2};
+    std::array<int, 2> rcounts{2, 1};
+    std::array<int, 2> roffsets{0, 2};
+
+    auto req = comm.i_neighbor_all_to_all_v(
+        this->ref, send_array.get_const_data(), scounts.data(),
+        soffsets.data(), recv_array.get_data(), rcounts.data(),
+        roffsets.data());
+
+    req.wait();
+    GKO_ASSERT_ARRAY_EQ(recv_array, ref_array);
+}
+
+
 TYPED_TEST(MpiBindings, CanScanValues)
 {
     auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
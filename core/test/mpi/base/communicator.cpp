@@ -30,6 +30,9 @@ THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************<GINKGO LICENSE>*******************************/
 
+#include <vector>
+
+
 #include <mpi.h>
 
 
@@ -141,4 +144,26 @@ TEST_F(Communicator, CanSetCustomCommunicator)
 }
 
 
+TEST_F(Communicator, CanCreateNeighborhoodCommunicator)
+{
+    auto world_rank = comm.rank();
+    auto world_size = comm.size();
+    std::vector<int> sources{(world_rank + world_size - 1) % world_size};
+    std::vector<int> destinations{(world_rank + 1) % world_size};
+
+    auto graph_comm =
+        gko::experimental::mpi::communicator(comm, sources, destinations);
+
+    int indegree;
+    int outdegree;
+    int weighted;
+    MPI_Dist_graph_neighbors_count(graph_comm.get(), &indegree, &outdegree,
+                                   &weighted);
+    ASSERT_EQ(graph_comm.rank(), world_rank);
+    ASSERT_EQ(graph_comm.size(), world_size);
+    ASSERT_EQ(indegree, 1);
+    ASSERT_EQ(outdegree, 1);
+}
+
+
 }  // namespace
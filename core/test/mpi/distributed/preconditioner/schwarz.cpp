@@ -110,6 +110,29 @@ TYPED_TEST(SchwarzFactory, CanSetLocalFactory)
 }
 
 
+TYPED_TEST(SchwarzFactory, DefaultsToNoOverlapAndNoCoarseCorrection)
+{
+    ASSERT_EQ(this->schwarz->get_parameters().overlap, 0u);
+    ASSERT_FALSE(this->schwarz->get_parameters().coarse_correction);
+    ASSERT_EQ(this->schwarz->get_parameters().coarse_space, nullptr);
+}
+
+
+TYPED_TEST(SchwarzFactory, CanSetOverlapAndCoarseCorrection)
+{
+    using Schwarz = typename TestFixture::Schwarz;
+
+    auto factory = Schwarz::build()
+                       .with_local_solver_factory(this->jacobi_factory)
+                       .with_overlap(2u)
+                       .with_coarse_correction(true)
+                       .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().overlap, 2u);
+    ASSERT_TRUE(factory->get_parameters().coarse_correction);
+}
+
+
 TYPED_TEST(SchwarzFactory, CanBeCloned)
 {
     auto schwarz_clone = clone(this->schwarz);
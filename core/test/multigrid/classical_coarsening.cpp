@@ -0,0 +1,103 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/multigrid/classical_coarsening.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class ClassicalCoarseningFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using MgLevel = gko::multigrid::ClassicalCoarsening<value_type, index_type>;
+    ClassicalCoarseningFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          rs_factory(MgLevel::build()
+                         .with_strength_threshold(0.5)
+                         .with_skip_sorting(true)
+                         .on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename MgLevel::Factory> rs_factory;
+};
+
+TYPED_TEST_SUITE(ClassicalCoarseningFactory, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ClassicalCoarseningFactory, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->rs_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(ClassicalCoarseningFactory, DefaultSetting)
+{
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().strength_threshold, 0.25);
+    ASSERT_EQ(factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(ClassicalCoarseningFactory, SetStrengthThreshold)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().strength_threshold, 0.5);
+}
+
+
+TYPED_TEST(ClassicalCoarseningFactory, SetSkipSorting)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().skip_sorting, true);
+}
+
+
+}  // namespace
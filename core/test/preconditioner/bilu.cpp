@@ -0,0 +1,107 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/bilu.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BiluFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Bilu = gko::preconditioner::Bilu<value_type, index_type>;
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+
+    BiluFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          bilu_factory(Bilu::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename Bilu::Factory> bilu_factory;
+};
+
+TYPED_TEST_SUITE(BiluFactory, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BiluFactory, KnowsItsExecutor)
+{
+    ASSERT_EQ(this->bilu_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(BiluFactory, SetsDefaultSkipSortingCorrectly)
+{
+    ASSERT_EQ(this->bilu_factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(BiluFactory, SetsSkipSortingCorrectly)
+{
+    using Bilu = typename TestFixture::Bilu;
+
+    auto factory = Bilu::build().with_skip_sorting(true).on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().skip_sorting, true);
+}
+
+
+TYPED_TEST(BiluFactory, ThrowsOnRectangularMatrix)
+{
+    using Fbcsr = typename TestFixture::Fbcsr;
+    auto mtx = gko::share(Fbcsr::create(this->exec, gko::dim<2>{4, 2}, 0, 2));
+
+    ASSERT_THROW(this->bilu_factory->generate(mtx), gko::DimensionMismatch);
+}
+
+
+}  // namespace
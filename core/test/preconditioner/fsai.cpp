@@ -0,0 +1,137 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/fsai.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class FsaiFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Fsai = gko::preconditioner::Fsai<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    FsaiFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          fsai_factory(Fsai::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename Fsai::Factory> fsai_factory;
+};
+
+TYPED_TEST_SUITE(FsaiFactory, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(FsaiFactory, KnowsItsExecutor)
+{
+    ASSERT_EQ(this->fsai_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(FsaiFactory, SetsDefaultSkipSortingCorrectly)
+{
+    ASSERT_EQ(this->fsai_factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(FsaiFactory, SetsSkipSortingCorrectly)
+{
+    using Fsai = typename TestFixture::Fsai;
+
+    auto factory = Fsai::build().with_skip_sorting(true).on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().skip_sorting, true);
+}
+
+
+TYPED_TEST(FsaiFactory, SetsDefaultStepsCorrectly)
+{
+    ASSERT_EQ(this->fsai_factory->get_parameters().steps, 5u);
+    ASSERT_EQ(this->fsai_factory->get_parameters().step_size, 2u);
+}
+
+
+TYPED_TEST(FsaiFactory, SetsStepsCorrectly)
+{
+    using Fsai = typename TestFixture::Fsai;
+
+    auto factory =
+        Fsai::build().with_steps(3u).with_step_size(4u).on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().steps, 3u);
+    ASSERT_EQ(factory->get_parameters().step_size, 4u);
+}
+
+
+TYPED_TEST(FsaiFactory, SetsToleranceCorrectly)
+{
+    using Fsai = typename TestFixture::Fsai;
+
+    auto factory = Fsai::build().with_tolerance(1e-1).on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().tolerance,
+              gko::remove_complex<typename TestFixture::value_type>{1e-1});
+}
+
+
+TYPED_TEST(FsaiFactory, ThrowsOnRectangularMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(Csr::create(this->exec, gko::dim<2>{4, 2}));
+
+    ASSERT_THROW(this->fsai_factory->generate(mtx), gko::DimensionMismatch);
+}
+
+
+}  // namespace
@@ -0,0 +1,133 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/preconditioner/sor.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SorFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using sor_type = gko::preconditioner::Sor<value_type, index_type>;
+    using l_solver_type = gko::solver::LowerTrs<value_type, index_type>;
+    using u_solver_type = gko::solver::UpperTrs<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    SorFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          l_factory(l_solver_type::build().on(exec)),
+          u_factory(u_solver_type::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<typename l_solver_type::Factory> l_factory;
+    std::shared_ptr<typename u_solver_type::Factory> u_factory;
+};
+
+TYPED_TEST_SUITE(SorFactory, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SorFactory, KnowsItsExecutor)
+{
+    auto factory = TestFixture::sor_type::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(SorFactory, CanDefaultBuild)
+{
+    using value_type = typename TestFixture::value_type;
+    auto factory = TestFixture::sor_type::build().on(this->exec);
+
+    auto params = factory->get_parameters();
+    ASSERT_EQ(params.skip_sorting, false);
+    ASSERT_EQ(params.symmetric, false);
+    ASSERT_EQ(params.relaxation_factor, gko::remove_complex<value_type>(1.2));
+    ASSERT_EQ(params.l_solver, nullptr);
+    ASSERT_EQ(params.u_solver, nullptr);
+}
+
+
+TYPED_TEST(SorFactory, CanBuildWithParameters)
+{
+    using value_type = typename TestFixture::value_type;
+    auto factory = TestFixture::sor_type::build()
+                       .with_skip_sorting(true)
+                       .with_symmetric(true)
+                       .with_relaxation_factor(0.5)
+                       .with_l_solver(this->l_factory)
+                       .with_u_solver(this->u_factory)
+                       .on(this->exec);
+
+    auto params = factory->get_parameters();
+    ASSERT_EQ(params.skip_sorting, true);
+    ASSERT_EQ(params.symmetric, true);
+    ASSERT_EQ(params.relaxation_factor, gko::remove_complex<value_type>(0.5));
+    ASSERT_EQ(params.l_solver, this->l_factory);
+    ASSERT_EQ(params.u_solver, this->u_factory);
+}
+
+
+TYPED_TEST(SorFactory, ThrowsOnRectangularMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto factory = TestFixture::sor_type::build().on(this->exec);
+
+    ASSERT_THROW(factory->generate(
+                     gko::share(Csr::create(this->exec, gko::dim<2>{1, 2}))),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
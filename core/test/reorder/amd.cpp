@@ -0,0 +1,97 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/amd.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Amd : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = int;
+    using reorder_type =
+        gko::experimental::reorder::Amd<value_type, index_type>;
+
+    Amd()
+        : exec(gko::ReferenceExecutor::create()),
+          amd_factory(reorder_type::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<reorder_type> amd_factory;
+};
+
+
+TEST_F(Amd, KnowsItsExecutor)
+{
+    ASSERT_EQ(this->amd_factory->get_executor(), this->exec);
+}
+
+
+TEST_F(Amd, HasDefaultParameters)
+{
+    auto& params = this->amd_factory->get_parameters();
+
+    ASSERT_FALSE(params.symmetric_sparsity);
+    ASSERT_EQ(params.dense_threshold, 10.0);
+}
+
+
+TEST_F(Amd, PassesParameters)
+{
+    auto factory = reorder_type::build()
+                       .with_symmetric_sparsity(true)
+                       .with_dense_threshold(2.0)
+                       .on(this->exec);
+
+    auto& params = factory->get_parameters();
+
+    ASSERT_TRUE(params.symmetric_sparsity);
+    ASSERT_EQ(params.dense_threshold, 2.0);
+}
+
+
+}  // namespace
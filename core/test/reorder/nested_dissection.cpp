@@ -68,4 +68,22 @@ TEST_F(NestedDissection, KnowsItsExecutor)
     ASSERT_EQ(this->nd_factory->get_executor(), this->exec);
 }
 
+TEST_F(NestedDissection, HasSensibleDefaults)
+{
+    ASSERT_TRUE(this->nd_factory->get_parameters().use_metis);
+    ASSERT_EQ(this->nd_factory->get_parameters().max_leaf_size, 64);
+    ASSERT_TRUE(this->nd_factory->get_parameters().options.empty());
+}
+
+TEST_F(NestedDissection, CanSetParameters)
+{
+    auto factory = reorder_type::build()
+                       .with_use_metis(false)
+                       .with_max_leaf_size(16u)
+                       .on(this->exec);
+
+    ASSERT_FALSE(factory->get_parameters().use_metis);
+    ASSERT_EQ(factory->get_parameters().max_leaf_size, 16);
+}
+
 }  // namespace
@@ -0,0 +1,291 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/chebyshev.hpp>
+
+
+#include <typeinfo>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Chebyshev : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Chebyshev<value_type>;
+
+    Chebyshev()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          chebyshev_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(3u).on(exec),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value)
+                          .on(exec))
+                  .with_foci(value_type{0.5}, value_type{3.5})
+                  .on(exec)),
+          solver(chebyshev_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<typename Solver::Factory> chebyshev_factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+TYPED_TEST_SUITE(Chebyshev, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Chebyshev, ChebyshevFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->chebyshev_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(Chebyshev, ChebyshevFactoryCreatesCorrectSolver)
+{
+    using Solver = typename TestFixture::Solver;
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    auto chebyshev_solver = static_cast<Solver*>(this->solver.get());
+    ASSERT_NE(chebyshev_solver->get_system_matrix(), nullptr);
+    ASSERT_EQ(chebyshev_solver->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto copy = this->chebyshev_factory->generate(Mtx::create(this->exec));
+
+    copy->copy_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = static_cast<Solver*>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+    ASSERT_EQ(static_cast<Solver*>(copy.get())->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto copy = this->chebyshev_factory->generate(Mtx::create(this->exec));
+
+    copy->move_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = static_cast<Solver*>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+    ASSERT_EQ(static_cast<Solver*>(copy.get())->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto clone = this->solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(3, 3));
+    auto clone_mtx = static_cast<Solver*>(clone.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(clone_mtx), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCleared)
+{
+    using Solver = typename TestFixture::Solver;
+    this->solver->clear();
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(0, 0));
+    auto solver_mtx =
+        static_cast<Solver*>(this->solver.get())->get_system_matrix();
+    ASSERT_EQ(solver_mtx, nullptr);
+}
+
+
+TYPED_TEST(Chebyshev, DefaultApplyUsesInitialGuess)
+{
+    ASSERT_TRUE(this->solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(Chebyshev, CanSetApplyWithInitialGuessMode)
+{
+    using Solver = typename TestFixture::Solver;
+    using initial_guess_mode = gko::solver::initial_guess_mode;
+    for (auto guess : {initial_guess_mode::provided, initial_guess_mode::rhs,
+                       initial_guess_mode::zero}) {
+        auto chebyshev_factory =
+            Solver::build()
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(3u).on(
+                        this->exec))
+                .with_default_initial_guess(guess)
+                .on(this->exec);
+        auto solver = chebyshev_factory->generate(this->mtx);
+
+        ASSERT_EQ(solver->apply_uses_initial_guess(),
+                  guess == gko::solver::initial_guess_mode::provided);
+    }
+}
+
+
+TYPED_TEST(Chebyshev, CanSetPreconditionerInFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    std::shared_ptr<gko::preconditioner::Jacobi<value_type>> jacobi =
+        gko::preconditioner::Jacobi<value_type>::build()
+            .with_max_block_size(1u)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto chebyshev_factory =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_generated_preconditioner(jacobi)
+            .on(this->exec);
+    auto solver = chebyshev_factory->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_preconditioner().get(), jacobi.get());
+}
+
+
+TYPED_TEST(Chebyshev, UsesFociFromFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+
+    auto solver = gko::as<Solver>(this->solver.get());
+
+    ASSERT_EQ(solver->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, EstimatesFociIfNotProvided)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    // the eigenvalues are 2 - sqrt(2), 2 and 2 + sqrt(2), so the Lanczos
+    // process recovers the largest one exactly after three steps
+    const auto max_eigenvalue = 2 + std::sqrt(2.0);
+
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_estimation_iters(3u)
+            .with_estimate_lower_factor(0.5)
+            .with_estimate_upper_factor(1.0)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto foci = solver->get_foci();
+    GKO_EXPECT_NEAR(foci.first, value_type(0.5 * max_eigenvalue),
+                    r<value_type>::value * 1e1);
+    GKO_EXPECT_NEAR(foci.second, value_type(max_eigenvalue),
+                    r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, ThrowsOnFociEstimationForIndefiniteMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Mtx> indefinite_mtx = gko::initialize<Mtx>(
+        {{-2, 1.0, 0.0}, {1.0, -2, 1.0}, {0.0, 1.0, -2}}, this->exec);
+
+    ASSERT_THROW(
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .on(this->exec)
+            ->generate(indefinite_mtx),
+        gko::UnsupportedMatrixProperty);
+}
+
+
+TYPED_TEST(Chebyshev, TransposeKeepsFoci)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+
+    auto transposed = gko::as<Solver>(
+        gko::as<gko::Transposable>(this->solver.get())->transpose());
+
+    ASSERT_EQ(transposed->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, ThrowsOnRectangularMatrixInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    std::shared_ptr<Mtx> rectangular_mtx =
+        Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    ASSERT_THROW(this->chebyshev_factory->generate(rectangular_mtx),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
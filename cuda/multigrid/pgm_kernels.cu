@@ -47,9 +47,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include "core/components/format_conversion_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
 #include "cuda/base/thrust.cuh"
 #include "cuda/base/types.hpp"
 
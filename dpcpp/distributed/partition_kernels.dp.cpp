@@ -54,6 +54,16 @@ GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(
     GKO_DECLARE_PARTITION_BUILD_STARTING_INDICES);
 
 
+template <typename IndexType>
+void compute_graph_mapping(std::shared_ptr<const DefaultExecutor> exec,
+                           IndexType num_vertices, const IndexType* row_ptrs,
+                           const IndexType* col_idxs, comm_index_type num_parts,
+                           double imbalance,
+                           comm_index_type* mapping) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_PARTITION_COMPUTE_GRAPH_MAPPING);
+
+
 }  // namespace partition
 }  // namespace dpcpp
 }  // namespace kernels
@@ -55,6 +55,26 @@ namespace dpcpp {
 namespace lu_factorization {
 
 
+template <typename IndexType>
+void symbolic_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                        const IndexType* row_ptrs, const IndexType* col_idxs,
+                        size_type num_rows, IndexType* out_row_ptrs,
+                        array<IndexType>& out_col_idxs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_LU_SYMBOLIC_FACTORIZE);
+
+
+template <typename IndexType>
+void symbolic_factorize_fill_level(
+    std::shared_ptr<const DefaultExecutor> exec, const IndexType* row_ptrs,
+    const IndexType* col_idxs, size_type num_rows, size_type fill_level,
+    IndexType* out_row_ptrs,
+    array<IndexType>& out_col_idxs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL);
+
+
 template <typename ValueType, typename IndexType>
 void initialize(std::shared_ptr<const DefaultExecutor> exec,
                 const matrix::Csr<ValueType, IndexType>* mtx,
@@ -70,7 +90,7 @@ template <typename ValueType, typename IndexType>
 void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
                const int32* lookup_storage, const IndexType* diag_idxs,
-               matrix::Csr<ValueType, IndexType>* factors,
+               matrix::Csr<ValueType, IndexType>* factors, bool checked_lookup,
                array<int>& tmp_storage) GKO_NOT_IMPLEMENTED;
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_FACTORIZE);
@@ -45,9 +45,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include "core/components/format_conversion_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace dpcpp {
@@ -128,6 +134,49 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine_csr,
+                        const IndexType* agg, const IndexType* agg_ptrs,
+                        const IndexType* agg_rows,
+                        matrix::Csr<ValueType, IndexType>* coarse_csr)
+{
+    // instead of accumulating row-wise over the aggregates, all fine entries
+    // are sorted by their coarse position and reduced
+    const auto nnz = fine_csr->get_num_stored_elements();
+    const auto num_agg = coarse_csr->get_size()[0];
+    array<IndexType> row_idxs{exec, nnz};
+    array<IndexType> col_idxs{exec, nnz};
+    array<ValueType> vals{exec, nnz};
+    exec->copy(nnz, fine_csr->get_const_values(), vals.get_data());
+    map_row(exec, fine_csr->get_size()[0], fine_csr->get_const_row_ptrs(), agg,
+            row_idxs.get_data());
+    map_col(exec, nnz, fine_csr->get_const_col_idxs(), agg,
+            col_idxs.get_data());
+    sort_row_major(exec, nnz, row_idxs.get_data(), col_idxs.get_data(),
+                   vals.get_data());
+    size_type coarse_nnz{};
+    count_unrepeated_nnz(exec, nnz, row_idxs.get_const_data(),
+                         col_idxs.get_const_data(), &coarse_nnz);
+    auto coarse_coo = matrix::Coo<ValueType, IndexType>::create(
+        exec, coarse_csr->get_size(), coarse_nnz);
+    compute_coarse_coo(exec, nnz, row_idxs.get_const_data(),
+                       col_idxs.get_const_data(), vals.get_const_data(),
+                       coarse_coo.get());
+    components::convert_idxs_to_ptrs(exec, coarse_coo->get_const_row_idxs(),
+                                     coarse_nnz, num_agg,
+                                     coarse_csr->get_row_ptrs());
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse_csr};
+    builder.get_col_idx_array() =
+        make_array_view(exec, coarse_nnz, coarse_coo->get_col_idxs());
+    builder.get_value_array() =
+        make_array_view(exec, coarse_nnz, coarse_coo->get_values());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace dpcpp
 }  // namespace kernels
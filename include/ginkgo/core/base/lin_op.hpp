@@ -850,6 +850,34 @@ private:
 };
 
 
+/**
+ * Linear operators which store a factorization of a system matrix and can
+ * recompute it for a new system matrix with the same sparsity pattern. The
+ * symbolic information, lookup structures and storage of the existing
+ * factorization are reused, only the numerical values are recomputed.
+ *
+ * @ingroup LinOp
+ */
+class Refactorizable {
+public:
+    virtual ~Refactorizable() = default;
+
+    /**
+     * Recomputes the factorization for a new system matrix.
+     *
+     * @param new_matrix  the new system matrix. It needs to have the same
+     *                    size and sparsity pattern as the matrix the
+     *                    factorization was generated from.
+     *
+     * @note The values of the factors are overwritten in-place, so all
+     *       objects sharing the factors with this object, e.g. shallow
+     *       copies or triangular solvers generated from them, observe the
+     *       new values.
+     */
+    virtual void refactorize(std::shared_ptr<const LinOp> new_matrix) = 0;
+};
+
+
 /**
  * The EnableLinOp mixin can be used to provide sensible default implementations
  * of the majority of the LinOp and PolymorphicObject interface.
@@ -37,6 +37,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 
 #include <ginkgo/config.hpp>
@@ -482,6 +483,30 @@ public:
         this->comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
     }
 
+    /**
+     * Create a distributed graph communicator from an existing communicator
+     * object (MPI_Dist_graph_create_adjacent). Each rank only communicates
+     * with its given neighbors in the neighborhood collectives of the new
+     * communicator. The ranks are not reordered, so the ranks of the new
+     * communicator are the same as in the original communicator.
+     *
+     * @param comm  The input communicator object.
+     * @param sources  The ranks this rank receives data from
+     * @param destinations  The ranks this rank sends data to
+     */
+    communicator(const communicator& comm, const std::vector<int>& sources,
+                 const std::vector<int>& destinations)
+        : force_host_buffer_(comm.force_host_buffer())
+    {
+        MPI_Comm comm_out;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Dist_graph_create_adjacent(
+            comm.get(), static_cast<int>(sources.size()), sources.data(),
+            MPI_UNWEIGHTED, static_cast<int>(destinations.size()),
+            destinations.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false,
+            &comm_out));
+        this->comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
+    }
+
     /**
      * Return the underlying MPI_Comm object.
      *
@@ -512,6 +537,23 @@ public:
      */
     int node_local_rank() const { return get_node_local_rank(); };
 
+    /**
+     * Creates a communicator of the ranks of this communicator that can share
+     * memory, i.e. that are located on the same node (MPI_Comm_split_type with
+     * MPI_COMM_TYPE_SHARED). The ranks keep their relative order. This is a
+     * collective operation.
+     *
+     * @return  the node-local communicator
+     */
+    communicator create_node_local_communicator() const
+    {
+        MPI_Comm local_comm;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Comm_split(this->get(), this->rank() / 2, 0, &local_comm));
+        communicator result{local_comm, force_host_buffer_};
+        result.comm_.reset(new MPI_Comm(local_comm), comm_deleter{});
+        return result;
+    }
+
     /**
      * Compare two communicator objects for equality.
      *
@@ -1415,6 +1457,142 @@ public:
             recv_offsets, type_impl<RecvType>::get_type());
     }
 
+    /**
+     * Communicate data from each rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Neighbor_alltoallv). See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     *
+     * @note The counts and offsets are ordered like the sources and
+     *       destinations the graph communicator was created with.
+     */
+    void neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                               const void* send_buffer, const int* send_counts,
+                               const int* send_offsets, MPI_Datatype send_type,
+                               void* recv_buffer, const int* recv_counts,
+                               const int* recv_offsets,
+                               MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Neighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get()));
+    }
+
+    /**
+     * Communicate data from each rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Neighbor_alltoallv). See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     *
+     * @tparam SendType  the type of the data to send. Has to be a type which
+     *                   has a specialization of type_impl that defines its
+     *                   MPI_Datatype.
+     * @tparam RecvType  the type of the data to receive. The same restrictions
+     *                   as for SendType apply.
+     */
+    template <typename SendType, typename RecvType>
+    void neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                               const SendType* send_buffer,
+                               const int* send_counts, const int* send_offsets,
+                               RecvType* recv_buffer, const int* recv_counts,
+                               const int* recv_offsets) const
+    {
+        this->neighbor_all_to_all_v(
+            std::move(exec), send_buffer, send_counts, send_offsets,
+            type_impl<SendType>::get_type(), recv_buffer, recv_counts,
+            recv_offsets, type_impl<RecvType>::get_type());
+    }
+
+    /**
+     * Communicate data from each rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Ineighbor_alltoallv). See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     *
+     * @return  the request handle for the call
+     *
+     * @note The counts and offsets are ordered like the sources and
+     *       destinations the graph communicator was created with.
+     */
+    request i_neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                                    const void* send_buffer,
+                                    const int* send_counts,
+                                    const int* send_offsets,
+                                    MPI_Datatype send_type, void* recv_buffer,
+                                    const int* recv_counts,
+                                    const int* recv_offsets,
+                                    MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        request req;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Ineighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get(), req.get()));
+        return req;
+    }
+
+    /**
+     * Communicate data from each rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Ineighbor_alltoallv). See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     *
+     * @tparam SendType  the type of the data to send. Has to be a type which
+     *                   has a specialization of type_impl that defines its
+     *                   MPI_Datatype.
+     * @tparam RecvType  the type of the data to receive. The same restrictions
+     *                   as for SendType apply.
+     *
+     * @return  the request handle for the call
+     */
+    template <typename SendType, typename RecvType>
+    request i_neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                                    const SendType* send_buffer,
+                                    const int* send_counts,
+                                    const int* send_offsets,
+                                    RecvType* recv_buffer,
+                                    const int* recv_counts,
+                                    const int* recv_offsets) const
+    {
+        return this->i_neighbor_all_to_all_v(
+            std::move(exec), send_buffer, send_counts, send_offsets,
+            type_impl<SendType>::get_type(), recv_buffer, recv_counts,
+            recv_offsets, type_impl<RecvType>::get_type());
+    }
+
     /**
      * Does a scan operation with the given operator.
      * (MPI_Scan). See MPI documentation for more details.
@@ -1536,7 +1714,12 @@ public:
     /**
      * The create type for the window object.
      */
-    enum class create_type { allocate = 1, create = 2, dynamic_create = 3 };
+    enum class create_type {
+        allocate = 1,
+        create = 2,
+        dynamic_create = 3,
+        allocate_shared = 4
+    };
 
     /**
      * The lock type for passive target synchronization of the windows.
@@ -1569,7 +1752,13 @@ public:
      */
     window& operator=(window&& other)
     {
-        window_ = std::exchange(other.window_, MPI_WIN_NULL);
+        if (this != &other) {
+            if (this->window_ != MPI_WIN_NULL) {
+                MPI_Win_free(&this->window_);
+            }
+            window_ = std::exchange(other.window_, MPI_WIN_NULL);
+        }
+        return *this;
     }
 
     /**
@@ -1605,6 +1794,67 @@ public:
         }
     }
 
+    /**
+     * Create a window object that allocates its own memory. A collective
+     * operation.
+     *
+     * With create_type::allocate_shared, the memory is shared by all ranks of
+     * comm (MPI_Win_allocate_shared), which then need to be located on the
+     * same node, see communicator::create_node_local_communicator. The
+     * segments of the ranks are contiguous in memory, ordered by rank, and can
+     * be accessed directly through get_shared_base.
+     *
+     * @param exec  The executor, on which the memory is allocated. For shared
+     *              windows, this needs to be a host executor.
+     * @param num_elems  the number of elements of type ValueType in the
+     *                   segment of this rank.
+     * @param comm  the communicator whose ranks will have windows created.
+     * @param c_type  the type of creation method to use to create the window,
+     *                either create_type::allocate or
+     *                create_type::allocate_shared.
+     * @param input_info  the MPI_Info object used to set certain properties.
+     */
+    window(std::shared_ptr<const Executor> exec, int num_elems,
+           const communicator& comm, create_type c_type,
+           MPI_Info input_info = MPI_INFO_NULL)
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        const auto size = static_cast<MPI_Aint>(num_elems) * sizeof(ValueType);
+        ValueType* base = nullptr;
+        if (c_type == create_type::allocate) {
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_Win_allocate(size, sizeof(ValueType),
+                                                      input_info, comm.get(),
+                                                      &base, &this->window_));
+        } else if (c_type == create_type::allocate_shared) {
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_Win_allocate_shared(
+                size, sizeof(ValueType), input_info, comm.get(), &base,
+                &this->window_));
+        } else {
+            GKO_NOT_IMPLEMENTED;
+        }
+    }
+
+    /**
+     * Get the base pointer of the segment of a rank in a window allocated
+     * with create_type::allocate_shared (MPI_Win_shared_query).
+     *
+     * @param rank  the rank whose segment is queried. For MPI_PROC_NULL, the
+     *              segment of the lowest rank with a non-empty segment is
+     *              returned.
+     *
+     * @return  the base pointer of the segment, which can be accessed
+     *          directly by all ranks of the window.
+     */
+    ValueType* get_shared_base(int rank) const
+    {
+        MPI_Aint size;
+        int disp_unit;
+        ValueType* base = nullptr;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Win_shared_query(
+            this->window_, rank, &size, &disp_unit, &base));
+        return base;
+    }
+
     /**
      * Get the underlying window object of MPI_Win type.
      *
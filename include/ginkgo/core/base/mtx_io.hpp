@@ -96,6 +96,32 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_binary_raw(std::istream& is);
 
 
+/**
+ * Reads the rows [row_begin, row_end) of a matrix stored in Ginkgo's binary
+ * matrix format (see gko::read_binary_raw) from an input stream.
+ * The entries in the stream need to be sorted by row index, as written by
+ * gko::write_binary_raw for data in row-major order. Apart from the header,
+ * only O(log num_entries) row indices to locate the rows and the entries of
+ * the rows themselves are read, so the stream needs to be seekable.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data, positioned at the
+ *            start of the matrix
+ * @param row_begin  the first row to read
+ * @param row_end  the row after the last row to read
+ *
+ * @return A matrix_data structure with the size of the whole matrix that
+ *         contains only the entries of the given rows. The nonzero elements
+ *         are sorted in lexicographic order of their (row, column) indexes.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_binary_raw_rows(std::istream& is,
+                                                       IndexType row_begin,
+                                                       IndexType row_end);
+
+
 /**
  * Reads a matrix stored in either binary or matrix market format from an input
  * stream.
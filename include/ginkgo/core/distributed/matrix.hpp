@@ -40,6 +40,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #if GINKGO_BUILD_MPI
 
 
+#include <istream>
+
+
 #include <ginkgo/core/base/dense_cache.hpp>
 #include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/distributed/base.hpp>
@@ -155,6 +158,24 @@ template <typename ValueType>
 class Vector;
 
 
+/**
+ * Defines how read_distributed treats the entries of rows that are not owned
+ * by the calling process.
+ */
+enum class assembly_mode {
+    /**
+     * The entries are sent to the processes owning their rows, which add them
+     * to their own entries. Duplicate entries are summed up.
+     */
+    communicate,
+    /**
+     * The entries are discarded, so each process has to provide the complete
+     * rows it owns.
+     */
+    local_only
+};
+
+
 /**
  * The Matrix class defines a (MPI-)distributed matrix.
  *
@@ -225,6 +246,15 @@ class Vector;
  * This will set the dimensions of the global and local matrices automatically
  * by deducing the sizes from the partitions.
  *
+ * If the processes assemble contributions to rows owned by other processes,
+ * as in finite element assembly, these entries can be sent to their owners:
+ * ```
+ * matrix_assembly_data<...> assembly(global_size);
+ * // add arbitrary global entries on each process
+ * mat->read_distributed(assembly.get_ordered_data(), part, part,
+ *                       assembly_mode::communicate);
+ * ```
+ *
  * By default the Matrix type uses Csr for both stored matrices. It is possible
  * to explicitly change the datatype for the stored matrices, with the
  * constraint that the new type should implement the LinOp and
@@ -253,8 +283,16 @@ class Vector;
  * // Applying to distributed multi-vectors computes an SpMV/SpMM product
  * A->apply(b, x)              // x = A*b
  * A->apply(alpha, b, beta, x) // x = alpha*A*b + beta*x
+ *
+ * // The transposed product is computed without forming A^T
+ * A->apply_transposed(b, x)              // x = A^T*b
+ * A->apply_transposed(alpha, b, beta, x) // x = alpha*A^T*b + beta*x
  * ```
  *
+ * The matrix can be rectangular, if it is read with different row and column
+ * partitions. Then b is distributed by the column partition and x by the row
+ * partition for apply, and the other way around for apply_transposed.
+ *
  * @tparam ValueType  The underlying value type.
  * @tparam LocalIndexType  The index type used by the local matrices.
  * @tparam GlobalIndexType  The type for global indices.
@@ -305,15 +343,21 @@ public:
      * are ignored.
      *
      * @note The matrix data can contain entries for rows other than those owned
-     *        by the process. Entries for those rows are discarded.
+     *        by the process. Depending on assembly_type, entries for those rows
+     *        are discarded or sent to their owners.
      *
      * @param data  The device_matrix_data structure.
      * @param partition  The global row and column partition.
+     * @param assembly_type  How entries of rows owned by other processes are
+     *                       treated. With assembly_mode::communicate, this is
+     *                       a collective operation that requires a single
+     *                       exchange with the processes that share entries.
      */
     void read_distributed(
         const device_matrix_data<value_type, global_index_type>& data,
         ptr_param<const Partition<local_index_type, global_index_type>>
-            partition);
+            partition,
+        assembly_mode assembly_type = assembly_mode::local_only);
 
     /**
      * Reads a square matrix from the matrix_data structure and a global
@@ -327,7 +371,8 @@ public:
     void read_distributed(
         const matrix_data<value_type, global_index_type>& data,
         ptr_param<const Partition<local_index_type, global_index_type>>
-            partition);
+            partition,
+        assembly_mode assembly_type = assembly_mode::local_only);
 
     /**
      * Reads a matrix from the device_matrix_data structure, a global row
@@ -338,18 +383,22 @@ public:
      * and columns of the device_matrix_data are ignored.
      *
      * @note The matrix data can contain entries for rows other than those owned
-     *        by the process. Entries for those rows are discarded.
+     *        by the process. Depending on assembly_type, entries for those rows
+     *        are discarded or sent to their owners.
      *
      * @param data  The device_matrix_data structure.
      * @param row_partition  The global row partition.
      * @param col_partition  The global col partition.
+     * @param assembly_type  How entries of rows owned by other processes are
+     *                       treated.
      */
     void read_distributed(
         const device_matrix_data<value_type, global_index_type>& data,
         ptr_param<const Partition<local_index_type, global_index_type>>
             row_partition,
         ptr_param<const Partition<local_index_type, global_index_type>>
-            col_partition);
+            col_partition,
+        assembly_mode assembly_type = assembly_mode::local_only);
 
     /**
      * Reads a matrix from the matrix_data structure, a global row partition,
@@ -362,6 +411,39 @@ public:
      */
     void read_distributed(
         const matrix_data<value_type, global_index_type>& data,
+        ptr_param<const Partition<local_index_type, global_index_type>>
+            row_partition,
+        ptr_param<const Partition<local_index_type, global_index_type>>
+            col_partition,
+        assembly_mode assembly_type = assembly_mode::local_only);
+
+    /**
+     * Reads a square matrix stored in Ginkgo's binary format (see
+     * gko::read_binary_raw) and a global partition.
+     *
+     * Each process only reads the entries of the rows it owns, using
+     * gko::read_binary_raw_rows. Thus the entries in the stream need to be
+     * sorted by row index, and the I/O and memory required per process are
+     * proportional to the size of its local rows.
+     *
+     * @param is  The input stream. Each process needs its own seekable stream
+     *            positioned at the start of the matrix, e.g. an std::ifstream
+     *            of the same file.
+     * @param partition  The global row and column partition.
+     */
+    void read_distributed_binary(
+        std::istream& is,
+        ptr_param<const Partition<local_index_type, global_index_type>>
+            partition);
+
+    /**
+     * Reads a matrix stored in Ginkgo's binary format, a global row
+     * partition, and a global column partition.
+     *
+     * @see read_distributed_binary
+     */
+    void read_distributed_binary(
+        std::istream& is,
         ptr_param<const Partition<local_index_type, global_index_type>>
             row_partition,
         ptr_param<const Partition<local_index_type, global_index_type>>
@@ -384,6 +466,107 @@ public:
         return non_local_mtx_;
     }
 
+    /**
+     * Get read access to the row partition the matrix was read with.
+     *
+     * @return  Shared pointer to the row partition, or nullptr if the matrix
+     *          has not been read yet.
+     */
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+    get_row_partition() const
+    {
+        return row_partition_;
+    }
+
+    /**
+     * Get read access to the column partition the matrix was read with.
+     *
+     * @return  Shared pointer to the column partition, or nullptr if the
+     *          matrix has not been read yet.
+     */
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+    get_col_partition() const
+    {
+        return col_partition_;
+    }
+
+    /**
+     * Get read access to the mapping from the column indices of the non-local
+     * matrix to global column indices.
+     *
+     * @return  Array containing the global column index of each non-local
+     *          column
+     */
+    const array<global_index_type>& get_non_local_to_global() const
+    {
+        return non_local_to_global_;
+    }
+
+    /**
+     * Computes the product of the transpose of this matrix with b, i.e.
+     * x = A^T * b, without forming the transpose.
+     *
+     * Each process multiplies its rows of b with the transposes of its local
+     * and non-local matrix. The products for the non-local columns are sent
+     * back along the reverse of the halo exchange used by apply, and added up
+     * by the processes owning these columns.
+     *
+     * @param b  The distributed vector with the row partition of this matrix.
+     * @param x  The distributed vector with the column partition of this
+     *           matrix.
+     *
+     * @note The local and non-local matrices need to be Transposable. Their
+     *       transposes are created on the first call and are reused until the
+     *       matrix is read again.
+     */
+    void apply_transposed(ptr_param<const LinOp> b, ptr_param<LinOp> x) const;
+
+    /**
+     * Computes x = alpha * A^T * b + beta * x.
+     *
+     * @see apply_transposed(ptr_param<const LinOp>, ptr_param<LinOp>)
+     *
+     * @param alpha  The scaling of A^T * b.
+     * @param b  The distributed vector with the row partition of this matrix.
+     * @param beta  The scaling of x.
+     * @param x  The distributed vector with the column partition of this
+     *           matrix.
+     */
+    void apply_transposed(ptr_param<const LinOp> alpha,
+                          ptr_param<const LinOp> b,
+                          ptr_param<const LinOp> beta,
+                          ptr_param<LinOp> x) const;
+
+    /**
+     * Enables or disables the shared-memory halo exchange of apply.
+     *
+     * If enabled, the values of b that are shared with other processes are
+     * gathered into memory allocated with MPI_Win_allocate_shared, which is
+     * shared by all processes on the same node. The non-local product then
+     * reads the halo values of processes on the same node directly from their
+     * memory, without copying them. Only the halo values from processes on
+     * other nodes are still exchanged with messages.
+     *
+     * The shared memory is set up collectively in the first apply after
+     * enabling the option or reading the matrix, and is reallocated if the
+     * number of columns of b changes. All processes of the communicator have
+     * to use the same setting, and destroying or re-reading the matrix becomes
+     * a collective operation on each node.
+     *
+     * @param enable  whether to use the shared-memory halo exchange.
+     *
+     * @note This is only supported for host executors. apply_transposed
+     *       always uses the message-based exchange.
+     */
+    void set_shared_memory_halo(bool enable);
+
+    /**
+     * Returns whether the shared-memory halo exchange is enabled.
+     *
+     * @return  true if the shared-memory halo exchange is enabled.
+     */
+    bool get_shared_memory_halo() const { return shared_memory_halo_; }
+
     /**
      * Copy constructs a Matrix.
      *
@@ -546,6 +729,46 @@ protected:
      */
     mpi::request communicate(const local_vector_type* local_b) const;
 
+    /**
+     * Adds alpha times the product of the non-local matrix with the received
+     * halo values to local_x. Only the boundary rows, i.e. the local rows with
+     * non-local entries, are computed and updated.
+     *
+     * @param alpha  The scaling factor of the non-local product.
+     * @param local_x  The local part of the result vector.
+     *
+     * @note  This requires that the communication started by communicate()
+     *        has been completed.
+     */
+    void apply_boundary(const local_vector_type* alpha,
+                        local_vector_type* local_x) const;
+
+    /**
+     * Starts a non-blocking communication that reverses communicate(). It
+     * sends the values for the non-local columns, stored in the receive
+     * buffer, to the processes owning these columns, which receive them into
+     * their send buffer.
+     *
+     * @param num_cols  The number of columns of the exchanged values.
+     * @return  MPI request for the non-blocking communication.
+     */
+    mpi::request communicate_transposed(size_type num_cols) const;
+
+    /**
+     * Creates the transposes of the local and non-local matrix used by
+     * apply_transposed, if they do not exist yet.
+     */
+    void prepare_transposed() const;
+
+    /**
+     * Sets up the node-local communicator, the shared memory window and the
+     * non-local matrix reading from it used by the shared-memory halo
+     * exchange, if they do not exist yet or do not match num_cols.
+     *
+     * @param num_cols  The number of columns of the exchanged values.
+     */
+    void prepare_shared_halo(size_type num_cols) const;
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -556,6 +779,16 @@ private:
     std::vector<comm_index_type> send_sizes_;
     std::vector<comm_index_type> recv_offsets_;
     std::vector<comm_index_type> recv_sizes_;
+    // graph communicator and sizes/offsets restricted to the actual neighbors
+    // of this rank, used for the halo exchange once the matrix has been read
+    mpi::communicator neighbor_comm_{MPI_COMM_NULL};
+    std::vector<comm_index_type> neighbor_send_offsets_;
+    std::vector<comm_index_type> neighbor_send_sizes_;
+    std::vector<comm_index_type> neighbor_recv_offsets_;
+    std::vector<comm_index_type> neighbor_recv_sizes_;
+    // graph communicator with the reversed edges of neighbor_comm_, used to
+    // accumulate the non-local contributions of apply_transposed
+    mpi::communicator reverse_neighbor_comm_{MPI_COMM_NULL};
     array<local_index_type> gather_idxs_;
     array<global_index_type> non_local_to_global_;
     gko::detail::DenseCache<value_type> one_scalar_;
@@ -563,8 +796,28 @@ private:
     gko::detail::DenseCache<value_type> host_recv_buffer_;
     gko::detail::DenseCache<value_type> send_buffer_;
     gko::detail::DenseCache<value_type> recv_buffer_;
+    gko::detail::DenseCache<value_type> boundary_buffer_;
     std::shared_ptr<LinOp> local_mtx_;
     std::shared_ptr<LinOp> non_local_mtx_;
+    // the non-zero rows of non_local_mtx_ and a copy of the non-local matrix
+    // compressed to these rows, so that the work after the halo exchange only
+    // touches the rows that depend on non-local values
+    array<local_index_type> boundary_rows_;
+    std::shared_ptr<LinOp> boundary_mtx_;
+    // adds the values received by communicate_transposed to the local rows
+    // they were gathered from, which may appear several times
+    std::shared_ptr<LinOp> scatter_mtx_;
+    mutable std::shared_ptr<LinOp> transposed_local_mtx_;
+    mutable std::shared_ptr<LinOp> transposed_non_local_mtx_;
+    // the node-local shared memory and communication pattern used if
+    // shared_memory_halo_ is enabled, created lazily by prepare_shared_halo
+    struct shared_halo_state;
+    bool shared_memory_halo_{false};
+    mutable std::shared_ptr<shared_halo_state> shared_halo_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        row_partition_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        col_partition_;
 };
 
 
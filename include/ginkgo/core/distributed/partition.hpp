@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/polymorphic_object.hpp>
 #include <ginkgo/core/base/types.hpp>
 
@@ -324,6 +325,37 @@ private:
 };
 
 
+/**
+ * Computes a mapping global_index -> part_id from the adjacency graph of a
+ * square matrix that balances the number of rows per part while keeping the
+ * edge cut, and thus the communication volume of a distributed matrix, small.
+ * The graph is partitioned by multilevel recursive bisection followed by a
+ * greedy k-way refinement. The sparsity pattern of the matrix does not need to
+ * be symmetric, the graph of A + A^T is used.
+ *
+ * The result can be passed to Partition::build_from_mapping. Since the
+ * partitioning is deterministic, each rank can compute the same mapping from
+ * the global matrix independently.
+ *
+ * @tparam ValueType  the value type of the Csr matrix used to read the graph
+ * @tparam IndexType  the index type of the Csr matrix used to read the graph
+ *
+ * @param exec  the Executor on which the mapping should be stored. The
+ *              partitioning itself runs on its host executor.
+ * @param matrix  the square matrix whose graph is partitioned, it needs to be
+ *                convertible to Csr<ValueType, IndexType>
+ * @param num_parts  the number of parts
+ * @param imbalance  the maximum relative amount by which the size of a part
+ *                   may exceed the average part size
+ *
+ * @return  the mapping from row indices to part IDs
+ */
+template <typename ValueType, typename IndexType>
+array<comm_index_type> build_mapping_from_graph(
+    std::shared_ptr<const Executor> exec, std::shared_ptr<const LinOp> matrix,
+    comm_index_type num_parts, double imbalance = 0.05);
+
+
 }  // namespace distributed
 }  // namespace experimental
 }  // namespace gko
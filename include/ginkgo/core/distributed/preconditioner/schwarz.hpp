@@ -40,7 +40,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #if GINKGO_BUILD_MPI
 
 
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 
@@ -64,7 +69,22 @@ namespace preconditioner {
  * See Iterative Methods for Sparse Linear Systems (Y. Saad) for a general
  * treatment and variations of the method.
  *
- * @note Currently overlap and coarse grid correction are not supported (TODO).
+ * Without overlap, each rank applies the local solver to its diagonal block
+ * of the system matrix. With `overlap` set to k > 0, the local matrix is
+ * extended by the rows of all unknowns reachable within k steps in the
+ * adjacency graph of the matrix, and the local solver is generated from this
+ * extended matrix. The preconditioner is then applied in a restricted
+ * additive way (RAS): the right-hand side is extended by the values of the
+ * overlapping unknowns, the local solver is applied to the extended system and
+ * only the owned part of the result is kept, so no communication is necessary
+ * to combine the local solutions.
+ *
+ * Optionally, an additive two-level coarse correction Z (Z^H A Z)^{-1} Z^H
+ * can be added to the one-level preconditioner. The coarse space Z is either
+ * given by the user as a distributed multi-vector, or consists of one
+ * aggregate per rank, i.e. the indicator vectors of the owned unknowns of each
+ * rank. The coarse matrix is replicated on all ranks and inverted explicitly,
+ * so the coarse space should be small.
  *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  integral type of the preconditioner
@@ -95,6 +115,29 @@ public:
          */
         std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
             local_solver_factory, nullptr);
+
+        /**
+         * Number of layers of overlap between the subdomains. Each layer
+         * extends the local matrix by the rows of the non-local neighbors of
+         * the current subdomain. The system matrix needs to use the same
+         * partition for its rows and columns if overlap is used.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(overlap, 0u);
+
+        /**
+         * Enables the two-level coarse correction with one aggregate per rank.
+         * It is ignored if a `coarse_space` is provided.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(coarse_correction, false);
+
+        /**
+         * User-provided coarse space. Each column of this distributed
+         * multi-vector is one basis vector of the coarse space, it needs to
+         * use the same row distribution as the system matrix. If it is set,
+         * the two-level coarse correction is enabled.
+         */
+        std::shared_ptr<const Vector<ValueType>> GKO_FACTORY_PARAMETER_SCALAR(
+            coarse_space, nullptr);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Schwarz, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -106,7 +149,9 @@ protected:
      * @param exec  the executor this object is assigned to
      */
     explicit Schwarz(std::shared_ptr<const Executor> exec)
-        : EnableLinOp<Schwarz>(std::move(exec))
+        : EnableLinOp<Schwarz>(exec),
+          comm_{MPI_COMM_NULL},
+          overlap_gather_idxs_{exec}
     {}
 
     /**
@@ -120,7 +165,9 @@ protected:
                      std::shared_ptr<const LinOp> system_matrix)
         : EnableLinOp<Schwarz>(factory->get_executor(),
                                gko::transpose(system_matrix->get_size())),
-          parameters_{factory->get_parameters()}
+          parameters_{factory->get_parameters()},
+          comm_{MPI_COMM_NULL},
+          overlap_gather_idxs_{factory->get_executor()}
     {
         this->generate(system_matrix);
     }
@@ -130,6 +177,42 @@ protected:
      */
     void generate(std::shared_ptr<const LinOp> system_matrix);
 
+    /**
+     * Builds the local matrix extended by `overlap` layers of non-local rows
+     * and sets up the communication pattern for the overlapping unknowns.
+     *
+     * @param system_matrix  the distributed system matrix
+     *
+     * @return  the extended local matrix, the owned rows come first
+     */
+    std::shared_ptr<const LinOp> generate_overlap(
+        const Matrix<ValueType, LocalIndexType, GlobalIndexType>*
+            system_matrix);
+
+    /**
+     * Builds the transfer operators and the inverse of the coarse matrix of
+     * the two-level correction.
+     *
+     * @param system_matrix  the distributed system matrix
+     */
+    void generate_coarse(
+        const Matrix<ValueType, LocalIndexType, GlobalIndexType>*
+            system_matrix);
+
+    /**
+     * Applies the local solver to the local part of the right-hand side
+     * extended by the overlapping unknowns, and keeps only the owned part of
+     * the solution.
+     */
+    void apply_overlap(const matrix::Dense<ValueType>* local_b,
+                       matrix::Dense<ValueType>* local_x) const;
+
+    /**
+     * Adds the coarse correction of the local right-hand side to the local
+     * solution.
+     */
+    void apply_coarse_correction(const matrix::Dense<ValueType>* local_b,
+                                 matrix::Dense<ValueType>* local_x) const;
 
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
@@ -141,6 +224,15 @@ protected:
 
 private:
     std::shared_ptr<const LinOp> local_solver_;
+    mpi::communicator comm_;
+    array<LocalIndexType> overlap_gather_idxs_;
+    std::vector<comm_index_type> overlap_send_sizes_;
+    std::vector<comm_index_type> overlap_send_offsets_;
+    std::vector<comm_index_type> overlap_recv_sizes_;
+    std::vector<comm_index_type> overlap_recv_offsets_;
+    std::shared_ptr<const LinOp> coarse_restriction_;
+    std::shared_ptr<const LinOp> coarse_prolongation_;
+    std::shared_ptr<const LinOp> coarse_inverse_;
 };
 
 
@@ -40,6 +40,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #if GINKGO_BUILD_MPI
 
 
+#include <utility>
+#include <vector>
+
+
 #include <ginkgo/core/base/dense_cache.hpp>
 #include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/distributed/base.hpp>
@@ -404,6 +408,67 @@ public:
      */
     void compute_norm1(ptr_param<LinOp> result, array<char>& tmp) const;
 
+    /**
+     * Computes the column-wise dot products of several pairs of
+     * (multi-)vectors `x_i` and `conj(y_i)`, combining the local results of
+     * all pairs into a single global reduction. Squared norms can be computed
+     * by passing the same vector as both entries of a pair.
+     *
+     * @param pairs  the pairs (x_i, y_i) of (multi-)vectors, all of the same
+     *               dimension and on the same communicator
+     * @param results  Dense row matrices, results[i] is used to store the dot
+     *                 product of the i-th pair (the number of columns must
+     *                 match the number of columns of the vectors)
+     */
+    static void compute_conj_dots(
+        const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+        const std::vector<local_vector_type*>& results);
+
+    /**
+     * @copydoc compute_conj_dots(const std::vector<std::pair<const Vector*,
+     *          const Vector*>>&, const std::vector<local_vector_type*>&)
+     *
+     * @param tmp  the temporary storage to use for partial sums during the
+     *             reduction computation. It may be resized and/or reset to the
+     *             correct executor.
+     */
+    static void compute_conj_dots(
+        const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+        const std::vector<local_vector_type*>& results, array<char>& tmp);
+
+    /**
+     * Starts the computation of the column-wise dot products of several pairs
+     * of (multi-)vectors `x_i` and `conj(y_i)` with a single non-blocking
+     * global reduction. The local results are computed before this function
+     * returns, so the reduction can overlap with independent work.
+     *
+     * @param pairs  the pairs (x_i, y_i) of (multi-)vectors, all of the same
+     *               dimension and on the same communicator
+     * @param result  a Dense matrix with one row per pair, the i-th row is
+     *                used to store the dot product of the i-th pair. Its rows
+     *                need to be stored contiguously, and it needs to be
+     *                located on an executor MPI can access, see
+     *                mpi::requires_host_buffer.
+     *
+     * @return  the request of the global reduction, result contains the
+     *          global dot products only after waiting on it
+     */
+    static mpi::request i_compute_conj_dots(
+        const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+        ptr_param<local_vector_type> result);
+
+    /**
+     * @copydoc i_compute_conj_dots(const std::vector<std::pair<const Vector*,
+     *          const Vector*>>&, ptr_param<local_vector_type>)
+     *
+     * @param tmp  the temporary storage to use for partial sums during the
+     *             reduction computation. It may be resized and/or reset to the
+     *             correct executor.
+     */
+    static mpi::request i_compute_conj_dots(
+        const std::vector<std::pair<const Vector*, const Vector*>>& pairs,
+        ptr_param<local_vector_type> result, array<char>& tmp);
+
     /**
      * Returns a single element of the multi-vector.
      *
@@ -613,6 +678,7 @@ private:
     local_vector_type local_;
     ::gko::detail::DenseCache<ValueType> host_reduction_buffer_;
     ::gko::detail::DenseCache<remove_complex<ValueType>> host_norm_buffer_;
+    ::gko::detail::DenseCache<ValueType> multi_reduction_buffer_;
 };
 
 
@@ -34,6 +34,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_PUBLIC_CORE_FACTORIZATION_FACTORIZATION_HPP_
 
 
+#include <functional>
+
+
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
@@ -46,6 +49,14 @@ namespace experimental {
 namespace factorization {
 
 
+template <typename ValueType, typename IndexType>
+class Lu;
+
+
+template <typename ValueType, typename IndexType>
+class Cholesky;
+
+
 /**
  * Stores how a Factorization is represented internally. Depending on the
  * representation, different functionality may be available in the class.
@@ -101,8 +112,11 @@ enum class storage_type {
  * @tparam IndexType  the index type used to represent the sparsity pattern
  */
 template <typename ValueType, typename IndexType>
-class Factorization : public EnableLinOp<Factorization<ValueType, IndexType>> {
+class Factorization : public EnableLinOp<Factorization<ValueType, IndexType>>,
+                      public Refactorizable {
     friend class EnablePolymorphicObject<Factorization, LinOp>;
+    friend class Lu<ValueType, IndexType>;
+    friend class Cholesky<ValueType, IndexType>;
 
 public:
     using value_type = ValueType;
@@ -148,6 +162,15 @@ public:
      */
     std::shared_ptr<const matrix_type> get_combined() const;
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * @note This is only supported for factorizations generated by a
+     *       factorization factory like Lu or Cholesky, which store the
+     *       information necessary to recompute the numerical factorization.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     /** Creates a deep copy of the factorization. */
     Factorization(const Factorization&);
 
@@ -220,6 +243,9 @@ protected:
 private:
     storage_type storage_type_;
     std::unique_ptr<Composition<ValueType>> factors_;
+    // recomputes the values of the combined factors from a new system matrix,
+    // reusing the symbolic data of the factory that generated them
+    std::function<void(const LinOp*, matrix_type*)> numeric_factorization_;
 };
 
 
@@ -68,7 +68,7 @@ namespace factorization {
  */
 template <typename ValueType = gko::default_precision,
           typename IndexType = gko::int32>
-class Ic : public Composition<ValueType> {
+class Ic : public Composition<ValueType>, public Refactorizable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -93,6 +93,11 @@ public:
         }
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -68,7 +68,7 @@ namespace factorization {
  */
 template <typename ValueType = gko::default_precision,
           typename IndexType = gko::int32>
-class Ilu : public Composition<ValueType> {
+class Ilu : public Composition<ValueType>, public Refactorizable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -88,6 +88,11 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -121,6 +126,16 @@ public:
          * incorrect.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * The maximum level of fill-in of the ILU(k) factorization. The
+         * default value 0 computes the factors on the sparsity pattern of the
+         * system matrix. For larger values, the sparsity pattern of the factors
+         * additionally contains all fill-in entries whose level of fill is at
+         * most `fill_level`, which is computed by a symbolic factorization
+         * before the numerical factorization.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(fill_level, 0);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Ilu, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -92,6 +92,15 @@ public:
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(symmetric_sparsity, false);
 
+        /**
+         * If the provided symbolic factorization does not contain all fill-in
+         * of the exact factorization, set this flag to `true` to drop all
+         * updates to entries outside of it. This computes an incomplete LU
+         * factorization on the given sparsity pattern, which needs to contain
+         * the sparsity pattern of the system matrix and its diagonal.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(checked_lookup, false);
+
         /**
          * The `system_matrix`, which will be given to this factory, must be
          * sorted (first by row, then by column) in order for the algorithm
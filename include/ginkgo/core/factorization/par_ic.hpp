@@ -93,7 +93,7 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIc : public Composition<ValueType> {
+class ParIc : public Composition<ValueType>, public Refactorizable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -118,6 +118,14 @@ public:
         }
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * @note As in the initial generation, the fixed-point iterations start
+     *       from the values of the new system matrix.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
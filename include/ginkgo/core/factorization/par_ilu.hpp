@@ -94,7 +94,7 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlu : public Composition<ValueType> {
+class ParIlu : public Composition<ValueType>, public Refactorizable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -116,6 +116,14 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * @note As in the initial generation, the fixed-point iterations start
+     *       from the values of the new system matrix.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -0,0 +1,182 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_MULTIGRID_CLASSICAL_COARSENING_HPP_
+#define GKO_PUBLIC_CORE_MULTIGRID_CLASSICAL_COARSENING_HPP_
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
+
+namespace gko {
+namespace multigrid {
+
+
+/**
+ * ClassicalCoarsening is the classical algebraic multigrid coarsening by
+ * Ruge and Stüben, where the coarse grid is a subset of the fine grid.
+ *
+ * The level is generated in four steps:
+ * 1. Row i strongly depends on column j if |a_ij| >= strength_threshold *
+ *    max_{k != i} |a_ik|.
+ * 2. The rows are split into coarse (C) and fine (F) points using the
+ *    parallel modified independent set (PMIS) algorithm from H. De Sterck,
+ *    U. M. Yang and J. J. Heys, "Reducing complexity in parallel algebraic
+ *    multigrid preconditioners": Points that no other point strongly depends
+ *    on become F points, then repeatedly all points whose measure (the number
+ *    of points strongly depending on them, with a pseudo-random tie-breaker)
+ *    is larger than that of all undecided strongly connected points become C
+ *    points, and all undecided points strongly depending on a C point become
+ *    F points.
+ * 3. The prolongator uses direct interpolation: C points are injected, F
+ *    point i is interpolated from the C points C_i it strongly depends on
+ *    with weights w_ij = -(sum_{k != i} a_ik) / (sum_{k in C_i} a_ik) *
+ *    a_ij / a_ii.
+ * 4. The coarse matrix is the Galerkin product P^T A P.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup MultigridLevel
+ * @ingroup Multigrid
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class ClassicalCoarsening
+    : public EnableLinOp<ClassicalCoarsening<ValueType, IndexType>>,
+      public EnableMultigridLevel<ValueType> {
+    friend class EnableLinOp<ClassicalCoarsening>;
+    friend class EnablePolymorphicObject<ClassicalCoarsening, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Returns the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * @copydoc MultigridLevel::update_values(std::shared_ptr<const LinOp>)
+     */
+    void update_values(std::shared_ptr<const LinOp> fine_op) override;
+
+    /**
+     * Returns the coarse map, which stores the coarse row index for every C
+     * point and -1 for every F point.
+     *
+     * @return the coarse map.
+     */
+    const IndexType* get_const_coarse_map() const noexcept
+    {
+        return coarse_map_.get_const_data();
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The threshold below which connections are considered weak, relative
+         * to the largest off-diagonal entry of the row.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(strength_threshold, 0.25);
+
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by row, then by column) in order for the algorithm
+         * to work. If it is known that the matrix will be sorted, this
+         * parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, this multigrid_level might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(ClassicalCoarsening, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override
+    {
+        this->get_composition()->apply(b, x);
+    }
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override
+    {
+        this->get_composition()->apply(alpha, b, beta, x);
+    }
+
+    explicit ClassicalCoarsening(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<ClassicalCoarsening>(std::move(exec))
+    {}
+
+    explicit ClassicalCoarsening(const Factory* factory,
+                                 std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<ClassicalCoarsening>(factory->get_executor(),
+                                           system_matrix->get_size()),
+          EnableMultigridLevel<ValueType>(system_matrix),
+          parameters_{factory->get_parameters()},
+          system_matrix_{system_matrix},
+          coarse_map_(factory->get_executor(), system_matrix_->get_size()[0])
+    {
+        GKO_ASSERT(parameters_.strength_threshold >= 0.0);
+        GKO_ASSERT(parameters_.strength_threshold <= 1.0);
+        if (system_matrix_->get_size()[0] != 0) {
+            // generate on the existing matrix
+            this->generate();
+        }
+    }
+
+    void generate();
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    array<IndexType> coarse_map_;
+};
+
+
+}  // namespace multigrid
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MULTIGRID_CLASSICAL_COARSENING_HPP_
@@ -87,6 +87,11 @@ public:
         return system_matrix_;
     }
 
+    /**
+     * @copydoc MultigridLevel::update_values(std::shared_ptr<const LinOp>)
+     */
+    void update_values(std::shared_ptr<const LinOp> fine_op) override;
+
 
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
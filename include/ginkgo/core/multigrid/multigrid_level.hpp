@@ -93,6 +93,17 @@ public:
      * @return  the prolong operator.
      */
     virtual std::shared_ptr<const LinOp> get_prolong_op() const = 0;
+
+    /**
+     * Updates the level for a fine operator with new values, but the same
+     * sparsity pattern as the operator it was generated from. The transfer
+     * operators and the sparsity pattern of the coarse operator are kept,
+     * only the values of the coarse operator are recomputed.
+     *
+     * @param fine_op  the new fine operator
+     */
+    virtual void update_values(std::shared_ptr<const LinOp> fine_op)
+        GKO_NOT_IMPLEMENTED;
 };
 
 
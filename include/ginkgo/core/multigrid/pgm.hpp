@@ -64,6 +64,16 @@ namespace multigrid {
  * un-aggregated elements are assigned to an aggregated group
  * or are left alone.
  *
+ * Pgm also accepts an experimental::distributed::Matrix with the same row and
+ * column partition. Then each rank aggregates the rows of its local matrix,
+ * so aggregates do not cross rank boundaries. The coarse matrix and the
+ * transfer operators are distributed matrices, and the coarse matrix uses a
+ * contiguous partition where each rank owns its aggregates. Small coarse
+ * matrices can be agglomerated onto fewer ranks, see
+ * `min_coarse_rows_per_rank`. A distributed level can only be used through
+ * its transfer and coarse operators, as solver::Multigrid does, it can not be
+ * applied directly.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -91,12 +101,19 @@ public:
         return system_matrix_;
     }
 
+    /**
+     * @copydoc MultigridLevel::update_values(std::shared_ptr<const LinOp>)
+     */
+    void update_values(std::shared_ptr<const LinOp> fine_op) override;
+
     /**
      * Returns the aggregate group.
      *
      * Aggregate group whose size is same as the number of rows. Stores the
      * mapping information from row index to coarse row index.
      * i.e., agg[row_idx] = coarse_row_idx.
+     * For a distributed matrix, it only contains the local rows and the index
+     * of their aggregate among the aggregates of this rank.
      *
      * @return the aggregate group.
      */
@@ -151,6 +168,15 @@ public:
          * incorrect.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * Only used for distributed matrices: if the coarse matrix has less
+         * than this number of rows per rank, it is agglomerated onto fewer
+         * ranks, such that each of them owns at least this number of rows
+         * (or all rows are owned by a single rank). The remaining ranks own
+         * no coarse rows. The default value 0 disables the agglomeration.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(min_coarse_rows_per_rank, 0u);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Pgm, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
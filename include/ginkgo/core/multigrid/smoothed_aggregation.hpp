@@ -0,0 +1,195 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_MULTIGRID_SMOOTHED_AGGREGATION_HPP_
+#define GKO_PUBLIC_CORE_MULTIGRID_SMOOTHED_AGGREGATION_HPP_
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
+
+namespace gko {
+namespace multigrid {
+
+
+/**
+ * SmoothedAggregation is the smoothed aggregation coarsening introduced in
+ * P. Vaněk, J. Mandel and M. Brezina, "Algebraic multigrid by smoothed
+ * aggregation for second and fourth order elliptic problems".
+ *
+ * The level is generated in four steps:
+ * 1. Weak connections are removed from the matrix and added to the diagonal,
+ *    where a_ij is strong if |a_ij| >= strength_threshold *
+ *    sqrt(|a_ii a_jj|).
+ * 2. The strongly connected graph is aggregated: A distance-2 maximal
+ *    independent set is computed in parallel, every root forms an aggregate
+ *    with its neighbors, and the remaining rows join the neighboring aggregate
+ *    they are connected to most strongly.
+ * 3. The tentative prolongator (piecewise constant over the aggregates) is
+ *    smoothed by one damped Jacobi step with the filtered matrix A_F,
+ *    P = (I - omega D_F^{-1} A_F) P_tent, where omega =
+ *    prolongator_damping / rho and rho is the Gershgorin bound of the spectral
+ *    radius of D_F^{-1} A_F.
+ * 4. The coarse matrix is the Galerkin product P^T A P.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup MultigridLevel
+ * @ingroup Multigrid
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class SmoothedAggregation
+    : public EnableLinOp<SmoothedAggregation<ValueType, IndexType>>,
+      public EnableMultigridLevel<ValueType> {
+    friend class EnableLinOp<SmoothedAggregation>;
+    friend class EnablePolymorphicObject<SmoothedAggregation, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Returns the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * @copydoc MultigridLevel::update_values(std::shared_ptr<const LinOp>)
+     */
+    void update_values(std::shared_ptr<const LinOp> fine_op) override;
+
+    /**
+     * Returns the aggregate group, i.e. agg[row_idx] = coarse_row_idx.
+     *
+     * @return the aggregate group.
+     */
+    IndexType* get_agg() noexcept { return agg_.get_data(); }
+
+    /**
+     * @copydoc SmoothedAggregation::get_agg()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const IndexType* get_const_agg() const noexcept
+    {
+        return agg_.get_const_data();
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The threshold below which connections are considered weak, relative
+         * to the geometric mean of the corresponding diagonal entries.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(strength_threshold, 0.08);
+
+        /**
+         * The damping factor of the Jacobi step smoothing the prolongator,
+         * relative to the inverse of the estimated spectral radius.
+         * 0 results in unsmoothed aggregation.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(prolongator_damping, 4.0 / 3.0);
+
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by row, then by column) in order for the algorithm
+         * to work. If it is known that the matrix will be sorted, this
+         * parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, this multigrid_level might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(SmoothedAggregation, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override
+    {
+        this->get_composition()->apply(b, x);
+    }
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override
+    {
+        this->get_composition()->apply(alpha, b, beta, x);
+    }
+
+    explicit SmoothedAggregation(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<SmoothedAggregation>(std::move(exec))
+    {}
+
+    explicit SmoothedAggregation(const Factory* factory,
+                                 std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<SmoothedAggregation>(factory->get_executor(),
+                                           system_matrix->get_size()),
+          EnableMultigridLevel<ValueType>(system_matrix),
+          parameters_{factory->get_parameters()},
+          system_matrix_{system_matrix},
+          agg_(factory->get_executor(), system_matrix_->get_size()[0])
+    {
+        GKO_ASSERT(parameters_.strength_threshold >= 0.0);
+        GKO_ASSERT(parameters_.prolongator_damping >= 0.0);
+        if (system_matrix_->get_size()[0] != 0) {
+            // generate on the existing matrix
+            this->generate();
+        }
+    }
+
+    void generate();
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    array<IndexType> agg_;
+};
+
+
+}  // namespace multigrid
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MULTIGRID_SMOOTHED_AGGREGATION_HPP_
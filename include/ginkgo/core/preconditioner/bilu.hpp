@@ -0,0 +1,150 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_BILU_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_BILU_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * The block incomplete LU preconditioner BILU(0) computes an incomplete LU
+ * factorization $A \approx LU$ of a matrix stored in the matrix::Fbcsr format
+ * on the block sparsity pattern of the matrix. All operations work on the
+ * dense blocks: the pivots are the dense diagonal blocks of $U$, and $L$ has
+ * identity blocks on its diagonal.
+ *
+ * The factors are stored combined in a single Fbcsr matrix with the same
+ * sparsity pattern as the system matrix, with the diagonal blocks of $U$
+ * stored as their inverses. The preconditioner is applied by a block forward
+ * substitution with $L$ followed by a block backward substitution with $U$.
+ *
+ * @note The system matrix needs to contain all diagonal blocks, and they
+ *       need to be non-singular throughout the factorization.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  integral type of the sparsity pattern
+ *
+ * @ingroup precond
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Bilu : public EnableLinOp<Bilu<ValueType, IndexType>> {
+    friend class EnableLinOp<Bilu>;
+    friend class EnablePolymorphicObject<Bilu, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Fbcsr<ValueType, IndexType>;
+
+    /**
+     * Returns the combined factors L + U - I, where the diagonal blocks store
+     * the inverses of the diagonal blocks of U.
+     *
+     * @return the combined factors
+     */
+    std::shared_ptr<const matrix_type> get_factors() const { return factors_; }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by block row, then by block column) in order for the
+         * algorithm to work. If it is known that the matrix will be sorted,
+         * this parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, the factorization might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Bilu, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit Bilu(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Bilu>(exec), diag_idxs_{exec}
+    {}
+
+    /**
+     * Creates a BILU(0) preconditioner from a matrix using a Bilu::Factory.
+     *
+     * @param factory  the factory to use to create the preconditioner
+     * @param system_matrix  the Fbcsr matrix to factorize
+     */
+    explicit Bilu(const Factory* factory,
+                  std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Bilu>(factory->get_executor(),
+                            gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          diag_idxs_{factory->get_executor()}
+    {
+        this->generate(system_matrix.get());
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    /**
+     * Computes the combined factors of the given system matrix.
+     *
+     * @param system_matrix  the source Fbcsr matrix
+     */
+    void generate(const LinOp* system_matrix);
+
+    std::shared_ptr<const matrix_type> factors_;
+    array<index_type> diag_idxs_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_BILU_HPP_
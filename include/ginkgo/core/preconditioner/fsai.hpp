@@ -0,0 +1,192 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_FSAI_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_FSAI_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * The adaptive factorized sparse approximate inverse (FSAI) preconditioner
+ * computes a sparse lower triangular matrix $G$ such that
+ * $G^H G \approx A^{-1}$ for a symmetric (hermitian) positive definite
+ * matrix $A$.
+ *
+ * In contrast to the ISAI, the sparsity pattern of $G$ is not fixed a
+ * priori, but built up row by row: Starting from the diagonal, each row
+ * grows in `steps` steps by the `step_size` entries that promise the
+ * largest reduction of the Kaporin number of $G A G^H$. The adaptation of
+ * a row stops early once the predicted relative reduction falls below
+ * `tolerance`. Thus, each row of $G$ contains at most
+ * `steps * step_size + 1` entries, which bounds the memory required for the
+ * preconditioner. For every step, a small dense SPD system is solved for
+ * each row, which can be done independently for all rows.
+ *
+ * The rows of $G$ are scaled such that the diagonal of $G A G^H$ is one.
+ * The preconditioner is applied by computing $x = G^H (G b)$, i.e. with two
+ * sparse matrix-vector products and no triangular solves.
+ *
+ * @note The system matrix needs to be symmetric (hermitian) positive
+ *       definite, otherwise the generation may break down.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  integral type of the sparsity pattern
+ *
+ * @ingroup precond
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Fsai : public EnableLinOp<Fsai<ValueType, IndexType>> {
+    friend class EnableLinOp<Fsai>;
+    friend class EnablePolymorphicObject<Fsai, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the lower triangular factor $G$ of the approximate inverse.
+     *
+     * @return the lower triangular factor
+     */
+    std::shared_ptr<const matrix_type> get_lower_factor() const
+    {
+        return lower_factor_;
+    }
+
+    /**
+     * Returns the upper triangular factor $G^H$ of the approximate inverse.
+     *
+     * @return the upper triangular factor
+     */
+    std::shared_ptr<const matrix_type> get_upper_factor() const
+    {
+        return upper_factor_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * @brief Optimization parameter that skips the sorting of the input
+         *        matrix (only skip if it is known that it is already sorted).
+         *
+         * The algorithm to create the approximate inverse requires the
+         * input matrix to be sorted. If it is, this parameter can be set to
+         * `true` to skip the sorting for better performance.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * @brief The maximum number of adaptive steps per row.
+         *
+         * Together with `step_size`, this limits the number of entries
+         * per row of the factor. Default value 5.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(steps, 5u);
+
+        /**
+         * @brief The number of entries added to a row in each step.
+         *
+         * Default value 2.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(step_size, 2u);
+
+        /**
+         * @brief Relative Kaporin number reduction below which the
+         *        adaptation of a row stops.
+         *
+         * Setting it to zero always uses all `steps`. Default value 1e-3.
+         */
+        remove_complex<ValueType> GKO_FACTORY_PARAMETER_SCALAR(tolerance,
+                                                               1e-3);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Fsai, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit Fsai(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Fsai>(exec)
+    {}
+
+    /**
+     * Creates an adaptive FSAI preconditioner from a matrix using a
+     * Fsai::Factory.
+     *
+     * @param factory  the factory to use to create the preconditioner
+     * @param system_matrix  the SPD matrix to approximate the inverse of
+     */
+    explicit Fsai(const Factory* factory,
+                  std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Fsai>(factory->get_executor(),
+                            gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()}
+    {
+        this->generate(system_matrix);
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    /**
+     * Computes the factors of the approximate inverse of the given matrix.
+     *
+     * @param system_matrix  the source matrix
+     */
+    void generate(std::shared_ptr<const LinOp> system_matrix);
+
+    std::shared_ptr<const matrix_type> lower_factor_;
+    std::shared_ptr<const matrix_type> upper_factor_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_FSAI_HPP_
@@ -0,0 +1,138 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_GAUSS_SEIDEL_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_GAUSS_SEIDEL_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * This class generates the (symmetric) Gauss-Seidel preconditioner.
+ *
+ * It is the special case of the Sor preconditioner with relaxation factor
+ * $\omega = 1$, i.e. $M = D + L$ or, for the symmetric version,
+ * $M = (D + L) D^{-1} (D + U)$.
+ *
+ * @see Sor
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  integral type of the sparsity pattern
+ *
+ * @ingroup precond
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class GaussSeidel
+    : public EnablePolymorphicObject<GaussSeidel<ValueType, IndexType>,
+                                     LinOpFactory>,
+      public EnablePolymorphicAssignment<GaussSeidel<ValueType, IndexType>> {
+public:
+    struct parameters_type;
+    friend class EnablePolymorphicObject<GaussSeidel, LinOpFactory>;
+    friend class enable_parameters_type<parameters_type, GaussSeidel>;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using composition_type = Composition<value_type>;
+
+    struct parameters_type
+        : public enable_parameters_type<parameters_type, GaussSeidel> {
+        /**
+         * @copydoc Sor::parameters_type::skip_sorting
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * `true` generates the symmetric Gauss-Seidel preconditioner with a
+         * forward and a backward sweep, `false` only the forward sweep.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(symmetric, false);
+
+        /**
+         * @copydoc Sor::parameters_type::l_solver
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            l_solver, nullptr);
+
+        /**
+         * @copydoc Sor::parameters_type::u_solver
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            u_solver, nullptr);
+    };
+
+    /**
+     * Returns the parameters used to construct the factory.
+     *
+     * @return the parameters used to construct the factory.
+     */
+    const parameters_type& get_parameters() const { return parameters_; }
+
+    /**
+     * @copydoc Sor::generate
+     */
+    std::unique_ptr<composition_type> generate(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /** Creates a new parameter_type to set up the factory. */
+    static parameters_type build() { return {}; }
+
+protected:
+    explicit GaussSeidel(std::shared_ptr<const Executor> exec,
+                         const parameters_type& params = {});
+
+    std::unique_ptr<LinOp> generate_impl(
+        std::shared_ptr<const LinOp> system_matrix) const override;
+
+private:
+    parameters_type parameters_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_GAUSS_SEIDEL_HPP_
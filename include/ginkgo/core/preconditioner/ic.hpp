@@ -104,7 +104,9 @@ namespace preconditioner {
  * @ingroup LinOp
  */
 template <typename LSolverType = solver::LowerTrs<>, typename IndexType = int32>
-class Ic : public EnableLinOp<Ic<LSolverType, IndexType>>, public Transposable {
+class Ic : public EnableLinOp<Ic<LSolverType, IndexType>>,
+           public Transposable,
+           public Refactorizable {
     friend class EnableLinOp<Ic>;
     friend class EnablePolymorphicObject<Ic, LinOp>;
 
@@ -187,6 +189,35 @@ public:
         return std::move(transposed);
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * @note This is only supported if the factorization the preconditioner
+     *       was generated from is Refactorizable, e.g. factorization::Ic or
+     *       factorization::ParIc, and the preconditioner was not copied to a
+     *       different executor. The L solver is kept if it operates directly
+     *       on the factor, the L^H solver is regenerated from it.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override
+    {
+        GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+        auto factorization = std::dynamic_pointer_cast<Refactorizable>(
+            std::const_pointer_cast<Composition<value_type>>(factorization_));
+        if (!factorization) {
+            GKO_NOT_SUPPORTED(factorization_);
+        }
+        factorization->refactorize(new_matrix);
+        const auto l_factor = factorization_->get_operators()[0];
+        auto l_solver_base =
+            dynamic_cast<const solver::detail::SolverBaseLinOp*>(
+                l_solver_.get());
+        if (!l_solver_base ||
+            l_solver_base->get_system_matrix().get() != l_factor.get()) {
+            this->generate_l_solver(l_factor);
+        }
+        lh_solver_ = as<lh_solver_type>(l_solver_->conj_transpose());
+    }
+
     /**
      * Copy-assigns an IC preconditioner. Preserves the executor,
      * shallow-copies the solvers and parameters. Creates a clone of the solvers
@@ -199,10 +230,12 @@ public:
             auto exec = this->get_executor();
             l_solver_ = other.l_solver_;
             lh_solver_ = other.lh_solver_;
+            factorization_ = other.factorization_;
             parameters_ = other.parameters_;
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
                 lh_solver_ = gko::clone(exec, lh_solver_);
+                factorization_ = nullptr;
             }
         }
         return *this;
@@ -221,10 +254,12 @@ public:
             auto exec = this->get_executor();
             l_solver_ = std::move(other.l_solver_);
             lh_solver_ = std::move(other.lh_solver_);
+            factorization_ = std::move(other.factorization_);
             parameters_ = std::exchange(other.parameters_, parameters_type{});
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
                 lh_solver_ = gko::clone(exec, lh_solver_);
+                factorization_ = nullptr;
             }
         }
         return *this;
@@ -308,24 +343,26 @@ protected:
         }
         l_factor = comp->get_operators()[0];
         GKO_ASSERT_IS_SQUARE_MATRIX(l_factor);
+        if (comp->get_operators().size() == 2) {
+            GKO_ASSERT_EQUAL_DIMENSIONS(l_factor, comp->get_operators()[1]);
+        }
 
-        auto exec = this->get_executor();
+        factorization_ = comp;
+        this->generate_l_solver(l_factor);
+        lh_solver_ = as<lh_solver_type>(l_solver_->conj_transpose());
+    }
 
-        // If no factories are provided, generate default ones
+    /**
+     * Generates the L solver for the given factor. If no factory is provided,
+     * a default one is used.
+     */
+    void generate_l_solver(std::shared_ptr<const LinOp> l_factor)
+    {
         if (!parameters_.l_solver_factory) {
-            l_solver_ = generate_default_solver<l_solver_type>(exec, l_factor);
-            // If comp contains both factors: use the transposed factor to avoid
-            // transposing twice
-            if (comp->get_operators().size() == 2) {
-                auto lh_factor = comp->get_operators()[1];
-                GKO_ASSERT_EQUAL_DIMENSIONS(l_factor, lh_factor);
-                lh_solver_ = as<lh_solver_type>(l_solver_->conj_transpose());
-            } else {
-                lh_solver_ = as<lh_solver_type>(l_solver_->conj_transpose());
-            }
+            l_solver_ = generate_default_solver<l_solver_type>(
+                this->get_executor(), l_factor);
         } else {
             l_solver_ = parameters_.l_solver_factory->generate(l_factor);
-            lh_solver_ = as<lh_solver_type>(l_solver_->conj_transpose());
         }
     }
 
@@ -390,6 +427,7 @@ protected:
 private:
     std::shared_ptr<const l_solver_type> l_solver_{};
     std::shared_ptr<const lh_solver_type> lh_solver_{};
+    std::shared_ptr<const Composition<value_type>> factorization_{};
     /**
      * Manages a vector as a cache, so there is no need to allocate one
      * every time an intermediate vector is required. Copying an instance
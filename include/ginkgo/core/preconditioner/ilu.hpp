@@ -113,7 +113,8 @@ template <typename LSolverType = solver::LowerTrs<>,
           typename IndexType = int32>
 class Ilu : public EnableLinOp<
                 Ilu<LSolverType, USolverType, ReverseApply, IndexType>>,
-            public Transposable {
+            public Transposable,
+            public Refactorizable {
     friend class EnableLinOp<Ilu>;
     friend class EnablePolymorphicObject<Ilu, LinOp>;
 
@@ -205,6 +206,35 @@ public:
         return std::move(transposed);
     }
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * @note This is only supported if the factorization the preconditioner
+     *       was generated from is Refactorizable, e.g. factorization::Ilu or
+     *       factorization::ParIlu, and the preconditioner was not copied to
+     *       a different executor. The L and U solvers operating directly on
+     *       the factors are kept, together with their analysis data. All
+     *       other solvers are regenerated.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override
+    {
+        GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+        auto factorization = std::dynamic_pointer_cast<Refactorizable>(
+            std::const_pointer_cast<Composition<value_type>>(factorization_));
+        if (!factorization) {
+            GKO_NOT_SUPPORTED(factorization_);
+        }
+        factorization->refactorize(new_matrix);
+        const auto l_factor = factorization_->get_operators()[0];
+        const auto u_factor = factorization_->get_operators()[1];
+        if (!uses_factor(l_solver_.get(), l_factor.get())) {
+            this->generate_l_solver(l_factor);
+        }
+        if (!uses_factor(u_solver_.get(), u_factor.get())) {
+            this->generate_u_solver(u_factor);
+        }
+    }
+
     /**
      * Copy-assigns an ILU preconditioner. Preserves the executor,
      * shallow-copies the solvers and parameters. Creates a clone of the solvers
@@ -217,10 +247,12 @@ public:
             auto exec = this->get_executor();
             l_solver_ = other.l_solver_;
             u_solver_ = other.u_solver_;
+            factorization_ = other.factorization_;
             parameters_ = other.parameters_;
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
                 u_solver_ = gko::clone(exec, u_solver_);
+                factorization_ = nullptr;
             }
         }
         return *this;
@@ -239,10 +271,12 @@ public:
             auto exec = this->get_executor();
             l_solver_ = std::move(other.l_solver_);
             u_solver_ = std::move(other.u_solver_);
+            factorization_ = std::move(other.factorization_);
             parameters_ = std::exchange(other.parameters_, parameters_type{});
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
                 u_solver_ = gko::clone(exec, u_solver_);
+                factorization_ = nullptr;
             }
         }
         return *this;
@@ -342,21 +376,50 @@ protected:
         }
         GKO_ASSERT_EQUAL_DIMENSIONS(l_factor, u_factor);
 
-        auto exec = this->get_executor();
+        factorization_ = comp;
+        this->generate_l_solver(l_factor);
+        this->generate_u_solver(u_factor);
+    }
 
-        // If no factories are provided, generate default ones
+    /**
+     * Generates the L solver for the given factor. If no factory is provided,
+     * a default one is used.
+     */
+    void generate_l_solver(std::shared_ptr<const LinOp> l_factor)
+    {
         if (!parameters_.l_solver_factory) {
-            l_solver_ = generate_default_solver<l_solver_type>(exec, l_factor);
+            l_solver_ = generate_default_solver<l_solver_type>(
+                this->get_executor(), l_factor);
         } else {
             l_solver_ = parameters_.l_solver_factory->generate(l_factor);
         }
+    }
+
+    /**
+     * Generates the U solver for the given factor. If no factory is provided,
+     * a default one is used.
+     */
+    void generate_u_solver(std::shared_ptr<const LinOp> u_factor)
+    {
         if (!parameters_.u_solver_factory) {
-            u_solver_ = generate_default_solver<u_solver_type>(exec, u_factor);
+            u_solver_ = generate_default_solver<u_solver_type>(
+                this->get_executor(), u_factor);
         } else {
             u_solver_ = parameters_.u_solver_factory->generate(u_factor);
         }
     }
 
+    /**
+     * Checks whether the given solver operates directly on the given factor,
+     * i.e. it observes in-place updates of the factor values.
+     */
+    static bool uses_factor(const LinOp* solver, const LinOp* factor)
+    {
+        auto solver_base =
+            dynamic_cast<const solver::detail::SolverBaseLinOp*>(solver);
+        return solver_base && solver_base->get_system_matrix().get() == factor;
+    }
+
     /**
      * Prepares the intermediate vector for the solve by creating it and
      * by copying the values from `b`, so `b` acts as the initial guess.
@@ -418,6 +481,7 @@ protected:
 private:
     std::shared_ptr<const l_solver_type> l_solver_{};
     std::shared_ptr<const u_solver_type> u_solver_{};
+    std::shared_ptr<const Composition<value_type>> factorization_{};
     /**
      * Manages a vector as a cache, so there is no need to allocate one every
      * time an intermediate vector is required.
@@ -390,6 +390,10 @@ public:
          *       information specifically via this parameter, as the
          *       autodetection procedure is only a rough approximation of the
          *       true block structure.
+         * @note If it is not set and the system matrix is a matrix::Fbcsr
+         *       whose block size does not exceed max_block_size, the fixed
+         *       blocks of the Fbcsr matrix are used instead of the
+         *       autodetection.
          * @note The maximum block size set by the max_block_size parameter
          *       has to be respected when setting this parameter. Failure to do
          *       so will lead to undefined behavior.
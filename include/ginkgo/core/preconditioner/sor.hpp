@@ -0,0 +1,169 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_SOR_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_SOR_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * This class generates the (symmetric) successive over-relaxation
+ * preconditioner.
+ *
+ * Writing the system matrix as $A = L + D + U$ with its strictly lower
+ * triangular part $L$, diagonal $D$ and strictly upper triangular part $U$,
+ * the SOR preconditioner with relaxation factor $\omega \in (0, 2)$ is
+ * $M = \frac{1}{\omega} D + L$.
+ * The symmetric version (SSOR) additionally performs a backward sweep, i.e.
+ * $M = \frac{1}{2 - \omega} (\frac{1}{\omega} D + L)
+ * (\frac{1}{\omega} D)^{-1} (\frac{1}{\omega} D + U)$.
+ *
+ * This LinOpFactory does not create a new LinOp type, instead it returns a
+ * Composition of triangular solvers applied to the (scaled) triangular parts
+ * of the system matrix. By default, these are solver::LowerTrs and
+ * solver::UpperTrs, which on the OpenMP executor process independent rows
+ * in parallel.
+ * If the rows of the system matrix are reordered by a coloring beforehand,
+ * each color can be processed in a single parallel step.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  integral type of the sparsity pattern
+ *
+ * @ingroup precond
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Sor
+    : public EnablePolymorphicObject<Sor<ValueType, IndexType>, LinOpFactory>,
+      public EnablePolymorphicAssignment<Sor<ValueType, IndexType>> {
+public:
+    struct parameters_type;
+    friend class EnablePolymorphicObject<Sor, LinOpFactory>;
+    friend class enable_parameters_type<parameters_type, Sor>;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<value_type, index_type>;
+    using composition_type = Composition<value_type>;
+
+    struct parameters_type
+        : public enable_parameters_type<parameters_type, Sor> {
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by row, then by column) in order for the algorithm
+         * to work. If it is known that the matrix will be sorted, this
+         * parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, the preconditioner might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * `true` generates the symmetric SOR (SSOR) preconditioner with a
+         * forward and a backward sweep, `false` only the forward sweep.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(symmetric, false);
+
+        /**
+         * The relaxation factor $\omega$. It needs to be in $(0, 2)$.
+         */
+        remove_complex<value_type> GKO_FACTORY_PARAMETER_SCALAR(
+            relaxation_factor, remove_complex<value_type>(1.2));
+
+        /**
+         * The factory for the solver of the lower triangular part.
+         * The default value `nullptr` results in solver::LowerTrs.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            l_solver, nullptr);
+
+        /**
+         * The factory for the solver of the upper triangular part. It is only
+         * used if `symmetric` is set. The default value `nullptr` results in
+         * solver::UpperTrs.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            u_solver, nullptr);
+    };
+
+    /**
+     * Returns the parameters used to construct the factory.
+     *
+     * @return the parameters used to construct the factory.
+     */
+    const parameters_type& get_parameters() const { return parameters_; }
+
+    /**
+     * @copydoc LinOpFactory::generate
+     * @note This function overrides the default LinOpFactory::generate to
+     *       return a Composition instead of a generic LinOp, which would need
+     *       to be cast to Composition again to access its operators.
+     *       It is only necessary because smart pointers aren't covariant.
+     */
+    std::unique_ptr<composition_type> generate(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /** Creates a new parameter_type to set up the factory. */
+    static parameters_type build() { return {}; }
+
+protected:
+    explicit Sor(std::shared_ptr<const Executor> exec,
+                 const parameters_type& params = {});
+
+    std::unique_ptr<LinOp> generate_impl(
+        std::shared_ptr<const LinOp> system_matrix) const override;
+
+private:
+    parameters_type parameters_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_SOR_HPP_
@@ -0,0 +1,172 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_REORDER_COLORING_HPP_
+#define GKO_PUBLIC_CORE_REORDER_COLORING_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+
+
+/**
+ * Selects which rows need to be assigned different colors.
+ */
+enum class coloring_distance {
+    /** Two rows need different colors if they are adjacent. */
+    one,
+    /**
+     * Two rows need different colors if they are adjacent or have a common
+     * neighbor.
+     */
+    two
+};
+
+
+/**
+ * Computes a graph coloring of the (symmetrized) sparsity pattern of the input
+ * matrix and the permutation that groups the rows by their color.
+ *
+ * For a distance-1 coloring, rows of the same color do not couple with each
+ * other, so after applying the permutation symmetrically, the diagonal block
+ * of each color is a diagonal matrix. This allows operations like Gauss-Seidel
+ * sweeps, triangular solves or ILU(0) to process a whole color in parallel.
+ * A distance-2 coloring additionally guarantees that rows of the same color
+ * have no common neighbors, which allows for conflict-free parallel assembly.
+ *
+ * The colors are computed using a greedy algorithm, on OpenMP using
+ * speculative parallel coloring with conflict resolution. The coloring is
+ * always computed on the host.
+ *
+ * @tparam ValueType  the type used to store values of the system matrix
+ * @tparam IndexType  the type used to store sparsity pattern indices of the
+ *                    system matrix
+ */
+template <typename ValueType, typename IndexType>
+class Coloring
+    : public EnablePolymorphicObject<Coloring<ValueType, IndexType>,
+                                     LinOpFactory>,
+      public EnablePolymorphicAssignment<Coloring<ValueType, IndexType>> {
+public:
+    struct parameters_type;
+    friend class EnablePolymorphicObject<Coloring<ValueType, IndexType>,
+                                         LinOpFactory>;
+    friend class enable_parameters_type<parameters_type,
+                                        Coloring<ValueType, IndexType>>;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<value_type, index_type>;
+    using permutation_type = matrix::Permutation<index_type>;
+
+    struct parameters_type
+        : public enable_parameters_type<parameters_type,
+                                        Coloring<ValueType, IndexType>> {
+        /**
+         * Which rows need to be assigned different colors.
+         */
+        coloring_distance GKO_FACTORY_PARAMETER_SCALAR(distance,
+                                                       coloring_distance::one);
+
+        /**
+         * If the system matrix has a symmetric sparsity pattern, set this flag
+         * to `true` to skip the symmetrization of the pattern.
+         * Otherwise, the coloring may be invalid.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(symmetric_sparsity, false);
+    };
+
+    /**
+     * Returns the parameters used to construct the factory.
+     */
+    const parameters_type& get_parameters() { return parameters_; }
+
+    /**
+     * @copydoc LinOpFactory::generate
+     * @note This function overrides the default LinOpFactory::generate to
+     *       return a Permutation instead of a generic LinOp, which would need
+     *       to be cast to Permutation again to access its indices.
+     *       It is only necessary because smart pointers aren't covariant.
+     */
+    std::unique_ptr<permutation_type> generate(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /**
+     * Computes the permutation like generate(system_matrix), and additionally
+     * returns the offsets of the colors within the permutation.
+     *
+     * @param system_matrix  the matrix to be colored
+     * @param color_ptrs  the output array, it will be resized to hold
+     *                    num_colors + 1 entries, such that the rows with color
+     *                    `c` are `permutation[color_ptrs[c]]` to
+     *                    `permutation[color_ptrs[c + 1] - 1]`.
+     *
+     * @return the permutation grouping the rows by color.
+     */
+    std::unique_ptr<permutation_type> generate(
+        std::shared_ptr<const LinOp> system_matrix,
+        array<index_type>& color_ptrs) const;
+
+    /** Creates a new parameter_type to set up the factory. */
+    static parameters_type build() { return {}; }
+
+protected:
+    explicit Coloring(std::shared_ptr<const Executor> exec,
+                      const parameters_type& params = {});
+
+    std::unique_ptr<LinOp> generate_impl(
+        std::shared_ptr<const LinOp> system_matrix) const override;
+
+private:
+    parameters_type parameters_;
+};
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_REORDER_COLORING_HPP_
@@ -34,12 +34,6 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
 
 
-#include <ginkgo/config.hpp>
-
-
-#if GKO_HAVE_METIS
-
-
 #include <memory>
 #include <unordered_map>
 
@@ -65,8 +59,17 @@ namespace reorder {
 
 
 /**
- * Computes a Nested Dissection (ND) reordering of an input matrix using the
- * METIS library.
+ * Computes a Nested Dissection (ND) reordering of an input matrix.
+ *
+ * If Ginkgo was built with METIS support, the ordering is computed using
+ * METIS_NodeND by default. Otherwise, a built-in multilevel nested dissection
+ * is used: Each subgraph is bisected by coarsening it via heavy-edge
+ * matching, bisecting the coarsest graph and refining the bisection with
+ * Fiduccia-Mattheyses on each level, before the edge separator is turned
+ * into a minimal vertex separator. Small subgraphs are ordered using
+ * approximate minimum degree. On the OpenMP executor, independent
+ * subgraphs are ordered in parallel tasks. The ordering is computed on the
+ * host, and it only depends on the sparsity pattern of A + A^T.
  *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
@@ -93,9 +96,24 @@ public:
     struct parameters_type
         : public enable_parameters_type<
               parameters_type, NestedDissection<ValueType, IndexType>> {
+        /**
+         * If Ginkgo was built with METIS support, use METIS to compute the
+         * ordering. Otherwise, or if this is set to `false`, the built-in
+         * multilevel nested dissection is used.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(use_metis, true);
+
+        /**
+         * The built-in nested dissection stops dissecting subgraphs with at
+         * most this many vertices and orders them using approximate minimum
+         * degree instead.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(max_leaf_size, 64);
+
         /**
          * The options to be passed on to METIS, stored as key-value pairs.
          * Any options that are not set here use their default value.
+         * They are ignored if METIS is not used.
          */
         std::unordered_map<int, int> options;
 
@@ -145,7 +163,4 @@ private:
 }  // namespace gko
 
 
-#endif  // GKO_HAVE_METIS
-
-
 #endif  // GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
@@ -0,0 +1,284 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+
+
+#include <utility>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Chebyshev iteration is an iterative method for solving nonsymmetric problems
+ * based on some knowledge of the spectrum of the (preconditioned) system
+ * matrix. It avoids the computation of inner products, which may be a
+ * performance bottleneck for distributed system. Chebyshev iteration is
+ * developed based on Chebyshev polynomials of the first kind.
+ *
+ * This implementation follows the algorithm in "Templates for the Solution of
+ * Linear Systems: Building Blocks for Iterative Methods, 2nd Edition".
+ *
+ * ```
+ * solution = initial_guess
+ * while not converged:
+ *     residual = b - A solution
+ *     error = preconditioner(A) * residual
+ *     if first iteration:
+ *         update_solution = error
+ *         alpha = 1 / center
+ *     else:
+ *         beta = (focal_dir * alpha / 2)^2  (or 0.5 * (focal_dir * alpha)^2
+ *                                            in the second iteration)
+ *         alpha = 1 / (center - beta / alpha)
+ *         update_solution = error + beta * update_solution
+ *     solution = solution + alpha * update_solution
+ * ```
+ *
+ * where `center = (foci.second + foci.first) / 2` and
+ * `focal_dir = (foci.second - foci.first) / 2`. The scalars `alpha` and `beta`
+ * only depend on the foci, so they are computed on the host and the
+ * iteration itself does not contain any reduction operation. This makes
+ * Chebyshev iteration well-suited as a smoother in multigrid methods (see
+ * `Multigrid::parameters_type::pre_smoother`).
+ *
+ * If the foci are not given explicitly, they are estimated during the
+ * generation from the largest eigenvalue of the preconditioned system matrix,
+ * which is approximated by a few steps of the Lanczos process (computed from
+ * the coefficients of preconditioned conjugate gradient steps on a
+ * pseudo-random right-hand side). This estimate assumes the system matrix and
+ * the preconditioner to be symmetric (or Hermitian) positive definite.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Chebyshev
+    : public EnableLinOp<Chebyshev<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 Chebyshev<ValueType>>,
+      public EnableApplyWithInitialGuess<Chebyshev<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<Chebyshev>;
+    friend class EnablePolymorphicObject<Chebyshev, LinOp>;
+    friend class EnableApplyWithInitialGuess<Chebyshev>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = Chebyshev<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override
+    {
+        return this->get_default_initial_guess() ==
+               initial_guess_mode::provided;
+    }
+
+    /**
+     * Returns the foci of the ellipse containing the spectrum of the
+     * preconditioned system matrix that are used in the iteration. They are
+     * either the foci from the factory parameters or the estimated ones.
+     *
+     * @return the pair of (smaller, larger) foci
+     */
+    std::pair<value_type, value_type> get_foci() const { return foci_; }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER_VECTOR(criteria, nullptr);
+
+        /**
+         * Preconditioner factory.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            preconditioner, nullptr);
+
+        /**
+         * Already generated preconditioner. If one is provided, the factory
+         * `preconditioner` will be ignored.
+         */
+        std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
+            generated_preconditioner, nullptr);
+
+        /**
+         * The pair of foci of the ellipse containing the spectrum of the
+         * preconditioned system matrix. If both foci are zero (default), they
+         * are estimated during the generation.
+         */
+        std::pair<value_type, value_type> GKO_FACTORY_PARAMETER_VECTOR(
+            foci, value_type{0}, value_type{0});
+
+        /**
+         * The number of Lanczos steps used to estimate the largest eigenvalue
+         * of the preconditioned system matrix. It is only used if the foci are
+         * not provided.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(estimation_iters, 10);
+
+        /**
+         * The smaller focus is set to `estimate_lower_factor` times the
+         * estimated largest eigenvalue. The default targets the upper part of
+         * the spectrum as suitable for smoothing.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(estimate_lower_factor, 0.1);
+
+        /**
+         * The larger focus is set to `estimate_upper_factor` times the
+         * estimated largest eigenvalue. It should be larger than one since the
+         * Lanczos estimate approaches the largest eigenvalue from below.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(estimate_upper_factor, 1.1);
+
+        /**
+         * Default initial guess mode. The available options are under
+         * initial_guess_mode.
+         */
+        initial_guess_mode GKO_FACTORY_PARAMETER_SCALAR(
+            default_initial_guess, initial_guess_mode::provided);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Chebyshev, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x,
+                          initial_guess_mode guess) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* b, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* alpha, const LinOp* b,
+                                       const LinOp* beta, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    /**
+     * Estimates the foci from the largest eigenvalue of the preconditioned
+     * system matrix.
+     */
+    void estimate_foci();
+
+    explicit Chebyshev(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Chebyshev>(std::move(exec))
+    {}
+
+    explicit Chebyshev(const Factory* factory,
+                       std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Chebyshev>(factory->get_executor(),
+                                 gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, Chebyshev<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()},
+          foci_{parameters_.foci}
+    {
+        this->set_default_initial_guess(parameters_.default_initial_guess);
+        if (foci_.first == value_type{0} && foci_.second == value_type{0}) {
+            this->estimate_foci();
+        }
+    }
+
+private:
+    std::pair<value_type, value_type> foci_;
+};
+
+
+template <typename ValueType>
+struct workspace_traits<Chebyshev<ValueType>> {
+    using Solver = Chebyshev<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int residual = 0;
+    // inner solution vector
+    constexpr static int inner_solution = 1;
+    // update solution
+    constexpr static int update_solution = 2;
+    // constant 1.0 scalar
+    constexpr static int one = 3;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 4;
+
+    // stopping status array
+    constexpr static int stop = 0;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_PUBLIC_CORE_SOLVER_DIRECT_HPP_
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/factorization/factorization.hpp>
 #include <ginkgo/core/solver/solver_base.hpp>
@@ -60,7 +61,8 @@ class Direct : public EnableLinOp<Direct<ValueType, IndexType>>,
                public gko::solver::EnableSolverBase<
                    Direct<ValueType, IndexType>,
                    factorization::Factorization<ValueType, IndexType>>,
-               public Transposable {
+               public Transposable,
+               public Refactorizable {
     friend class EnablePolymorphicObject<Direct, LinOp>;
 
 public:
@@ -74,6 +76,16 @@ public:
 
     std::unique_ptr<LinOp> conj_transpose() const override;
 
+    /**
+     * @copydoc Refactorizable::refactorize
+     *
+     * If a reordering was used to generate the solver, the new matrix is
+     * permuted with the same permutation before refactorizing. The
+     * triangular solvers and their analysis data are kept, since they refer
+     * to the factors that are updated in-place.
+     */
+    void refactorize(std::shared_ptr<const LinOp> new_matrix) override;
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -88,6 +100,17 @@ public:
         /** The factorization factory to use for generating the factors. */
         std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
             factorization, nullptr);
+
+        /**
+         * The reordering factory used to compute a fill-reducing permutation
+         * P of the system matrix, e.g. reorder::Amd. It needs to generate a
+         * matrix::Permutation<IndexType>. If it is set, the factorization is
+         * computed for P A P^T, and the right-hand side and solution are
+         * permuted accordingly in each apply. It is ignored if the system
+         * matrix is already a Factorization.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            reordering, nullptr);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Direct, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -118,6 +141,7 @@ private:
 
     std::unique_ptr<lower_type> lower_solver_;
     std::unique_ptr<upper_type> upper_solver_;
+    array<index_type> permutation_;
 };
 
 
@@ -147,6 +171,8 @@ struct workspace_traits<
 
     // intermediate vector
     constexpr static int intermediate = 0;
+    // permuted right-hand side and solution vector
+    constexpr static int permuted = 1;
 };
 
 
@@ -215,6 +215,18 @@ public:
      */
     void set_cycle(multigrid::cycle cycle) { parameters_.cycle = cycle; }
 
+    /**
+     * Updates the hierarchy for a new system matrix with the same sparsity
+     * pattern as the current one, e.g. in time-stepping or Newton iterations.
+     * The multigrid levels keep their transfer operators and the sparsity
+     * patterns of their coarse matrices and only recompute the coarse values.
+     * The smoothers and the coarsest solver are regenerated from the updated
+     * matrices.
+     *
+     * @param new_matrix  the new system matrix
+     */
+    void update_values(std::shared_ptr<const LinOp> new_matrix);
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -432,6 +444,26 @@ protected:
      */
     void generate();
 
+    /**
+     * Generates the pre-, mid- and post-smoothers of a multigrid level.
+     *
+     * @param index  the index of the level factory in the mg_level list
+     * @param mg_level  the multigrid level
+     */
+    void generate_smoothers(
+        size_type index,
+        std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level);
+
+    /**
+     * Generates the coarsest solver for the coarse matrix of the last level.
+     *
+     * @param level  the number of levels
+     * @param mg_level  the last multigrid level
+     */
+    void generate_coarsest_solver(
+        size_type level,
+        std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level);
+
     explicit Multigrid(std::shared_ptr<const Executor> exec);
 
     explicit Multigrid(const Factory* factory,
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/graph_bisection.hpp"
 
 
 namespace gko {
@@ -101,6 +102,52 @@ GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(
     GKO_DECLARE_PARTITION_BUILD_STARTING_INDICES);
 
 
+// subproblems smaller than this are not worth spawning a task for
+constexpr int min_task_size = 1024;
+
+
+template <typename IndexType>
+void partition_subproblem(
+    std::shared_ptr<const DefaultExecutor> exec,
+    experimental::reorder::detail::kway_subproblem<IndexType>& problem,
+    double imbalance, comm_index_type* mapping)
+{
+    auto children = experimental::reorder::detail::kway_partition_step(
+        exec, problem, imbalance, mapping);
+    for (auto& child : children) {
+        auto child_ptr = &child;
+#pragma omp task firstprivate(child_ptr) \
+    if (child.graph.get_num_vertices() >= min_task_size)
+        partition_subproblem(exec, *child_ptr, imbalance, mapping);
+    }
+#pragma omp taskwait
+}
+
+
+template <typename IndexType>
+void compute_graph_mapping(std::shared_ptr<const DefaultExecutor> exec,
+                           IndexType num_vertices, const IndexType* row_ptrs,
+                           const IndexType* col_idxs, comm_index_type num_parts,
+                           double imbalance, comm_index_type* mapping)
+{
+    auto problem = experimental::reorder::detail::create_kway_problem(
+        exec, num_vertices, row_ptrs, col_idxs, num_parts);
+    // the two sides of each bisection are independent, so they can be
+    // partitioned in separate tasks
+#pragma omp parallel
+#pragma omp single
+    partition_subproblem(
+        exec, problem,
+        experimental::reorder::detail::get_bisection_imbalance(imbalance,
+                                                               num_parts),
+        mapping);
+    experimental::reorder::detail::refine_kway(
+        exec, num_vertices, row_ptrs, col_idxs, num_parts, imbalance, mapping);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_PARTITION_COMPUTE_GRAPH_MAPPING);
+
+
 }  // namespace partition
 }  // namespace omp
 }  // namespace kernels
@@ -34,18 +34,22 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 
 
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/base/iterator_factory.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
 #include "core/factorization/elimination_forest.hpp"
 #include "core/factorization/lu_kernels.hpp"
 #include "core/matrix/csr_lookup.hpp"
+#include "omp/components/atomic.hpp"
 
 
 namespace gko {
@@ -59,6 +63,111 @@ namespace omp {
 namespace cholesky {
 
 
+template <typename IndexType>
+void compute_skeleton_tree(std::shared_ptr<const DefaultExecutor> exec,
+                           const IndexType* row_ptrs, const IndexType* cols,
+                           size_type size, IndexType* out_row_ptrs,
+                           IndexType* out_cols)
+{
+    // Boruvka's algorithm on the lower triangular entries, using their
+    // nonzero index as edge weight. This weight orders the edges by row like
+    // Kruskal's algorithm in the reference kernel, and since it is unique,
+    // both compute the same minimum spanning forest.
+    const auto num_rows = static_cast<IndexType>(size);
+    const auto nnz = static_cast<size_type>(row_ptrs[size]);
+    const auto no_edge = std::numeric_limits<IndexType>::max();
+    // the representative of each node's component
+    vector<IndexType> comps(size, {exec});
+    // the component each component is hooked to
+    vector<IndexType> hooks(size, {exec});
+    vector<IndexType> tmp_hooks(size, {exec});
+    vector<IndexType> min_edges(size, {exec});
+    vector<uint8> tree_edges(nnz, {exec});
+#pragma omp parallel for
+    for (IndexType node = 0; node < num_rows; node++) {
+        comps[node] = node;
+    }
+    bool hooked = true;
+    while (hooked) {
+        hooked = false;
+#pragma omp parallel for
+        for (IndexType node = 0; node < num_rows; node++) {
+            min_edges[node] = no_edge;
+            hooks[node] = node;
+        }
+        // find the minimum edge leaving each component
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            const auto row_comp = comps[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = cols[nz];
+                if (col < row && comps[col] != row_comp) {
+                    atomic_min(min_edges[row_comp], nz);
+                    atomic_min(min_edges[comps[col]], nz);
+                }
+            }
+        }
+        // hook each component to its neighbor along this edge. If two
+        // components share their minimum edge, only the larger one is hooked.
+#pragma omp parallel for reduction(|| : hooked)
+        for (IndexType comp = 0; comp < num_rows; comp++) {
+            const auto edge = min_edges[comp];
+            if (edge != no_edge) {
+                const auto row = static_cast<IndexType>(
+                    std::upper_bound(row_ptrs, row_ptrs + size + 1, edge) -
+                    row_ptrs - 1);
+                const auto row_comp = comps[row];
+                const auto col_comp = comps[cols[edge]];
+                const auto other = row_comp == comp ? col_comp : row_comp;
+                if (min_edges[other] != edge || other < comp) {
+                    hooks[comp] = other;
+                    tree_edges[edge] = 1;
+                    hooked = true;
+                }
+            }
+        }
+        // pointer jumping to find the new representatives
+        bool changed = true;
+        while (changed) {
+            changed = false;
+#pragma omp parallel for reduction(|| : changed)
+            for (IndexType comp = 0; comp < num_rows; comp++) {
+                const auto hook = hooks[comp];
+                tmp_hooks[comp] = hooks[hook];
+                changed = changed || tmp_hooks[comp] != hook;
+            }
+            std::swap(hooks, tmp_hooks);
+        }
+#pragma omp parallel for
+        for (IndexType node = 0; node < num_rows; node++) {
+            comps[node] = hooks[comps[node]];
+        }
+    }
+    // compress the tree edges
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        IndexType count{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            count += tree_edges[nz];
+        }
+        out_row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, size + 1);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (tree_edges[nz]) {
+                out_cols[out_nz] = cols[nz];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_CHOLESKY_COMPUTE_SKELETON_TREE);
+
+
 template <typename ValueType, typename IndexType>
 void symbolic_count(std::shared_ptr<const DefaultExecutor> exec,
                     const matrix::Csr<ValueType, IndexType>* mtx,
@@ -34,13 +34,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cassert>
+#include <functional>
 #include <memory>
+#include <thread>
 
 
 #include <ginkgo/core/matrix/csr.hpp>
 
 
 #include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
 #include "core/matrix/csr_lookup.hpp"
 
 
@@ -55,6 +59,240 @@ namespace omp {
 namespace lu_factorization {
 
 
+template <typename IndexType>
+void symbolic_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                        const IndexType* row_ptrs, const IndexType* col_idxs,
+                        size_type num_rows, IndexType* out_row_ptrs,
+                        array<IndexType>& out_col_idx_array)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    // rows may be finished out of order, so we store each one separately
+    vector<vector<IndexType>> row_cols(num_rows, vector<IndexType>{{exec}},
+                                       {exec});
+    vector<IndexType> diags(num_rows, {exec});
+    vector<int> ready(num_rows, 0, {exec});
+    IndexType next_row{};
+#pragma omp parallel
+    {
+        vector<IndexType> fill(num_rows, -1, {exec});
+        deque<IndexType> frontier_queue{{exec}};
+        while (true) {
+            // rows are claimed in increasing order, so every row we wait for
+            // is already being processed by another thread
+            IndexType row;
+#pragma omp atomic capture
+            row = next_row++;
+            if (row >= size) {
+                break;
+            }
+            auto& out_cols = row_cols[row];
+            fill[row] = row;
+            // first copy over the original row and add all lower triangular
+            // entries to the queue
+            const auto row_begin = row_ptrs[row];
+            const auto row_end = row_ptrs[row + 1];
+            for (auto nz = row_begin; nz < row_end; nz++) {
+                const auto col = col_idxs[nz];
+                fill[col] = row;
+                if (col < row) {
+                    frontier_queue.push_back(col);
+                }
+                out_cols.push_back(col);
+            }
+            // then add fill-in for all queued entries
+            while (!frontier_queue.empty()) {
+                const auto frontier = frontier_queue.front();
+                assert(frontier < row);
+                frontier_queue.pop_front();
+                // wait until the row of this node has been finalized
+                int frontier_ready{};
+                while (true) {
+#pragma omp atomic read
+                    frontier_ready = ready[frontier];
+                    if (frontier_ready) {
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+#pragma omp flush
+                // add the fill-in for this node from U
+                const auto& frontier_cols = row_cols[frontier];
+                const auto upper_begin =
+                    frontier_cols.begin() + diags[frontier] + 1;
+                for (auto it = upper_begin; it != frontier_cols.end(); ++it) {
+                    const auto col = *it;
+                    if (fill[col] < row) {
+                        fill[col] = row;
+                        out_cols.push_back(col);
+                        // any fill-in on the lower triangle may introduce
+                        // additional fill-in when eliminated, so we need to
+                        // enqueue it as well.
+                        if (col < row) {
+                            frontier_queue.push_back(col);
+                        }
+                    }
+                }
+            }
+            // restore sorting and find diagonal entry to separate L and U
+            std::sort(out_cols.begin(), out_cols.end());
+            auto diag_it =
+                std::lower_bound(out_cols.begin(), out_cols.end(), row);
+            // add diagonal if it's missing
+            if (diag_it == out_cols.end() || *diag_it != row) {
+                diag_it = out_cols.insert(diag_it, row);
+            }
+            diags[row] = std::distance(out_cols.begin(), diag_it);
+#pragma omp flush
+#pragma omp atomic write
+            ready[row] = 1;
+        }
+    }
+#pragma omp parallel for
+    for (IndexType row = 0; row < size; row++) {
+        out_row_ptrs[row] = row_cols[row].size();
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    out_col_idx_array.resize_and_reset(out_row_ptrs[num_rows]);
+    const auto out_col_idxs = out_col_idx_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < size; row++) {
+        std::copy(row_cols[row].begin(), row_cols[row].end(),
+                  out_col_idxs + out_row_ptrs[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_LU_SYMBOLIC_FACTORIZE);
+
+
+template <typename IndexType>
+void symbolic_factorize_fill_level(
+    std::shared_ptr<const DefaultExecutor> exec, const IndexType* row_ptrs,
+    const IndexType* col_idxs, size_type num_rows, size_type fill_level,
+    IndexType* out_row_ptrs, array<IndexType>& out_col_idx_array)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    const auto max_level =
+        static_cast<IndexType>(std::min(fill_level, num_rows));
+    // rows may be finished out of order, so we store each one separately
+    vector<vector<IndexType>> row_cols(num_rows, vector<IndexType>{{exec}},
+                                       {exec});
+    vector<vector<IndexType>> row_levels(
+        num_rows, vector<IndexType>{{exec}}, {exec});
+    vector<IndexType> diags(num_rows, {exec});
+    vector<int> ready(num_rows, 0, {exec});
+    IndexType next_row{};
+#pragma omp parallel
+    {
+        // level of fill of each entry in the current row, -1 if not present
+        vector<IndexType> levels(num_rows, -1, {exec});
+        vector<IndexType> frontier_heap{{exec}};
+        const auto heap_cmp = std::greater<IndexType>{};
+        while (true) {
+            // rows are claimed in increasing order, so every row we wait for
+            // is already being processed by another thread
+            IndexType row;
+#pragma omp atomic capture
+            row = next_row++;
+            if (row >= size) {
+                break;
+            }
+            auto& out_cols = row_cols[row];
+            // the original entries have level 0
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                levels[col] = 0;
+                out_cols.push_back(col);
+                if (col < row) {
+                    frontier_heap.push_back(col);
+                    std::push_heap(frontier_heap.begin(), frontier_heap.end(),
+                                   heap_cmp);
+                }
+            }
+            // the lower triangular entries need to be eliminated in increasing
+            // order, since their level is only final once all previous ones
+            // were eliminated
+            while (!frontier_heap.empty()) {
+                std::pop_heap(frontier_heap.begin(), frontier_heap.end(),
+                              heap_cmp);
+                const auto frontier = frontier_heap.back();
+                frontier_heap.pop_back();
+                const auto frontier_level = levels[frontier];
+                // wait until the row of this node has been finalized
+                int frontier_ready{};
+                while (true) {
+#pragma omp atomic read
+                    frontier_ready = ready[frontier];
+                    if (frontier_ready) {
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+#pragma omp flush
+                // add the fill-in for this node from U
+                const auto& frontier_cols = row_cols[frontier];
+                const auto& frontier_levels = row_levels[frontier];
+                const auto upper_begin = diags[frontier] + 1;
+                const auto upper_end =
+                    static_cast<IndexType>(frontier_cols.size());
+                for (auto i = upper_begin; i < upper_end; i++) {
+                    const auto col = frontier_cols[i];
+                    const auto level = frontier_level + frontier_levels[i] + 1;
+                    if (level > max_level) {
+                        continue;
+                    }
+                    if (levels[col] < 0) {
+                        levels[col] = level;
+                        out_cols.push_back(col);
+                        if (col < row) {
+                            frontier_heap.push_back(col);
+                            std::push_heap(frontier_heap.begin(),
+                                           frontier_heap.end(), heap_cmp);
+                        }
+                    } else {
+                        levels[col] = std::min(levels[col], level);
+                    }
+                }
+            }
+            // add diagonal if it's missing
+            if (levels[row] < 0) {
+                levels[row] = 0;
+                out_cols.push_back(row);
+            }
+            std::sort(out_cols.begin(), out_cols.end());
+            auto& out_levels = row_levels[row];
+            out_levels.reserve(out_cols.size());
+            const auto row_nnz = static_cast<IndexType>(out_cols.size());
+            for (IndexType i = 0; i < row_nnz; i++) {
+                const auto col = out_cols[i];
+                if (col == row) {
+                    diags[row] = i;
+                }
+                out_levels.push_back(levels[col]);
+                levels[col] = -1;
+            }
+#pragma omp flush
+#pragma omp atomic write
+            ready[row] = 1;
+        }
+    }
+#pragma omp parallel for
+    for (IndexType row = 0; row < size; row++) {
+        out_row_ptrs[row] = row_cols[row].size();
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    out_col_idx_array.resize_and_reset(out_row_ptrs[num_rows]);
+    const auto out_col_idxs = out_col_idx_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < size; row++) {
+        std::copy(row_cols[row].begin(), row_cols[row].end(),
+                  out_col_idxs + out_row_ptrs[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL);
+
+
 template <typename ValueType, typename IndexType>
 void initialize(std::shared_ptr<const DefaultExecutor> exec,
                 const matrix::Csr<ValueType, IndexType>* mtx,
@@ -98,7 +336,7 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
                const int32* lookup_storage, const IndexType* diag_idxs,
                matrix::Csr<ValueType, IndexType>* factors,
-               array<int>& tmp_storage)
+               bool checked_lookup, array<int>& tmp_storage)
 {
     const auto num_rows = factors->get_size()[0];
     const auto row_ptrs = factors->get_const_row_ptrs();
@@ -120,8 +358,16 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
             for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
                 const auto col = cols[dep_nz];
                 const auto val = vals[dep_nz];
-                const auto nz = row_begin + lookup.lookup_unsafe(col);
-                vals[nz] -= scale * val;
+                if (checked_lookup) {
+                    // drop updates outside the sparsity pattern
+                    const auto idx = lookup[col];
+                    if (idx != invalid_index<IndexType>()) {
+                        vals[row_begin + idx] -= scale * val;
+                    }
+                } else {
+                    const auto nz = row_begin + lookup.lookup_unsafe(col);
+                    vals[nz] -= scale * val;
+                }
             }
         }
     }
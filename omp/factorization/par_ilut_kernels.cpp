@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/dense.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/base/utils.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 #include "core/matrix/coo_builder.hpp"
@@ -66,24 +67,118 @@ namespace omp {
 namespace par_ilut_factorization {
 
 
+constexpr auto bucket_count = 1 << sampleselect_searchtree_height;
+constexpr auto sample_size = bucket_count * sampleselect_oversampling;
+// below this size, a sequential selection is faster than another
+// sampleselect pass
+constexpr auto sampleselect_basecase_size = 16 * sample_size;
+
+
 template <typename ValueType, typename IndexType>
 void threshold_select(std::shared_ptr<const DefaultExecutor> exec,
                       const matrix::Csr<ValueType, IndexType>* m,
                       IndexType rank, array<ValueType>& tmp,
-                      array<remove_complex<ValueType>>&,
+                      array<remove_complex<ValueType>>& tmp2,
                       remove_complex<ValueType>& threshold)
 {
+    using AbsType = remove_complex<ValueType>;
     auto values = m->get_const_values();
     IndexType size = m->get_num_stored_elements();
     tmp.resize_and_reset(size);
-    std::copy_n(values, size, tmp.get_data());
-
-    auto begin = tmp.get_data();
-    auto target = begin + rank;
-    auto end = begin + size;
-    std::nth_element(begin, target, end,
-                     [](ValueType a, ValueType b) { return abs(a) < abs(b); });
-    threshold = abs(*target);
+    tmp2.resize_and_reset(size);
+    // tmp is at least as large as tmp2, so we can use both of them as
+    // ping-pong buffers for the absolute values
+    auto in = tmp2.get_data();
+    auto out = reinterpret_cast<AbsType*>(tmp.get_data());
+#pragma omp parallel for
+    for (IndexType nz = 0; nz < size; ++nz) {
+        in[nz] = abs(values[nz]);
+    }
+    const auto num_threads = omp_get_max_threads();
+    vector<AbsType> sample(sample_size, {exec});
+    vector<IndexType> histograms(bucket_count * num_threads, {exec});
+    vector<IndexType> thread_offsets(num_threads, {exec});
+    // recursively narrow down the range to the bucket containing the rank
+    while (size > sampleselect_basecase_size) {
+        // pick and sort sample
+        // assuming rounding towards zero
+        auto stride = double(size) / sample_size;
+        for (IndexType i = 0; i < sample_size; ++i) {
+            sample[i] = in[static_cast<IndexType>(i * stride)];
+        }
+        std::sort(sample.begin(), sample.end());
+        // pick splitters
+        for (IndexType i = 0; i < bucket_count - 1; ++i) {
+            // shift by one so we get upper bounds for the buckets
+            sample[i] = sample[(i + 1) * sampleselect_oversampling];
+        }
+        const auto splitters = sample.data();
+        auto bucket_of = [&](AbsType val) {
+            // smallest bucket s.t. splitters[bucket] > val
+            return static_cast<IndexType>(std::distance(
+                splitters,
+                std::upper_bound(splitters, splitters + bucket_count - 1,
+                                 val)));
+        };
+        IndexType rank_bucket{};
+        IndexType bucket_begin{};
+        IndexType bucket_size{};
+#pragma omp parallel num_threads(num_threads)
+        {
+            const auto tid = omp_get_thread_num();
+            auto local_histogram = histograms.data() + tid * bucket_count;
+            std::fill_n(local_histogram, bucket_count, IndexType{});
+            // both loops need to use the same static schedule, so every
+            // thread compacts exactly the elements it counted
+#pragma omp for schedule(static)
+            for (IndexType nz = 0; nz < size; ++nz) {
+                local_histogram[bucket_of(in[nz])]++;
+            }
+#pragma omp single
+            {
+                // determine the bucket containing the rank:
+                // bucket_begin <= rank < bucket_begin + bucket_size
+                const auto team_size = omp_get_num_threads();
+                for (rank_bucket = 0; rank_bucket < bucket_count;
+                     ++rank_bucket) {
+                    bucket_size = 0;
+                    for (int thread = 0; thread < team_size; ++thread) {
+                        bucket_size +=
+                            histograms[thread * bucket_count + rank_bucket];
+                    }
+                    if (rank < bucket_begin + bucket_size) {
+                        break;
+                    }
+                    bucket_begin += bucket_size;
+                }
+                // compute output offsets for each thread
+                IndexType offset{};
+                for (int thread = 0; thread < team_size; ++thread) {
+                    thread_offsets[thread] = offset;
+                    offset += histograms[thread * bucket_count + rank_bucket];
+                }
+            }
+            // extract the elements from the bucket containing the rank
+            auto out_nz = thread_offsets[tid];
+#pragma omp for schedule(static)
+            for (IndexType nz = 0; nz < size; ++nz) {
+                if (bucket_of(in[nz]) == rank_bucket) {
+                    out[out_nz] = in[nz];
+                    out_nz++;
+                }
+            }
+        }
+        if (bucket_size == size) {
+            // the sample didn't separate the values (e.g. many duplicates),
+            // so further passes would not make any progress
+            break;
+        }
+        rank -= bucket_begin;
+        size = bucket_size;
+        std::swap(in, out);
+    }
+    std::nth_element(in, in + rank, in + size);
+    threshold = in[rank];
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -180,10 +275,6 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL);
 
 
-constexpr auto bucket_count = 1 << sampleselect_searchtree_height;
-constexpr auto sample_size = bucket_count * sampleselect_oversampling;
-
-
 template <typename ValueType, typename IndexType>
 void threshold_filter_approx(std::shared_ptr<const DefaultExecutor> exec,
                              const matrix::Csr<ValueType, IndexType>* m,
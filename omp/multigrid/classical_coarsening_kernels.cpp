@@ -0,0 +1,297 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/classical_coarsening_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The classical coarsening namespace.
+ *
+ * @ingroup classical_coarsening
+ */
+namespace classical_coarsening {
+
+
+template <typename ValueType, typename IndexType>
+void compute_strength(std::shared_ptr<const DefaultExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType>* mtx,
+                      remove_complex<ValueType> threshold,
+                      matrix::Csr<ValueType, IndexType>* strength)
+{
+    const auto num_rows = static_cast<IndexType>(mtx->get_size()[0]);
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    vector<remove_complex<ValueType>> max_abs(num_rows, {exec});
+    const auto is_strong = [&](IndexType row, IndexType nz) {
+        return col_idxs[nz] != row && max_abs[row] > 0 &&
+               abs(vals[nz]) >= threshold * max_abs[row];
+    };
+    auto out_row_ptrs = strength->get_row_ptrs();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] != row) {
+                max_abs[row] = std::max(max_abs[row], abs(vals[nz]));
+            }
+        }
+        IndexType count{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            count += is_strong(row, nz);
+        }
+        out_row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_nnz = static_cast<size_type>(out_row_ptrs[num_rows]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{strength};
+    auto& out_col_idxs_array = builder.get_col_idx_array();
+    auto& out_vals_array = builder.get_value_array();
+    out_col_idxs_array.resize_and_reset(out_nnz);
+    out_vals_array.resize_and_reset(out_nnz);
+    auto out_col_idxs = out_col_idxs_array.get_data();
+    auto out_vals = out_vals_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (is_strong(row, nz)) {
+                out_col_idxs[out_nz] = col_idxs[nz];
+                out_vals[out_nz] = vals[nz];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_COMPUTE_STRENGTH);
+
+
+template <typename ValueType, typename IndexType>
+void select_coarse_points(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* strength,
+    const matrix::Csr<ValueType, IndexType>* strength_transposed,
+    array<IndexType>& coarse_map, IndexType* num_coarse)
+{
+    constexpr int8 fine = 0;
+    constexpr int8 undecided = 1;
+    constexpr int8 coarse = 2;
+    using key_type = std::tuple<IndexType, uint32, IndexType>;
+    const auto num_rows = static_cast<IndexType>(strength->get_size()[0]);
+    const auto row_ptrs = strength->get_const_row_ptrs();
+    const auto col_idxs = strength->get_const_col_idxs();
+    const auto t_row_ptrs = strength_transposed->get_const_row_ptrs();
+    const auto t_col_idxs = strength_transposed->get_const_col_idxs();
+    vector<int8> state(num_rows, {exec});
+    vector<int8> changed(num_rows, {exec});
+    // the measure is the number of rows strongly depending on a row, with a
+    // pseudo-random tie-breaker, rows nobody depends on become fine points
+    const auto get_key = [&](IndexType row) {
+        return key_type{t_row_ptrs[row + 1] - t_row_ptrs[row],
+                        static_cast<uint32>(row) * 2654435761u, row};
+    };
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        state[row] = t_row_ptrs[row + 1] > t_row_ptrs[row] ? undecided : fine;
+    }
+    // PMIS: In each round, every undecided row whose key is larger than
+    // those of all undecided strongly connected rows becomes a coarse point,
+    // then every undecided row strongly depending on a coarse point becomes
+    // a fine point.
+    bool done = false;
+    while (!done) {
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto is_max = state[row] == undecided;
+            const auto key = get_key(row);
+            for (auto nz = row_ptrs[row]; is_max && nz < row_ptrs[row + 1];
+                 nz++) {
+                const auto col = col_idxs[nz];
+                is_max = state[col] != undecided || get_key(col) < key;
+            }
+            for (auto nz = t_row_ptrs[row];
+                 is_max && nz < t_row_ptrs[row + 1]; nz++) {
+                const auto col = t_col_idxs[nz];
+                is_max = state[col] != undecided || get_key(col) < key;
+            }
+            changed[row] = is_max;
+        }
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (changed[row]) {
+                state[row] = coarse;
+            }
+        }
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto has_coarse = false;
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                has_coarse = has_coarse || state[col_idxs[nz]] == coarse;
+            }
+            changed[row] = state[row] == undecided && has_coarse;
+        }
+        done = true;
+#pragma omp parallel for reduction(&& : done)
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (changed[row]) {
+                state[row] = fine;
+            }
+            done = done && state[row] != undecided;
+        }
+    }
+    vector<IndexType> coarse_ids(num_rows + 1, {exec});
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        coarse_ids[row] = state[row] == coarse;
+    }
+    components::prefix_sum_nonnegative(exec, coarse_ids.data(), num_rows + 1);
+    auto coarse_map_vals = coarse_map.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        coarse_map_vals[row] = state[row] == coarse ? coarse_ids[row] : -1;
+    }
+    *num_coarse = coarse_ids[num_rows];
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_SELECT_COARSE_POINTS);
+
+
+template <typename ValueType, typename IndexType>
+void compute_interpolation(std::shared_ptr<const DefaultExecutor> exec,
+                           const matrix::Csr<ValueType, IndexType>* mtx,
+                           const matrix::Csr<ValueType, IndexType>* strength,
+                           const array<IndexType>& coarse_map,
+                           matrix::Csr<ValueType, IndexType>* prolongator)
+{
+    const auto num_rows = static_cast<IndexType>(mtx->get_size()[0]);
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    const auto s_row_ptrs = strength->get_const_row_ptrs();
+    const auto s_col_idxs = strength->get_const_col_idxs();
+    const auto s_vals = strength->get_const_values();
+    const auto coarse_map_vals = coarse_map.get_const_data();
+    // the row scaling -sum_j a_ij / (a_ii sum_{j in C_i} a_ij) of the direct
+    // interpolation, zero if the row cannot be interpolated
+    vector<ValueType> scale(num_rows, zero<ValueType>(), {exec});
+    auto out_row_ptrs = prolongator->get_row_ptrs();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (coarse_map_vals[row] >= 0) {
+            out_row_ptrs[row] = 1;
+            continue;
+        }
+        auto diag = zero<ValueType>();
+        auto sum_all = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag += vals[nz];
+            } else {
+                sum_all += vals[nz];
+            }
+        }
+        auto sum_coarse = zero<ValueType>();
+        IndexType count{};
+        for (auto nz = s_row_ptrs[row]; nz < s_row_ptrs[row + 1]; nz++) {
+            if (coarse_map_vals[s_col_idxs[nz]] >= 0) {
+                sum_coarse += s_vals[nz];
+                count++;
+            }
+        }
+        const auto valid =
+            diag != zero<ValueType>() && sum_coarse != zero<ValueType>();
+        scale[row] = valid ? -sum_all / (sum_coarse * diag) : zero<ValueType>();
+        out_row_ptrs[row] = valid ? count : 0;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_nnz = static_cast<size_type>(out_row_ptrs[num_rows]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{prolongator};
+    auto& out_col_idxs_array = builder.get_col_idx_array();
+    auto& out_vals_array = builder.get_value_array();
+    out_col_idxs_array.resize_and_reset(out_nnz);
+    out_vals_array.resize_and_reset(out_nnz);
+    auto out_col_idxs = out_col_idxs_array.get_data();
+    auto out_vals = out_vals_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out_nz = out_row_ptrs[row];
+        if (coarse_map_vals[row] >= 0) {
+            out_col_idxs[out_nz] = coarse_map_vals[row];
+            out_vals[out_nz] = one<ValueType>();
+            continue;
+        }
+        if (out_row_ptrs[row + 1] == out_nz) {
+            continue;
+        }
+        for (auto nz = s_row_ptrs[row]; nz < s_row_ptrs[row + 1]; nz++) {
+            const auto coarse_col = coarse_map_vals[s_col_idxs[nz]];
+            if (coarse_col >= 0) {
+                out_col_idxs[out_nz] = coarse_col;
+                out_vals[out_nz] = scale[row] * s_vals[nz];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CLASSICAL_COARSENING_COMPUTE_INTERPOLATION);
+
+
+}  // namespace classical_coarsening
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -46,6 +46,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/base/iterator_factory.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
 
 
 namespace gko {
@@ -57,14 +59,100 @@ namespace omp {
  * @ingroup pgm
  */
 namespace pgm {
+namespace {
+
+
+/**
+ * Stably sorts [it, it + size) in parallel: Each thread sorts a contiguous
+ * chunk, then the sorted chunks are merged pairwise, alternating between the
+ * input and the temporary storage tmp_it of the same size.
+ */
+template <typename Iterator, typename Comparator>
+void parallel_stable_sort(Iterator it, Iterator tmp_it, size_type size,
+                          Comparator comp)
+{
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    // below this size, the parallelization overhead dominates
+    constexpr size_type min_chunk_size = 1024;
+    if (num_chunks <= 1 || size < num_chunks * min_chunk_size) {
+        std::stable_sort(it, it + size, comp);
+        return;
+    }
+    const auto chunk_size = ceildiv(size, num_chunks);
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+        const auto begin = std::min(chunk * chunk_size, size);
+        const auto end = std::min(begin + chunk_size, size);
+        std::stable_sort(it + begin, it + end, comp);
+    }
+    auto in = it;
+    auto out = tmp_it;
+    for (auto width = chunk_size; width < size; width *= 2) {
+#pragma omp parallel for
+        for (size_type begin = 0; begin < size; begin += 2 * width) {
+            const auto mid = std::min(begin + width, size);
+            const auto end = std::min(begin + 2 * width, size);
+            std::merge(in + begin, in + mid, in + mid, in + end, out + begin,
+                       comp);
+        }
+        std::swap(in, out);
+    }
+    if (in != it) {
+#pragma omp parallel for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto begin = std::min(chunk * chunk_size, size);
+            const auto end = std::min(begin + chunk_size, size);
+            std::copy(in + begin, in + end, it + begin);
+        }
+    }
+}
+
+
+/**
+ * Stably sorts the key-value pairs in [begin, end) by their keys. Short
+ * ranges use insertion sort to avoid the allocation inside std::stable_sort.
+ */
+template <typename KeyType, typename ValueType>
+void stable_sort_by_key(KeyType* keys, ValueType* values, size_type begin,
+                        size_type end)
+{
+    constexpr size_type max_insertion_sort_size = 32;
+    if (end - begin > max_insertion_sort_size) {
+        auto it = detail::make_zip_iterator(keys, values);
+        std::stable_sort(it + begin, it + end, [](auto a, auto b) {
+            return std::get<0>(a) < std::get<0>(b);
+        });
+        return;
+    }
+    for (auto i = begin + 1; i < end; i++) {
+        const auto key = keys[i];
+        const auto value = values[i];
+        auto j = i;
+        for (; j > begin && key < keys[j - 1]; j--) {
+            keys[j] = keys[j - 1];
+            values[j] = values[j - 1];
+        }
+        keys[j] = key;
+        values[j] = value;
+    }
+}
+
+
+}  // namespace
 
 
 template <typename IndexType>
 void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
               IndexType* row_idxs, IndexType* col_idxs)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs);
-    std::sort(it, it + num);
+    array<IndexType> tmp_row_idxs{exec, static_cast<size_type>(num)};
+    array<IndexType> tmp_col_idxs{exec, static_cast<size_type>(num)};
+    parallel_stable_sort(
+        detail::make_zip_iterator(row_idxs, col_idxs),
+        detail::make_zip_iterator(tmp_row_idxs.get_data(),
+                                  tmp_col_idxs.get_data()),
+        static_cast<size_type>(num),
+        [](auto a, auto b) { return a < b; });
 }
 
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
@@ -74,11 +162,17 @@ template <typename ValueType, typename IndexType>
 void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
                     IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs, vals);
-    std::stable_sort(it, it + nnz, [](auto a, auto b) {
-        return std::tie(std::get<0>(a), std::get<1>(a)) <
-               std::tie(std::get<0>(b), std::get<1>(b));
-    });
+    array<IndexType> tmp_row_idxs{exec, nnz};
+    array<IndexType> tmp_col_idxs{exec, nnz};
+    array<ValueType> tmp_vals{exec, nnz};
+    parallel_stable_sort(
+        detail::make_zip_iterator(row_idxs, col_idxs, vals),
+        detail::make_zip_iterator(tmp_row_idxs.get_data(),
+                                  tmp_col_idxs.get_data(), tmp_vals.get_data()),
+        nnz, [](auto a, auto b) {
+            return std::tie(std::get<0>(a), std::get<1>(a)) <
+                   std::tie(std::get<0>(b), std::get<1>(b));
+        });
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
@@ -121,6 +215,91 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine_csr,
+                        const IndexType* agg, const IndexType* agg_ptrs,
+                        const IndexType* agg_rows,
+                        matrix::Csr<ValueType, IndexType>* coarse_csr)
+{
+    const auto num_agg = coarse_csr->get_size()[0];
+    const auto fine_row_ptrs = fine_csr->get_const_row_ptrs();
+    const auto fine_col_idxs = fine_csr->get_const_col_idxs();
+    const auto fine_vals = fine_csr->get_const_values();
+    auto coarse_row_ptrs = coarse_csr->get_row_ptrs();
+    // every aggregate gets a scratch range for all fine entries of its rows
+    array<IndexType> scratch_ptrs_array{exec, num_agg + 1};
+    auto scratch_ptrs = scratch_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type coarse_row = 0; coarse_row < num_agg; coarse_row++) {
+        IndexType fine_nnz{};
+        for (auto i = agg_ptrs[coarse_row]; i < agg_ptrs[coarse_row + 1];
+             i++) {
+            const auto fine_row = agg_rows[i];
+            fine_nnz += fine_row_ptrs[fine_row + 1] - fine_row_ptrs[fine_row];
+        }
+        scratch_ptrs[coarse_row] = fine_nnz;
+    }
+    components::prefix_sum_nonnegative(exec, scratch_ptrs, num_agg + 1);
+    const auto scratch_size = static_cast<size_type>(scratch_ptrs[num_agg]);
+    array<IndexType> scratch_col_idxs_array{exec, scratch_size};
+    array<ValueType> scratch_vals_array{exec, scratch_size};
+    auto scratch_col_idxs = scratch_col_idxs_array.get_data();
+    auto scratch_vals = scratch_vals_array.get_data();
+    // gather the entries of each coarse row, sort them by coarse column and
+    // sum up duplicates in-place
+#pragma omp parallel for schedule(dynamic, 256)
+    for (size_type coarse_row = 0; coarse_row < num_agg; coarse_row++) {
+        const auto begin = scratch_ptrs[coarse_row];
+        auto out = begin;
+        for (auto i = agg_ptrs[coarse_row]; i < agg_ptrs[coarse_row + 1];
+             i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = fine_row_ptrs[fine_row];
+                 nz < fine_row_ptrs[fine_row + 1]; nz++) {
+                scratch_col_idxs[out] = agg[fine_col_idxs[nz]];
+                scratch_vals[out] = fine_vals[nz];
+                out++;
+            }
+        }
+        stable_sort_by_key(scratch_col_idxs, scratch_vals, begin, out);
+        auto unique = begin;
+        for (auto nz = begin; nz < out; nz++) {
+            if (nz > begin &&
+                scratch_col_idxs[nz] == scratch_col_idxs[unique - 1]) {
+                scratch_vals[unique - 1] += scratch_vals[nz];
+            } else {
+                scratch_col_idxs[unique] = scratch_col_idxs[nz];
+                scratch_vals[unique] = scratch_vals[nz];
+                unique++;
+            }
+        }
+        coarse_row_ptrs[coarse_row] = unique - begin;
+    }
+    components::prefix_sum_nonnegative(exec, coarse_row_ptrs, num_agg + 1);
+    const auto coarse_nnz = static_cast<size_type>(coarse_row_ptrs[num_agg]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse_csr};
+    auto& coarse_col_idxs_array = builder.get_col_idx_array();
+    auto& coarse_vals_array = builder.get_value_array();
+    coarse_col_idxs_array.resize_and_reset(coarse_nnz);
+    coarse_vals_array.resize_and_reset(coarse_nnz);
+    auto coarse_col_idxs = coarse_col_idxs_array.get_data();
+    auto coarse_vals = coarse_vals_array.get_data();
+#pragma omp parallel for
+    for (size_type coarse_row = 0; coarse_row < num_agg; coarse_row++) {
+        const auto row_nnz =
+            coarse_row_ptrs[coarse_row + 1] - coarse_row_ptrs[coarse_row];
+        std::copy_n(scratch_col_idxs + scratch_ptrs[coarse_row], row_nnz,
+                    coarse_col_idxs + coarse_row_ptrs[coarse_row]);
+        std::copy_n(scratch_vals + scratch_ptrs[coarse_row], row_nnz,
+                    coarse_vals + coarse_row_ptrs[coarse_row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace omp
 }  // namespace kernels
@@ -0,0 +1,320 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/smoothed_aggregation_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The smoothed aggregation namespace.
+ *
+ * @ingroup smoothed_aggregation
+ */
+namespace smoothed_aggregation {
+
+
+template <typename ValueType, typename IndexType>
+void filter_matrix(std::shared_ptr<const DefaultExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* mtx,
+                   remove_complex<ValueType> threshold,
+                   matrix::Csr<ValueType, IndexType>* filtered)
+{
+    const auto num_rows = static_cast<IndexType>(mtx->get_size()[0]);
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    vector<remove_complex<ValueType>> diag(num_rows, {exec});
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag[row] = abs(vals[nz]);
+            }
+        }
+    }
+    const auto is_strong = [&](IndexType row, IndexType nz) {
+        const auto col = col_idxs[nz];
+        return col != row &&
+               abs(vals[nz]) >= threshold * sqrt(diag[row] * diag[col]);
+    };
+    auto out_row_ptrs = filtered->get_row_ptrs();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        IndexType count{1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            count += is_strong(row, nz);
+        }
+        out_row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_nnz = static_cast<size_type>(out_row_ptrs[num_rows]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{filtered};
+    auto& out_col_idxs_array = builder.get_col_idx_array();
+    auto& out_vals_array = builder.get_value_array();
+    out_col_idxs_array.resize_and_reset(out_nnz);
+    out_vals_array.resize_and_reset(out_nnz);
+    auto out_col_idxs = out_col_idxs_array.get_data();
+    auto out_vals = out_vals_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out_nz = out_row_ptrs[row];
+        IndexType diag_nz{-1};
+        auto diag_val = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (diag_nz < 0 && col >= row) {
+                diag_nz = out_nz;
+                out_col_idxs[out_nz] = row;
+                out_nz++;
+            }
+            if (is_strong(row, nz)) {
+                out_col_idxs[out_nz] = col;
+                out_vals[out_nz] = vals[nz];
+                out_nz++;
+            } else {
+                diag_val += vals[nz];
+            }
+        }
+        if (diag_nz < 0) {
+            diag_nz = out_nz;
+            out_col_idxs[out_nz] = row;
+        }
+        out_vals[diag_nz] = diag_val;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_FILTER_MATRIX);
+
+
+template <typename ValueType, typename IndexType>
+void aggregate(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Csr<ValueType, IndexType>* filtered,
+               array<IndexType>& agg, IndexType* num_agg)
+{
+    constexpr int8 nonroot = 0;
+    constexpr int8 undecided = 1;
+    constexpr int8 root = 2;
+    using key_type = std::tuple<int8, uint32, IndexType>;
+    const auto num_rows = static_cast<IndexType>(filtered->get_size()[0]);
+    const auto row_ptrs = filtered->get_const_row_ptrs();
+    const auto col_idxs = filtered->get_const_col_idxs();
+    const auto vals = filtered->get_const_values();
+    vector<int8> state(num_rows, undecided, {exec});
+    vector<key_type> max_dist1(num_rows, {exec});
+    vector<key_type> max_dist2(num_rows, {exec});
+    const auto get_key = [&](IndexType row) {
+        return key_type{state[row], static_cast<uint32>(row) * 2654435761u,
+                        row};
+    };
+    // the rounds are synchronous, so the result matches the sequential
+    // implementation independent of the number of threads
+    bool done = false;
+    while (!done) {
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto max_key = get_key(row);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_key = std::max(max_key, get_key(col_idxs[nz]));
+            }
+            max_dist1[row] = max_key;
+        }
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto max_key = max_dist1[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_key = std::max(max_key, max_dist1[col_idxs[nz]]);
+            }
+            max_dist2[row] = max_key;
+        }
+        done = true;
+#pragma omp parallel for reduction(&& : done)
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (state[row] == undecided) {
+                if (std::get<2>(max_dist2[row]) == row) {
+                    state[row] = root;
+                } else if (std::get<0>(max_dist2[row]) == root) {
+                    state[row] = nonroot;
+                } else {
+                    done = false;
+                }
+            }
+        }
+    }
+    vector<IndexType> root_ids(num_rows + 1, {exec});
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        root_ids[row] = state[row] == root;
+    }
+    components::prefix_sum_nonnegative(exec, root_ids.data(), num_rows + 1);
+    auto agg_vals = agg.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        agg_vals[row] = state[row] == root ? root_ids[row] : -1;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (state[row] != root && state[col] == root) {
+                agg_vals[row] = root_ids[col];
+            }
+        }
+    }
+    vector<IndexType> first_agg(agg_vals, agg_vals + num_rows, {exec});
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (first_agg[row] >= 0) {
+            continue;
+        }
+        remove_complex<ValueType> max_weight{-1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (first_agg[col] >= 0 && abs(vals[nz]) > max_weight) {
+                max_weight = abs(vals[nz]);
+                agg_vals[row] = first_agg[col];
+            }
+        }
+    }
+    *num_agg = root_ids[num_rows];
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_AGGREGATE);
+
+
+template <typename ValueType, typename IndexType>
+void compute_prolongator(std::shared_ptr<const DefaultExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType>* filtered,
+                         const array<IndexType>& agg,
+                         remove_complex<ValueType> damping,
+                         matrix::Csr<ValueType, IndexType>* prolongator)
+{
+    const auto num_rows = static_cast<IndexType>(filtered->get_size()[0]);
+    const auto row_ptrs = filtered->get_const_row_ptrs();
+    const auto col_idxs = filtered->get_const_col_idxs();
+    const auto vals = filtered->get_const_values();
+    const auto agg_vals = agg.get_const_data();
+    vector<ValueType> diag(num_rows, zero<ValueType>(), {exec});
+    remove_complex<ValueType> spectral_bound{};
+#pragma omp parallel for reduction(max : spectral_bound)
+    for (IndexType row = 0; row < num_rows; row++) {
+        remove_complex<ValueType> row_sum{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag[row] = vals[nz];
+            }
+            row_sum += abs(vals[nz]);
+        }
+        if (diag[row] != zero<ValueType>()) {
+            spectral_bound = std::max(spectral_bound, row_sum / abs(diag[row]));
+        }
+    }
+    const auto omega = spectral_bound > 0 ? damping / spectral_bound
+                                          : remove_complex<ValueType>{};
+    // row i of P has at most nnz(row i of A_F) + 1 entries, so we assemble
+    // every row in a scratch range of that size before compressing them
+    const auto scratch_size =
+        static_cast<size_type>(row_ptrs[num_rows]) + num_rows;
+    vector<std::pair<IndexType, ValueType>> scratch(scratch_size, {exec});
+    auto out_row_ptrs = prolongator->get_row_ptrs();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto begin = scratch.begin() + row_ptrs[row] + row;
+        auto end = begin;
+        *end++ = std::make_pair(agg_vals[row], one<ValueType>());
+        if (diag[row] != zero<ValueType>()) {
+            const auto scale = -omega / diag[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                *end++ = std::make_pair(agg_vals[col_idxs[nz]],
+                                        scale * vals[nz]);
+            }
+        }
+        std::stable_sort(begin, end,
+                         [](auto a, auto b) { return a.first < b.first; });
+        auto out = begin;
+        for (auto it = begin + 1; it != end; ++it) {
+            if (it->first == out->first) {
+                out->second += it->second;
+            } else {
+                *++out = *it;
+            }
+        }
+        out_row_ptrs[row] = static_cast<IndexType>(out + 1 - begin);
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_nnz = static_cast<size_type>(out_row_ptrs[num_rows]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{prolongator};
+    auto& col_idxs_array = builder.get_col_idx_array();
+    auto& vals_array = builder.get_value_array();
+    col_idxs_array.resize_and_reset(out_nnz);
+    vals_array.resize_and_reset(out_nnz);
+    auto out_col_idxs = col_idxs_array.get_data();
+    auto out_vals = vals_array.get_data();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto in = scratch.begin() + row_ptrs[row] + row;
+        for (auto nz = out_row_ptrs[row]; nz < out_row_ptrs[row + 1]; nz++) {
+            out_col_idxs[nz] = in->first;
+            out_vals[nz] = in->second;
+            ++in;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_COMPUTE_PROLONGATOR);
+
+
+}  // namespace smoothed_aggregation
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,201 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/reorder/coloring_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The graph coloring namespace.
+ *
+ * @ingroup reorder
+ */
+namespace coloring {
+
+
+/**
+ * Speculative parallel greedy coloring (Gebremedhin-Manne):
+ * All uncolored vertices are tentatively colored in parallel based on the
+ * (potentially outdated) colors of their neighbors. Afterwards, every vertex
+ * that got the same color as a neighbor with a smaller index is put back into
+ * the worklist, until no conflicts remain. Each round finalizes at least the
+ * smallest vertex in the worklist, and usually very few conflicts occur.
+ */
+template <typename IndexType>
+void color_graph(std::shared_ptr<const OmpExecutor> exec,
+                 IndexType num_vertices, const IndexType* row_ptrs,
+                 const IndexType* col_idxs,
+                 gko::experimental::reorder::coloring_distance distance,
+                 IndexType* colors, IndexType& num_colors)
+{
+    const bool distance_two =
+        distance == gko::experimental::reorder::coloring_distance::two;
+    // calls op for all vertices that need a different color than vertex
+    const auto for_each_neighbor = [&](IndexType vertex, auto op) {
+        for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; ++nz) {
+            const auto neighbor = col_idxs[nz];
+            op(neighbor);
+            if (distance_two) {
+                for (auto nz2 = row_ptrs[neighbor];
+                     nz2 < row_ptrs[neighbor + 1]; ++nz2) {
+                    if (col_idxs[nz2] != vertex) {
+                        op(col_idxs[nz2]);
+                    }
+                }
+            }
+        }
+    };
+    std::fill_n(colors, num_vertices, -1);
+    vector<IndexType> worklist(num_vertices, {exec});
+    std::iota(worklist.begin(), worklist.end(), IndexType{});
+    vector<uint8> conflicts(num_vertices, {exec});
+    while (!worklist.empty()) {
+        const auto num_work = static_cast<IndexType>(worklist.size());
+#pragma omp parallel
+        {
+            // forbidden[c] == v marks color c as used by a neighbor of v
+            vector<IndexType> forbidden{{exec}};
+#pragma omp for
+            for (IndexType i = 0; i < num_work; ++i) {
+                const auto vertex = worklist[i];
+                for_each_neighbor(vertex, [&](IndexType neighbor) {
+                    IndexType color;
+#pragma omp atomic read
+                    color = colors[neighbor];
+                    if (color >= 0) {
+                        if (color >= static_cast<IndexType>(forbidden.size())) {
+                            forbidden.resize(color + 1, -1);
+                        }
+                        forbidden[color] = vertex;
+                    }
+                });
+                IndexType color{};
+                while (color < static_cast<IndexType>(forbidden.size()) &&
+                       forbidden[color] == vertex) {
+                    ++color;
+                }
+#pragma omp atomic write
+                colors[vertex] = color;
+            }
+        }
+        // only vertices colored in the same round can conflict, since all
+        // other neighbors' colors were final when they were read
+#pragma omp parallel for
+        for (IndexType i = 0; i < num_work; ++i) {
+            const auto vertex = worklist[i];
+            bool conflict = false;
+            for_each_neighbor(vertex, [&](IndexType neighbor) {
+                conflict = conflict || (neighbor < vertex &&
+                                        colors[neighbor] == colors[vertex]);
+            });
+            conflicts[i] = conflict;
+        }
+        IndexType num_conflicts{};
+        for (IndexType i = 0; i < num_work; ++i) {
+            if (conflicts[i]) {
+                worklist[num_conflicts++] = worklist[i];
+            }
+        }
+        worklist.resize(num_conflicts);
+    }
+    num_colors = 0;
+#pragma omp parallel for reduction(max : num_colors)
+    for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+        num_colors = std::max(num_colors, colors[vertex] + 1);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_COLORING_COLOR_GRAPH_KERNEL);
+
+
+template <typename IndexType>
+void get_permutation(std::shared_ptr<const OmpExecutor> exec,
+                     IndexType num_vertices, const IndexType* colors,
+                     IndexType num_colors, IndexType* color_ptrs,
+                     IndexType* permutation)
+{
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    // counts[c * num_threads + t] is the number of vertices of color c in
+    // the chunk of thread t
+    vector<IndexType> counts(num_colors * num_threads, 0, {exec});
+#pragma omp parallel num_threads(num_threads)
+    {
+        const auto tid = static_cast<size_type>(omp_get_thread_num());
+        // the static schedule assigns the same chunks in both loops, and the
+        // chunks are ordered by thread id, so the sort is stable
+#pragma omp for schedule(static)
+        for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+            counts[colors[vertex] * num_threads + tid]++;
+        }
+#pragma omp single
+        {
+            IndexType sum{};
+            for (IndexType color = 0; color < num_colors; ++color) {
+                color_ptrs[color] = sum;
+                for (size_type t = 0; t < num_threads; ++t) {
+                    const auto count = counts[color * num_threads + t];
+                    counts[color * num_threads + t] = sum;
+                    sum += count;
+                }
+            }
+            color_ptrs[num_colors] = sum;
+        }
+#pragma omp for schedule(static)
+        for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+            permutation[counts[colors[vertex] * num_threads + tid]++] = vertex;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_COLORING_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace coloring
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
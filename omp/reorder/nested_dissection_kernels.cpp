@@ -0,0 +1,100 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/reorder/graph_bisection.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The nested dissection namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+// subproblems smaller than this are not worth spawning a task for
+constexpr int min_task_size = 1024;
+
+
+template <typename IndexType>
+void order_subproblem(
+    std::shared_ptr<const OmpExecutor> exec,
+    experimental::reorder::detail::nd_subproblem<IndexType>& problem,
+    IndexType max_leaf_size)
+{
+    auto children = experimental::reorder::detail::nested_dissection_step(
+        exec, problem, max_leaf_size);
+    for (auto& child : children) {
+        auto child_ptr = &child;
+#pragma omp task firstprivate(child_ptr) \
+    if (child.graph.get_num_vertices() >= min_task_size)
+        order_subproblem(exec, *child_ptr, max_leaf_size);
+    }
+#pragma omp taskwait
+}
+
+
+template <typename IndexType>
+void compute_ordering(std::shared_ptr<const OmpExecutor> exec,
+                      IndexType num_vertices, const IndexType* row_ptrs,
+                      const IndexType* col_idxs, IndexType max_leaf_size,
+                      IndexType* permutation)
+{
+    auto problem = experimental::reorder::detail::create_nd_problem(
+        exec, num_vertices, row_ptrs, col_idxs, permutation);
+    // the two parts of each dissection are independent, so they can be
+    // ordered in separate tasks
+#pragma omp parallel
+#pragma omp single
+    order_subproblem(exec, problem, max_leaf_size);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_NESTED_DISSECTION_COMPUTE_ORDERING_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
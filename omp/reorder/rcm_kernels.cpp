@@ -56,6 +56,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core/base/allocator.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "omp/components/atomic.hpp"
 #include "omp/components/omp_mutex.hpp"
 #include "omp/components/sort_small.hpp"
 
@@ -209,50 +210,6 @@ struct UbfsLinearQueue {
 };
 
 
-#ifdef _MSC_VER
-#define GKO_CMPXCHG_IMPL(ptr, ptr_expected, replace_with)                     \
-    if (sizeof replace_with == 8) {                                           \
-        return _InterlockedCompareExchange64(reinterpret_cast<int64_t*>(ptr), \
-                                             replace_with,                    \
-                                             *ptr_expected) == *ptr_expected; \
-    }                                                                         \
-    if (sizeof replace_with == 4) {                                           \
-        return _InterlockedCompareExchange(reinterpret_cast<long*>(ptr),      \
-                                           replace_with,                      \
-                                           *ptr_expected) == *ptr_expected;   \
-    }                                                                         \
-    if (sizeof replace_with == 2) {                                           \
-        return _InterlockedCompareExchange16(reinterpret_cast<short*>(ptr),   \
-                                             replace_with,                    \
-                                             *ptr_expected) == *ptr_expected; \
-    }                                                                         \
-    if (sizeof replace_with == 1) {                                           \
-        return _InterlockedCompareExchange8(reinterpret_cast<char*>(ptr),     \
-                                            replace_with,                     \
-                                            *ptr_expected) == *ptr_expected;  \
-    }
-#else
-#define GKO_CMPXCHG_IMPL(ptr, ptr_expected, replace_with) \
-    return __atomic_compare_exchange_n(                   \
-        ptr, ptr_expected, replace_with, true,            \
-        std::memory_order::memory_order_acq_rel,          \
-        std::memory_order::memory_order_acquire);
-#endif
-
-/**
- * Basic building block for CAS loops.
- * Note that "weak" and "acqrel" are only the minimum guarantees made.
- * Usage with types of size > 8 bytes is undefined behaviour.
- * Usage with non-primitive types is explicitly discouraged.
- */
-template <typename TargetType>
-inline bool compare_exchange_weak_acqrel(TargetType* value, TargetType old,
-                                         TargetType newer)
-{
-    GKO_CMPXCHG_IMPL(value, &old, newer)
-}
-
-
 template <typename IndexType>
 inline void reduce_neighbours_levels(const IndexType num_vertices,
                                      const IndexType* const row_ptrs,
@@ -0,0 +1,198 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+#define GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace solver {
+
+
+struct SolveStruct {
+    virtual ~SolveStruct() = default;
+};
+
+
+}  // namespace solver
+
+
+namespace kernels {
+namespace omp {
+namespace trs {
+
+
+/**
+ * The minimum average number of rows per level for which the triangular solve
+ * uses the level schedule. For fewer rows, the synchronization after each
+ * level outweighs the parallelism within the levels.
+ */
+constexpr size_type min_rows_per_level = 64;
+
+
+/**
+ * Level schedule of a sparse triangular matrix: the rows are grouped into
+ * levels such that every row only depends on rows from previous levels.
+ * All rows within a level can thus be solved in parallel.
+ */
+template <typename IndexType>
+struct LevelSolveStruct : gko::solver::SolveStruct {
+    LevelSolveStruct(std::shared_ptr<const OmpExecutor> exec,
+                     size_type num_levels, size_type num_rows)
+        : level_ptrs{exec, num_levels + 1}, level_rows{exec, num_rows}
+    {}
+
+    /** Offsets of the levels in level_rows. */
+    array<IndexType> level_ptrs;
+    /** The rows of the matrix, grouped by their level. */
+    array<IndexType> level_rows;
+};
+
+
+/**
+ * Computes the level schedule of a lower or upper triangular matrix.
+ * If the levels are too small to benefit from parallelization, solve_struct
+ * is reset to nullptr, and the sequential algorithm should be used.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void generate_level_schedule(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* matrix,
+    std::shared_ptr<gko::solver::SolveStruct>& solve_struct)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    vector<IndexType> levels(num_rows, 0, {exec});
+    IndexType num_levels{};
+    for (IndexType i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        IndexType level{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            const auto col = col_idxs[nz];
+            if (is_upper ? col > row : col < row) {
+                level = std::max(level, levels[col] + 1);
+            }
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    if (num_levels == 0 || static_cast<size_type>(num_rows) <
+                               num_levels * min_rows_per_level) {
+        solve_struct = nullptr;
+        return;
+    }
+    auto level_struct = std::make_shared<LevelSolveStruct<IndexType>>(
+        exec, num_levels, num_rows);
+    const auto level_ptrs = level_struct->level_ptrs.get_data();
+    const auto level_rows = level_struct->level_rows.get_data();
+    std::fill_n(level_ptrs, num_levels + 1, IndexType{});
+    for (IndexType row = 0; row < num_rows; ++row) {
+        level_ptrs[levels[row] + 1]++;
+    }
+    std::partial_sum(level_ptrs, level_ptrs + num_levels + 1, level_ptrs);
+    vector<IndexType> level_fill(level_ptrs, level_ptrs + num_levels, {exec});
+    for (IndexType row = 0; row < num_rows; ++row) {
+        level_rows[level_fill[levels[row]]++] = row;
+    }
+    solve_struct = std::move(level_struct);
+}
+
+
+/**
+ * Solves a triangular system using its level schedule, processing all rows
+ * within a level in parallel.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_level_scheduled(const LevelSolveStruct<IndexType>* level_struct,
+                           const matrix::Csr<ValueType, IndexType>* matrix,
+                           bool unit_diag, const matrix::Dense<ValueType>* b,
+                           matrix::Dense<ValueType>* x)
+{
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    const auto level_ptrs = level_struct->level_ptrs.get_const_data();
+    const auto level_rows = level_struct->level_rows.get_const_data();
+    const auto num_levels = level_struct->level_ptrs.get_num_elems() - 1;
+    const auto num_rhs = b->get_size()[1];
+
+#pragma omp parallel
+    for (size_type level = 0; level < num_levels; ++level) {
+        // the implicit barrier at the end of the loop separates the levels
+#pragma omp for
+        for (auto i = level_ptrs[level]; i < level_ptrs[level + 1]; ++i) {
+            const auto row = level_rows[i];
+            for (size_type j = 0; j < num_rhs; ++j) {
+                auto diag = one<ValueType>();
+                auto sum = b->at(row, j);
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+                    const auto col = col_idxs[nz];
+                    if (is_upper ? col > row : col < row) {
+                        sum -= vals[nz] * x->at(col, j);
+                    }
+                    if (col == row) {
+                        diag = vals[nz];
+                    }
+                }
+                x->at(row, j) = unit_diag ? sum : sum / diag;
+            }
+        }
+    }
+}
+
+
+}  // namespace trs
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
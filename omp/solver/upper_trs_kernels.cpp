@@ -48,6 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/triangular.hpp>
 
 
+#include "omp/solver/common_trs_kernels.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -73,9 +76,7 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
               bool unit_diag, const solver::trisolve_algorithm algorithm,
               const size_type num_rhs)
 {
-    // This generate kernel is here to allow for a more sophisticated
-    // implementation as for other executors. This kernel would perform the
-    // "analysis" phase for the triangular matrix.
+    trs::generate_level_schedule<true>(exec, matrix, solve_struct);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -94,6 +95,19 @@ void solve(std::shared_ptr<const OmpExecutor> exec,
            matrix::Dense<ValueType>* trans_b, matrix::Dense<ValueType>* trans_x,
            const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
 {
+    using level_struct_type = trs::LevelSolveStruct<IndexType>;
+    const auto level_struct =
+        dynamic_cast<const level_struct_type*>(solve_struct);
+    const auto num_rhs = b->get_size()[1];
+    // parallelizing over the right-hand sides is cheaper, but only if there
+    // are enough of them to occupy all threads
+    if (level_struct &&
+        (num_rhs == 1 ||
+         num_rhs < static_cast<size_type>(omp_get_max_threads()))) {
+        trs::solve_level_scheduled<true>(level_struct, matrix, unit_diag, b, x);
+        return;
+    }
+
     auto row_ptrs = matrix->get_const_row_ptrs();
     auto col_idxs = matrix->get_const_col_idxs();
     auto vals = matrix->get_const_values();
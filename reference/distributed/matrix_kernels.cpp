@@ -188,6 +188,26 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_LOCAL_GLOBAL_INDEX_TYPE(
     GKO_DECLARE_BUILD_LOCAL_NONLOCAL);
 
 
+template <typename ValueType, typename IndexType>
+void add_scaled_rows(std::shared_ptr<const DefaultExecutor> exec,
+                     const matrix::Dense<ValueType>* alpha,
+                     const matrix::Dense<ValueType>* rows,
+                     const array<IndexType>& row_idxs,
+                     matrix::Dense<ValueType>* x)
+{
+    const auto scale = alpha->at(0, 0);
+    for (size_type row = 0; row < rows->get_size()[0]; ++row) {
+        const auto out_row = row_idxs.get_const_data()[row];
+        for (size_type col = 0; col < rows->get_size()[1]; ++col) {
+            x->at(out_row, col) += scale * rows->at(row, col);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DISTRIBUTED_MATRIX_ADD_SCALED_ROWS);
+
+
 }  // namespace distributed_matrix
 }  // namespace reference
 }  // namespace kernels
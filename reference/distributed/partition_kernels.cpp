@@ -33,6 +33,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/distributed/partition_kernels.hpp"
 
 
+#include <vector>
+
+
+#include "core/reorder/graph_bisection.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace reference {
@@ -114,6 +120,35 @@ void build_ranges_from_global_size(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_PARTITION_BUILD_FROM_GLOBAL_SIZE);
 
 
+template <typename IndexType>
+void compute_graph_mapping(std::shared_ptr<const DefaultExecutor> exec,
+                           IndexType num_vertices, const IndexType* row_ptrs,
+                           const IndexType* col_idxs, comm_index_type num_parts,
+                           double imbalance, comm_index_type* mapping)
+{
+    using experimental::reorder::detail::kway_subproblem;
+    const auto bisection_imbalance =
+        experimental::reorder::detail::get_bisection_imbalance(imbalance,
+                                                               num_parts);
+    std::vector<kway_subproblem<IndexType>> stack;
+    stack.push_back(experimental::reorder::detail::create_kway_problem(
+        exec, num_vertices, row_ptrs, col_idxs, num_parts));
+    while (!stack.empty()) {
+        auto problem = std::move(stack.back());
+        stack.pop_back();
+        auto children = experimental::reorder::detail::kway_partition_step(
+            exec, problem, bisection_imbalance, mapping);
+        for (auto& child : children) {
+            stack.push_back(std::move(child));
+        }
+    }
+    experimental::reorder::detail::refine_kway(
+        exec, num_vertices, row_ptrs, col_idxs, num_parts, imbalance, mapping);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_PARTITION_COMPUTE_GRAPH_MAPPING);
+
+
 template <typename LocalIndexType, typename GlobalIndexType>
 void build_starting_indices(std::shared_ptr<const DefaultExecutor> exec,
                             const GlobalIndexType* range_offsets,
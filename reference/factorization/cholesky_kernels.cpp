@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core/base/allocator.hpp"
 #include "core/base/iterator_factory.hpp"
+#include "core/components/disjoint_sets.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
@@ -62,6 +63,37 @@ namespace reference {
 namespace cholesky {
 
 
+template <typename IndexType>
+void compute_skeleton_tree(std::shared_ptr<const DefaultExecutor> exec,
+                           const IndexType* row_ptrs, const IndexType* cols,
+                           size_type size, IndexType* out_row_ptrs,
+                           IndexType* out_cols)
+{
+    // Kruskal's algorithm with the lower triangular entries ordered by row
+    disjoint_sets<IndexType> sets(exec, static_cast<IndexType>(size));
+    IndexType out_nz{};
+    for (IndexType row = 0; row < static_cast<IndexType>(size); row++) {
+        out_row_ptrs[row] = out_nz;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = cols[nz];
+            if (col < row) {
+                const auto row_rep = sets.find(row);
+                const auto col_rep = sets.find(col);
+                // only keep edges connecting two different subtrees
+                if (row_rep != col_rep) {
+                    out_cols[out_nz] = col;
+                    out_nz++;
+                    sets.join(row_rep, col_rep);
+                }
+            }
+        }
+    }
+    out_row_ptrs[size] = out_nz;
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_CHOLESKY_COMPUTE_SKELETON_TREE);
+
+
 template <typename ValueType, typename IndexType>
 void symbolic_count(std::shared_ptr<const DefaultExecutor> exec,
                     const matrix::Csr<ValueType, IndexType>* mtx,
@@ -34,6 +34,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cassert>
+#include <functional>
 #include <memory>
 
 
@@ -55,6 +57,160 @@ namespace reference {
 namespace lu_factorization {
 
 
+template <typename IndexType>
+void symbolic_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                        const IndexType* row_ptrs, const IndexType* col_idxs,
+                        size_type num_rows, IndexType* out_row_ptrs,
+                        array<IndexType>& out_col_idx_array)
+{
+    vector<IndexType> fill(num_rows, {exec});
+    vector<IndexType> out_col_idxs{{exec}};
+    vector<IndexType> diags(num_rows, {exec});
+    deque<IndexType> frontier_queue{{exec}};
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        out_row_ptrs[row] = out_col_idxs.size();
+        fill[row] = row;
+        // first copy over the original row and add all lower triangular entries
+        // to the queue
+        const auto row_begin = row_ptrs[row];
+        const auto row_end = row_ptrs[row + 1];
+        for (auto nz = row_begin; nz < row_end; nz++) {
+            const auto col = col_idxs[nz];
+            fill[col] = row;
+            if (col < row) {
+                frontier_queue.push_back(col);
+            }
+            out_col_idxs.push_back(col);
+        }
+        // then add fill-in for all queued entries
+        while (!frontier_queue.empty()) {
+            const auto frontier = frontier_queue.front();
+            assert(frontier < row);
+            frontier_queue.pop_front();
+            // add the fill-in for this node from U
+            const auto upper_begin = diags[frontier] + 1;
+            const auto upper_end = out_row_ptrs[frontier + 1];
+            for (auto nz = upper_begin; nz < upper_end; nz++) {
+                const auto col = out_col_idxs[nz];
+                if (fill[col] < row) {
+                    fill[col] = row;
+                    out_col_idxs.push_back(col);
+                    // any fill-in on the lower triangle may introduce
+                    // additional fill-in when eliminated, so we need to enqueue
+                    // it as well.
+                    if (col < row) {
+                        frontier_queue.push_back(col);
+                    }
+                }
+            }
+        }
+        // restore sorting and find diagonal entry to separate L and U
+        const auto row_begin_it = out_col_idxs.begin() + out_row_ptrs[row];
+        const auto row_end_it = out_col_idxs.end();
+        std::sort(row_begin_it, row_end_it);
+        auto row_diag_it = std::lower_bound(row_begin_it, row_end_it, row);
+        // add diagonal if it's missing
+        if (row_diag_it == row_end_it || *row_diag_it != row) {
+            row_diag_it = out_col_idxs.insert(row_diag_it, row);
+        }
+        diags[row] = std::distance(out_col_idxs.begin(), row_diag_it);
+    }
+    const auto out_nnz = static_cast<size_type>(out_col_idxs.size());
+    out_row_ptrs[num_rows] = out_nnz;
+    out_col_idx_array.resize_and_reset(out_nnz);
+    std::copy(out_col_idxs.begin(), out_col_idxs.end(),
+              out_col_idx_array.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_LU_SYMBOLIC_FACTORIZE);
+
+
+template <typename IndexType>
+void symbolic_factorize_fill_level(
+    std::shared_ptr<const DefaultExecutor> exec, const IndexType* row_ptrs,
+    const IndexType* col_idxs, size_type num_rows, size_type fill_level,
+    IndexType* out_row_ptrs, array<IndexType>& out_col_idx_array)
+{
+    const auto max_level =
+        static_cast<IndexType>(std::min(fill_level, num_rows));
+    // level of fill of each entry in the current row, -1 if not present
+    vector<IndexType> row_levels(num_rows, -1, {exec});
+    vector<IndexType> row_cols{{exec}};
+    vector<IndexType> out_col_idxs{{exec}};
+    vector<IndexType> out_levels{{exec}};
+    vector<IndexType> diags(num_rows, {exec});
+    // the lower triangular entries need to be eliminated in increasing order,
+    // since their level is only final once all previous ones were eliminated
+    vector<IndexType> frontier_heap{{exec}};
+    const auto heap_cmp = std::greater<IndexType>{};
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        out_row_ptrs[row] = out_col_idxs.size();
+        // the original entries have level 0
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            row_levels[col] = 0;
+            row_cols.push_back(col);
+            if (col < row) {
+                frontier_heap.push_back(col);
+                std::push_heap(frontier_heap.begin(), frontier_heap.end(),
+                               heap_cmp);
+            }
+        }
+        while (!frontier_heap.empty()) {
+            std::pop_heap(frontier_heap.begin(), frontier_heap.end(),
+                          heap_cmp);
+            const auto frontier = frontier_heap.back();
+            frontier_heap.pop_back();
+            const auto frontier_level = row_levels[frontier];
+            // add the fill-in for this node from U
+            const auto upper_begin = diags[frontier] + 1;
+            const auto upper_end = out_row_ptrs[frontier + 1];
+            for (auto nz = upper_begin; nz < upper_end; nz++) {
+                const auto col = out_col_idxs[nz];
+                const auto level = frontier_level + out_levels[nz] + 1;
+                if (level > max_level) {
+                    continue;
+                }
+                if (row_levels[col] < 0) {
+                    row_levels[col] = level;
+                    row_cols.push_back(col);
+                    if (col < row) {
+                        frontier_heap.push_back(col);
+                        std::push_heap(frontier_heap.begin(),
+                                       frontier_heap.end(), heap_cmp);
+                    }
+                } else {
+                    row_levels[col] = std::min(row_levels[col], level);
+                }
+            }
+        }
+        // add diagonal if it's missing
+        if (row_levels[row] < 0) {
+            row_levels[row] = 0;
+            row_cols.push_back(row);
+        }
+        std::sort(row_cols.begin(), row_cols.end());
+        for (const auto col : row_cols) {
+            if (col == row) {
+                diags[row] = out_col_idxs.size();
+            }
+            out_col_idxs.push_back(col);
+            out_levels.push_back(row_levels[col]);
+            row_levels[col] = -1;
+        }
+        row_cols.clear();
+    }
+    const auto out_nnz = static_cast<size_type>(out_col_idxs.size());
+    out_row_ptrs[num_rows] = out_nnz;
+    out_col_idx_array.resize_and_reset(out_nnz);
+    std::copy(out_col_idxs.begin(), out_col_idxs.end(),
+              out_col_idx_array.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_LU_SYMBOLIC_FACTORIZE_FILL_LEVEL);
+
+
 template <typename ValueType, typename IndexType>
 void initialize(std::shared_ptr<const DefaultExecutor> exec,
                 const matrix::Csr<ValueType, IndexType>* mtx,
@@ -97,7 +253,7 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
                const int32* lookup_storage, const IndexType* diag_idxs,
                matrix::Csr<ValueType, IndexType>* factors,
-               array<int>& tmp_storage)
+               bool checked_lookup, array<int>& tmp_storage)
 {
     const auto num_rows = factors->get_size()[0];
     const auto row_ptrs = factors->get_const_row_ptrs();
@@ -118,8 +274,16 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
             for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
                 const auto col = cols[dep_nz];
                 const auto val = vals[dep_nz];
-                const auto nz = row_begin + lookup.lookup_unsafe(col);
-                vals[nz] -= scale * val;
+                if (checked_lookup) {
+                    // drop updates outside the sparsity pattern
+                    const auto idx = lookup[col];
+                    if (idx != invalid_index<IndexType>()) {
+                        vals[row_begin + idx] -= scale * val;
+                    }
+                } else {
+                    const auto nz = row_begin + lookup.lookup_unsafe(col);
+                    vals[nz] -= scale * val;
+                }
             }
         }
     }
@@ -0,0 +1,172 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/galerkin_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Galerkin product namespace.
+ *
+ * @ingroup galerkin
+ */
+namespace galerkin {
+
+
+template <typename ValueType, typename IndexType>
+void compute_rap_symbolic(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* restriction,
+    const matrix::Csr<ValueType, IndexType>* mtx,
+    const matrix::Csr<ValueType, IndexType>* prolongator,
+    matrix::Csr<ValueType, IndexType>* coarse)
+{
+    const auto num_coarse = static_cast<IndexType>(coarse->get_size()[0]);
+    const auto r_row_ptrs = restriction->get_const_row_ptrs();
+    const auto r_col_idxs = restriction->get_const_col_idxs();
+    const auto a_row_ptrs = mtx->get_const_row_ptrs();
+    const auto a_col_idxs = mtx->get_const_col_idxs();
+    const auto p_row_ptrs = prolongator->get_const_row_ptrs();
+    const auto p_col_idxs = prolongator->get_const_col_idxs();
+    // marker[col] == row marks col as already part of the coarse row
+    vector<IndexType> marker(coarse->get_size()[1], -1, {exec});
+    const auto for_each_col = [&](IndexType row, auto callback) {
+        for (auto r_nz = r_row_ptrs[row]; r_nz < r_row_ptrs[row + 1];
+             r_nz++) {
+            const auto fine_row = r_col_idxs[r_nz];
+            for (auto a_nz = a_row_ptrs[fine_row];
+                 a_nz < a_row_ptrs[fine_row + 1]; a_nz++) {
+                const auto fine_col = a_col_idxs[a_nz];
+                for (auto p_nz = p_row_ptrs[fine_col];
+                     p_nz < p_row_ptrs[fine_col + 1]; p_nz++) {
+                    const auto col = p_col_idxs[p_nz];
+                    if (marker[col] != row) {
+                        marker[col] = row;
+                        callback(col);
+                    }
+                }
+            }
+        }
+    };
+    auto c_row_ptrs = coarse->get_row_ptrs();
+    for (IndexType row = 0; row < num_coarse; row++) {
+        IndexType count{};
+        for_each_col(row, [&](IndexType) { count++; });
+        c_row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, c_row_ptrs, num_coarse + 1);
+    const auto nnz = static_cast<size_type>(c_row_ptrs[num_coarse]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse};
+    auto& c_col_idxs_array = builder.get_col_idx_array();
+    auto& c_vals_array = builder.get_value_array();
+    c_col_idxs_array.resize_and_reset(nnz);
+    c_vals_array.resize_and_reset(nnz);
+    auto c_col_idxs = c_col_idxs_array.get_data();
+    std::fill(marker.begin(), marker.end(), -1);
+    for (IndexType row = 0; row < num_coarse; row++) {
+        auto nz = c_row_ptrs[row];
+        for_each_col(row, [&](IndexType col) { c_col_idxs[nz++] = col; });
+        std::sort(c_col_idxs + c_row_ptrs[row], c_col_idxs + nz);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_GALERKIN_COMPUTE_RAP_SYMBOLIC);
+
+
+template <typename ValueType, typename IndexType>
+void compute_rap_numeric(std::shared_ptr<const DefaultExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType>* restriction,
+                         const matrix::Csr<ValueType, IndexType>* mtx,
+                         const matrix::Csr<ValueType, IndexType>* prolongator,
+                         matrix::Csr<ValueType, IndexType>* coarse)
+{
+    const auto num_coarse = static_cast<IndexType>(coarse->get_size()[0]);
+    const auto r_row_ptrs = restriction->get_const_row_ptrs();
+    const auto r_col_idxs = restriction->get_const_col_idxs();
+    const auto r_vals = restriction->get_const_values();
+    const auto a_row_ptrs = mtx->get_const_row_ptrs();
+    const auto a_col_idxs = mtx->get_const_col_idxs();
+    const auto a_vals = mtx->get_const_values();
+    const auto p_row_ptrs = prolongator->get_const_row_ptrs();
+    const auto p_col_idxs = prolongator->get_const_col_idxs();
+    const auto p_vals = prolongator->get_const_values();
+    const auto c_row_ptrs = coarse->get_const_row_ptrs();
+    const auto c_col_idxs = coarse->get_const_col_idxs();
+    auto c_vals = coarse->get_values();
+    // position[col] is the storage index of col in the current coarse row
+    vector<IndexType> position(coarse->get_size()[1], {exec});
+    for (IndexType row = 0; row < num_coarse; row++) {
+        for (auto nz = c_row_ptrs[row]; nz < c_row_ptrs[row + 1]; nz++) {
+            position[c_col_idxs[nz]] = nz;
+            c_vals[nz] = zero<ValueType>();
+        }
+        for (auto r_nz = r_row_ptrs[row]; r_nz < r_row_ptrs[row + 1];
+             r_nz++) {
+            const auto fine_row = r_col_idxs[r_nz];
+            for (auto a_nz = a_row_ptrs[fine_row];
+                 a_nz < a_row_ptrs[fine_row + 1]; a_nz++) {
+                const auto fine_col = a_col_idxs[a_nz];
+                const auto ra_val = r_vals[r_nz] * a_vals[a_nz];
+                for (auto p_nz = p_row_ptrs[fine_col];
+                     p_nz < p_row_ptrs[fine_col + 1]; p_nz++) {
+                    c_vals[position[p_col_idxs[p_nz]]] += ra_val * p_vals[p_nz];
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_GALERKIN_COMPUTE_RAP_NUMERIC);
+
+
+}  // namespace galerkin
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -348,6 +348,62 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine_csr,
+                        const IndexType* agg, const IndexType* agg_ptrs,
+                        const IndexType* agg_rows,
+                        matrix::Csr<ValueType, IndexType>* coarse_csr)
+{
+    const auto num_agg = coarse_csr->get_size()[0];
+    const auto fine_row_ptrs = fine_csr->get_const_row_ptrs();
+    const auto fine_col_idxs = fine_csr->get_const_col_idxs();
+    const auto fine_vals = fine_csr->get_const_values();
+    auto coarse_row_ptrs = coarse_csr->get_row_ptrs();
+    vector<std::pair<IndexType, ValueType>> row_entries(exec);
+    vector<IndexType> coarse_col_idxs(exec);
+    vector<ValueType> coarse_vals(exec);
+    coarse_row_ptrs[0] = 0;
+    for (size_type coarse_row = 0; coarse_row < num_agg; coarse_row++) {
+        row_entries.clear();
+        for (auto i = agg_ptrs[coarse_row]; i < agg_ptrs[coarse_row + 1];
+             i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = fine_row_ptrs[fine_row];
+                 nz < fine_row_ptrs[fine_row + 1]; nz++) {
+                row_entries.emplace_back(agg[fine_col_idxs[nz]],
+                                         fine_vals[nz]);
+            }
+        }
+        std::stable_sort(row_entries.begin(), row_entries.end(),
+                         [](auto a, auto b) { return a.first < b.first; });
+        const auto row_begin = coarse_col_idxs.size();
+        for (auto entry : row_entries) {
+            if (coarse_col_idxs.size() > row_begin &&
+                coarse_col_idxs.back() == entry.first) {
+                coarse_vals.back() += entry.second;
+            } else {
+                coarse_col_idxs.push_back(entry.first);
+                coarse_vals.push_back(entry.second);
+            }
+        }
+        coarse_row_ptrs[coarse_row + 1] =
+            static_cast<IndexType>(coarse_col_idxs.size());
+    }
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse_csr};
+    auto& col_idxs_array = builder.get_col_idx_array();
+    auto& vals_array = builder.get_value_array();
+    col_idxs_array.resize_and_reset(coarse_col_idxs.size());
+    vals_array.resize_and_reset(coarse_vals.size());
+    std::copy(coarse_col_idxs.begin(), coarse_col_idxs.end(),
+              col_idxs_array.get_data());
+    std::copy(coarse_vals.begin(), coarse_vals.end(), vals_array.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace reference
 }  // namespace kernels
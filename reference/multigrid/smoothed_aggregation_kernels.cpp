@@ -0,0 +1,306 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/smoothed_aggregation_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The smoothed aggregation namespace.
+ *
+ * @ingroup smoothed_aggregation
+ */
+namespace smoothed_aggregation {
+
+
+template <typename ValueType, typename IndexType>
+void filter_matrix(std::shared_ptr<const DefaultExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* mtx,
+                   remove_complex<ValueType> threshold,
+                   matrix::Csr<ValueType, IndexType>* filtered)
+{
+    const auto num_rows = static_cast<IndexType>(mtx->get_size()[0]);
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    vector<remove_complex<ValueType>> diag(num_rows, {exec});
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag[row] = abs(vals[nz]);
+            }
+        }
+    }
+    const auto is_strong = [&](IndexType row, IndexType nz) {
+        const auto col = col_idxs[nz];
+        return col != row &&
+               abs(vals[nz]) >= threshold * sqrt(diag[row] * diag[col]);
+    };
+    // every row contains the diagonal and the strong off-diagonal entries
+    auto out_row_ptrs = filtered->get_row_ptrs();
+    for (IndexType row = 0; row < num_rows; row++) {
+        IndexType count{1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            count += is_strong(row, nz);
+        }
+        out_row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_nnz = static_cast<size_type>(out_row_ptrs[num_rows]);
+    matrix::CsrBuilder<ValueType, IndexType> builder{filtered};
+    auto& out_col_idxs_array = builder.get_col_idx_array();
+    auto& out_vals_array = builder.get_value_array();
+    out_col_idxs_array.resize_and_reset(out_nnz);
+    out_vals_array.resize_and_reset(out_nnz);
+    auto out_col_idxs = out_col_idxs_array.get_data();
+    auto out_vals = out_vals_array.get_data();
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out_nz = out_row_ptrs[row];
+        IndexType diag_nz{-1};
+        // weak connections are lumped into the diagonal
+        auto diag_val = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (diag_nz < 0 && col >= row) {
+                diag_nz = out_nz;
+                out_col_idxs[out_nz] = row;
+                out_nz++;
+            }
+            if (is_strong(row, nz)) {
+                out_col_idxs[out_nz] = col;
+                out_vals[out_nz] = vals[nz];
+                out_nz++;
+            } else {
+                diag_val += vals[nz];
+            }
+        }
+        if (diag_nz < 0) {
+            diag_nz = out_nz;
+            out_col_idxs[out_nz] = row;
+        }
+        out_vals[diag_nz] = diag_val;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_FILTER_MATRIX);
+
+
+template <typename ValueType, typename IndexType>
+void aggregate(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Csr<ValueType, IndexType>* filtered,
+               array<IndexType>& agg, IndexType* num_agg)
+{
+    // states ordered such that roots dominate the maximum in their vicinity
+    constexpr int8 nonroot = 0;
+    constexpr int8 undecided = 1;
+    constexpr int8 root = 2;
+    using key_type = std::tuple<int8, uint32, IndexType>;
+    const auto num_rows = static_cast<IndexType>(filtered->get_size()[0]);
+    const auto row_ptrs = filtered->get_const_row_ptrs();
+    const auto col_idxs = filtered->get_const_col_idxs();
+    const auto vals = filtered->get_const_values();
+    vector<int8> state(num_rows, undecided, {exec});
+    vector<key_type> max_dist1(num_rows, {exec});
+    vector<key_type> max_dist2(num_rows, {exec});
+    // Knuth's multiplicative hash as pseudo-random priority
+    const auto get_key = [&](IndexType row) {
+        return key_type{state[row], static_cast<uint32>(row) * 2654435761u,
+                        row};
+    };
+    // compute a distance-2 maximal independent set of roots: In each round,
+    // every undecided row that has the largest key in its distance-2
+    // neighborhood becomes a root, and every undecided row with a root in its
+    // distance-2 neighborhood does not.
+    bool done = false;
+    while (!done) {
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto max_key = get_key(row);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_key = std::max(max_key, get_key(col_idxs[nz]));
+            }
+            max_dist1[row] = max_key;
+        }
+        for (IndexType row = 0; row < num_rows; row++) {
+            auto max_key = max_dist1[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_key = std::max(max_key, max_dist1[col_idxs[nz]]);
+            }
+            max_dist2[row] = max_key;
+        }
+        done = true;
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (state[row] == undecided) {
+                if (std::get<2>(max_dist2[row]) == row) {
+                    state[row] = root;
+                } else if (std::get<0>(max_dist2[row]) == root) {
+                    state[row] = nonroot;
+                } else {
+                    done = false;
+                }
+            }
+        }
+    }
+    auto agg_vals = agg.get_data();
+    IndexType agg_count{};
+    for (IndexType row = 0; row < num_rows; row++) {
+        agg_vals[row] = state[row] == root ? agg_count++ : -1;
+    }
+    // the neighborhoods of the roots are disjoint, since the roots are at
+    // least three edges apart
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (state[row] != root && state[col] == root) {
+                agg_vals[row] = agg_vals[col];
+            }
+        }
+    }
+    // all remaining rows are neighbors of the aggregated rows by maximality,
+    // they join the most strongly connected neighboring aggregate
+    vector<IndexType> first_agg(agg_vals, agg_vals + num_rows, {exec});
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (first_agg[row] >= 0) {
+            continue;
+        }
+        remove_complex<ValueType> max_weight{-1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (first_agg[col] >= 0 && abs(vals[nz]) > max_weight) {
+                max_weight = abs(vals[nz]);
+                agg_vals[row] = first_agg[col];
+            }
+        }
+    }
+    *num_agg = agg_count;
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_AGGREGATE);
+
+
+template <typename ValueType, typename IndexType>
+void compute_prolongator(std::shared_ptr<const DefaultExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType>* filtered,
+                         const array<IndexType>& agg,
+                         remove_complex<ValueType> damping,
+                         matrix::Csr<ValueType, IndexType>* prolongator)
+{
+    const auto num_rows = static_cast<IndexType>(filtered->get_size()[0]);
+    const auto row_ptrs = filtered->get_const_row_ptrs();
+    const auto col_idxs = filtered->get_const_col_idxs();
+    const auto vals = filtered->get_const_values();
+    const auto agg_vals = agg.get_const_data();
+    // the diagonal is always present in the filtered matrix
+    vector<ValueType> diag(num_rows, zero<ValueType>(), {exec});
+    remove_complex<ValueType> spectral_bound{};
+    for (IndexType row = 0; row < num_rows; row++) {
+        remove_complex<ValueType> row_sum{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag[row] = vals[nz];
+            }
+            row_sum += abs(vals[nz]);
+        }
+        if (diag[row] != zero<ValueType>()) {
+            spectral_bound = std::max(spectral_bound, row_sum / abs(diag[row]));
+        }
+    }
+    const auto omega = spectral_bound > 0 ? damping / spectral_bound
+                                          : remove_complex<ValueType>{};
+    auto out_row_ptrs = prolongator->get_row_ptrs();
+    vector<std::pair<IndexType, ValueType>> row_entries(exec);
+    vector<IndexType> out_col_idxs(exec);
+    vector<ValueType> out_vals(exec);
+    out_row_ptrs[0] = 0;
+    for (IndexType row = 0; row < num_rows; row++) {
+        row_entries.clear();
+        // P = (I - omega D^-1 A_F) P_tent
+        row_entries.emplace_back(agg_vals[row], one<ValueType>());
+        if (diag[row] != zero<ValueType>()) {
+            const auto scale = -omega / diag[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                row_entries.emplace_back(agg_vals[col_idxs[nz]],
+                                         scale * vals[nz]);
+            }
+        }
+        std::stable_sort(row_entries.begin(), row_entries.end(),
+                         [](auto a, auto b) { return a.first < b.first; });
+        const auto row_begin = out_col_idxs.size();
+        for (auto entry : row_entries) {
+            if (out_col_idxs.size() > row_begin &&
+                out_col_idxs.back() == entry.first) {
+                out_vals.back() += entry.second;
+            } else {
+                out_col_idxs.push_back(entry.first);
+                out_vals.push_back(entry.second);
+            }
+        }
+        out_row_ptrs[row + 1] = static_cast<IndexType>(out_col_idxs.size());
+    }
+    matrix::CsrBuilder<ValueType, IndexType> builder{prolongator};
+    auto& col_idxs_array = builder.get_col_idx_array();
+    auto& vals_array = builder.get_value_array();
+    col_idxs_array.resize_and_reset(out_col_idxs.size());
+    vals_array.resize_and_reset(out_vals.size());
+    std::copy(out_col_idxs.begin(), out_col_idxs.end(),
+              col_idxs_array.get_data());
+    std::copy(out_vals.begin(), out_vals.end(), vals_array.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SMOOTHED_AGGREGATION_COMPUTE_PROLONGATOR);
+
+
+}  // namespace smoothed_aggregation
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
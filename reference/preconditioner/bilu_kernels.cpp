@@ -0,0 +1,258 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/bilu_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The block ILU preconditioner namespace.
+ *
+ * @ingroup bilu
+ */
+namespace bilu {
+namespace {
+
+
+// all blocks are stored in column-major order
+
+
+template <typename ValueType>
+void block_mul(int block_size, const ValueType* a, const ValueType* b,
+               ValueType* c)
+{
+    std::fill_n(c, block_size * block_size, zero<ValueType>());
+    for (int j = 0; j < block_size; j++) {
+        for (int k = 0; k < block_size; k++) {
+            const auto b_kj = b[k + j * block_size];
+            for (int i = 0; i < block_size; i++) {
+                c[i + j * block_size] += a[i + k * block_size] * b_kj;
+            }
+        }
+    }
+}
+
+
+template <typename ValueType>
+void block_sub_mul(int block_size, const ValueType* a, const ValueType* b,
+                   ValueType* c)
+{
+    for (int j = 0; j < block_size; j++) {
+        for (int k = 0; k < block_size; k++) {
+            const auto b_kj = b[k + j * block_size];
+            for (int i = 0; i < block_size; i++) {
+                c[i + j * block_size] -= a[i + k * block_size] * b_kj;
+            }
+        }
+    }
+}
+
+
+// inverts the block in-place by Gauss-Jordan elimination with partial
+// pivoting on the augmented matrix [block | I] stored in work
+template <typename ValueType>
+void invert_block(int block_size, ValueType* block, ValueType* work)
+{
+    const auto aug = [&](int row, int col) -> ValueType& {
+        return work[row + col * block_size];
+    };
+    for (int col = 0; col < block_size; col++) {
+        for (int row = 0; row < block_size; row++) {
+            aug(row, col) = block[row + col * block_size];
+            aug(row, col + block_size) =
+                row == col ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+    for (int k = 0; k < block_size; k++) {
+        auto pivot = k;
+        for (int row = k + 1; row < block_size; row++) {
+            if (abs(aug(row, k)) > abs(aug(pivot, k))) {
+                pivot = row;
+            }
+        }
+        if (pivot != k) {
+            for (int col = 0; col < 2 * block_size; col++) {
+                std::swap(aug(k, col), aug(pivot, col));
+            }
+        }
+        const auto inv_diag = one<ValueType>() / aug(k, k);
+        for (int col = 0; col < 2 * block_size; col++) {
+            aug(k, col) *= inv_diag;
+        }
+        for (int row = 0; row < block_size; row++) {
+            const auto factor = aug(row, k);
+            if (row == k || is_zero(factor)) {
+                continue;
+            }
+            for (int col = 0; col < 2 * block_size; col++) {
+                aug(row, col) -= factor * aug(k, col);
+            }
+        }
+    }
+    for (int col = 0; col < block_size; col++) {
+        for (int row = 0; row < block_size; row++) {
+            block[row + col * block_size] = aug(row, col + block_size);
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void factorize(std::shared_ptr<const DefaultExecutor> exec,
+               matrix::Fbcsr<ValueType, IndexType>* factors,
+               IndexType* diag_idxs)
+{
+    const auto block_size = factors->get_block_size();
+    const auto block_nnz = block_size * block_size;
+    const auto num_block_rows =
+        static_cast<IndexType>(factors->get_num_block_rows());
+    const auto row_ptrs = factors->get_const_row_ptrs();
+    const auto col_idxs = factors->get_const_col_idxs();
+    const auto values = factors->get_values();
+    vector<ValueType> work(2 * block_nnz, {exec});
+    for (IndexType row = 0; row < num_block_rows; row++) {
+        const auto row_begin = row_ptrs[row];
+        const auto row_end = row_ptrs[row + 1];
+        diag_idxs[row] = std::distance(
+            col_idxs,
+            std::lower_bound(col_idxs + row_begin, col_idxs + row_end, row));
+        for (auto nz = row_begin; nz < diag_idxs[row]; nz++) {
+            const auto dep = col_idxs[nz];
+            const auto lower_block = values + nz * block_nnz;
+            // L(row, dep) = A(row, dep) U(dep, dep)^-1
+            std::copy_n(lower_block, block_nnz, work.begin());
+            block_mul(block_size, work.data(),
+                      values + diag_idxs[dep] * block_nnz, lower_block);
+            // A(row, col) -= L(row, dep) U(dep, col) inside the pattern
+            auto out_nz = nz + 1;
+            for (auto dep_nz = diag_idxs[dep] + 1; dep_nz < row_ptrs[dep + 1];
+                 dep_nz++) {
+                const auto col = col_idxs[dep_nz];
+                while (out_nz < row_end && col_idxs[out_nz] < col) {
+                    out_nz++;
+                }
+                if (out_nz < row_end && col_idxs[out_nz] == col) {
+                    block_sub_mul(block_size, lower_block,
+                                  values + dep_nz * block_nnz,
+                                  values + out_nz * block_nnz);
+                }
+            }
+        }
+        invert_block(block_size, values + diag_idxs[row] * block_nnz,
+                     work.data());
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_BILU_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void apply(std::shared_ptr<const DefaultExecutor> exec,
+           const matrix::Fbcsr<ValueType, IndexType>* factors,
+           const IndexType* diag_idxs, const matrix::Dense<ValueType>* b,
+           matrix::Dense<ValueType>* x)
+{
+    const auto block_size = factors->get_block_size();
+    const auto block_nnz = block_size * block_size;
+    const auto num_block_rows =
+        static_cast<IndexType>(factors->get_num_block_rows());
+    const auto num_rhs = b->get_size()[1];
+    const auto row_ptrs = factors->get_const_row_ptrs();
+    const auto col_idxs = factors->get_const_col_idxs();
+    const auto values = factors->get_const_values();
+    // subtracts the product of the block with x[col] from x[row]
+    const auto sub_block_product = [&](IndexType nz, IndexType row,
+                                       IndexType col, size_type rhs) {
+        const auto block = values + nz * block_nnz;
+        for (int j = 0; j < block_size; j++) {
+            const auto x_j = x->at(col * block_size + j, rhs);
+            for (int i = 0; i < block_size; i++) {
+                x->at(row * block_size + i, rhs) -=
+                    block[i + j * block_size] * x_j;
+            }
+        }
+    };
+    vector<ValueType> tmp(block_size, {exec});
+    for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+        // forward substitution with the unit lower block triangular factor
+        for (IndexType row = 0; row < num_block_rows; row++) {
+            for (int i = 0; i < block_size; i++) {
+                x->at(row * block_size + i, rhs) =
+                    b->at(row * block_size + i, rhs);
+            }
+            for (auto nz = row_ptrs[row]; nz < diag_idxs[row]; nz++) {
+                sub_block_product(nz, row, col_idxs[nz], rhs);
+            }
+        }
+        // backward substitution with the upper block triangular factor
+        for (auto row = num_block_rows - 1; row >= 0; row--) {
+            for (auto nz = diag_idxs[row] + 1; nz < row_ptrs[row + 1]; nz++) {
+                sub_block_product(nz, row, col_idxs[nz], rhs);
+            }
+            const auto inv_diag = values + diag_idxs[row] * block_nnz;
+            std::fill(tmp.begin(), tmp.end(), zero<ValueType>());
+            for (int j = 0; j < block_size; j++) {
+                const auto x_j = x->at(row * block_size + j, rhs);
+                for (int i = 0; i < block_size; i++) {
+                    tmp[i] += inv_diag[i + j * block_size] * x_j;
+                }
+            }
+            for (int i = 0; i < block_size; i++) {
+                x->at(row * block_size + i, rhs) = tmp[i];
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BILU_APPLY_KERNEL);
+
+
+}  // namespace bilu
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,339 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/fsai_kernels.hpp"
+
+
+#include <algorithm>
+#include <utility>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The adaptive FSAI preconditioner namespace.
+ *
+ * @ingroup fsai
+ */
+namespace fsai {
+namespace {
+
+
+/**
+ * Solves the hermitian positive definite size x size system stored row-major
+ * in mtx (only the lower triangle is accessed) in-place in rhs by computing
+ * its Cholesky factorization. Returns false if the system is not positive
+ * definite.
+ */
+template <typename ValueType, typename IndexType>
+bool cholesky_solve(IndexType size, ValueType* mtx, ValueType* rhs)
+{
+    for (IndexType k = 0; k < size; ++k) {
+        auto diag = real(mtx[k * size + k]);
+        for (IndexType j = 0; j < k; ++j) {
+            diag -= squared_norm(mtx[k * size + j]);
+        }
+        if (!(diag > zero(diag))) {
+            return false;
+        }
+        diag = sqrt(diag);
+        mtx[k * size + k] = diag;
+        for (IndexType i = k + 1; i < size; ++i) {
+            auto val = mtx[i * size + k];
+            for (IndexType j = 0; j < k; ++j) {
+                val -= mtx[i * size + j] * conj(mtx[k * size + j]);
+            }
+            mtx[i * size + k] = val / diag;
+        }
+    }
+    for (IndexType i = 0; i < size; ++i) {
+        for (IndexType j = 0; j < i; ++j) {
+            rhs[i] -= mtx[i * size + j] * rhs[j];
+        }
+        rhs[i] /= mtx[i * size + i];
+    }
+    for (auto i = size - 1; i >= 0; --i) {
+        for (auto j = i + 1; j < size; ++j) {
+            rhs[i] -= conj(mtx[j * size + i]) * rhs[j];
+        }
+        rhs[i] /= mtx[i * size + i];
+    }
+    return true;
+}
+
+
+/**
+ * Computes single rows of the adaptive FSAI factor. It stores the scratch
+ * data, so it can be reused for multiple rows, but not concurrently.
+ */
+template <typename ValueType, typename IndexType>
+class fsai_row_builder {
+public:
+    using real_type = remove_complex<ValueType>;
+
+    fsai_row_builder(std::shared_ptr<const DefaultExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* mtx,
+                     const real_type* diag, size_type steps,
+                     size_type step_size, real_type tolerance,
+                     IndexType max_row_nnz)
+        : row_ptrs_{mtx->get_const_row_ptrs()},
+          col_idxs_{mtx->get_const_col_idxs()},
+          vals_{mtx->get_const_values()},
+          diag_{diag},
+          steps_{steps},
+          step_size_{static_cast<IndexType>(step_size)},
+          tolerance_{tolerance},
+          pattern_marker_(mtx->get_size()[0], invalid_index<IndexType>(),
+                          {exec}),
+          gradient_marker_(mtx->get_size()[0], invalid_index<IndexType>(),
+                           {exec}),
+          gradient_(mtx->get_size()[0], {exec}),
+          candidates_{{exec}},
+          pattern_{{exec}},
+          solution_(max_row_nnz, {exec}),
+          rhs_(max_row_nnz, {exec}),
+          system_(max_row_nnz * max_row_nnz, {exec})
+    {}
+
+    /**
+     * Computes the given row of the factor and stores its column indices and
+     * values (sorted by column index) in out_cols and out_vals.
+     *
+     * @return the number of entries in the row.
+     */
+    IndexType build_row(IndexType row, IndexType* out_cols, ValueType* out_vals)
+    {
+        pattern_.clear();
+        IndexType size{};
+        // Kaporin number contribution of this row, for g(row) = 1
+        auto psi = real(lookup(row, row));
+        for (size_type step = 0; step < steps_; ++step) {
+            // gradient of psi: (A g)(k) for all k < row outside the pattern
+            candidates_.clear();
+            accumulate_gradient(row, row, one<ValueType>());
+            for (IndexType i = 0; i < size; ++i) {
+                accumulate_gradient(row, pattern_[i], solution_[i]);
+            }
+            for (auto& candidate : candidates_) {
+                const auto col = candidate.second;
+                candidate.first = squared_norm(gradient_[col]) / diag_[col];
+                gradient_[col] = zero<ValueType>();
+                gradient_marker_[col] = invalid_index<IndexType>();
+            }
+            const auto new_entries = std::min(
+                step_size_, static_cast<IndexType>(candidates_.size()));
+            if (new_entries == 0) {
+                break;
+            }
+            // pick the entries with the largest predicted reduction
+            std::partial_sort(candidates_.begin(),
+                              candidates_.begin() + new_entries,
+                              candidates_.end(),
+                              [](std::pair<real_type, IndexType> a,
+                                 std::pair<real_type, IndexType> b) {
+                                  return a.first > b.first;
+                              });
+            if (candidates_[0].first <= tolerance_ * psi) {
+                break;
+            }
+            for (IndexType i = 0; i < new_entries; ++i) {
+                pattern_.push_back(candidates_[i].second);
+            }
+            real_type new_psi{};
+            if (!solve(row, size + new_entries, new_psi)) {
+                // keep the last pattern if the system became indefinite
+                pattern_.resize(size);
+                break;
+            }
+            for (IndexType i = size; i < size + new_entries; ++i) {
+                pattern_marker_[pattern_[i]] = row;
+            }
+            size += new_entries;
+            std::copy_n(rhs_.begin(), size, solution_.begin());
+            psi = new_psi;
+        }
+        // scale the row such that (G A G^H)(row, row) = 1
+        const auto scale = one<real_type>() / sqrt(psi);
+        for (IndexType i = 0; i < size; ++i) {
+            out_cols[i] = pattern_[i];
+            out_vals[i] = solution_[i] * scale;
+        }
+        out_cols[size] = row;
+        out_vals[size] = scale;
+        // sort the off-diagonal entries, the diagonal is already last
+        for (IndexType i = 1; i < size; ++i) {
+            for (auto j = i; j > 0 && out_cols[j - 1] > out_cols[j]; --j) {
+                std::swap(out_cols[j - 1], out_cols[j]);
+                std::swap(out_vals[j - 1], out_vals[j]);
+            }
+        }
+        return size + 1;
+    }
+
+private:
+    ValueType lookup(IndexType row, IndexType col) const
+    {
+        const auto begin = col_idxs_ + row_ptrs_[row];
+        const auto end = col_idxs_ + row_ptrs_[row + 1];
+        const auto it = std::lower_bound(begin, end, col);
+        return it != end && *it == col ? vals_[it - col_idxs_]
+                                       : zero<ValueType>();
+    }
+
+    // adds A(:, col) * scale to the gradient for rows k < row outside the
+    // current pattern, using the symmetry of A
+    void accumulate_gradient(IndexType row, IndexType col, ValueType scale)
+    {
+        for (auto nz = row_ptrs_[col]; nz < row_ptrs_[col + 1]; ++nz) {
+            const auto k = col_idxs_[nz];
+            if (k >= row) {
+                break;
+            }
+            if (pattern_marker_[k] == row) {
+                continue;
+            }
+            if (gradient_marker_[k] != row) {
+                gradient_marker_[k] = row;
+                candidates_.emplace_back(zero<real_type>(), k);
+            }
+            gradient_[k] += conj(vals_[nz]) * scale;
+        }
+    }
+
+    // solves A(P, P) g = -A(P, row) for the first size pattern entries P
+    // and computes the resulting Kaporin number contribution
+    bool solve(IndexType row, IndexType size, real_type& psi)
+    {
+        for (IndexType i = 0; i < size; ++i) {
+            for (IndexType j = 0; j <= i; ++j) {
+                system_[i * size + j] = lookup(pattern_[i], pattern_[j]);
+            }
+            rhs_[i] = -lookup(pattern_[i], row);
+        }
+        if (!cholesky_solve(size, system_.data(), rhs_.data())) {
+            return false;
+        }
+        psi = real(lookup(row, row));
+        for (IndexType i = 0; i < size; ++i) {
+            psi += real(lookup(row, pattern_[i]) * rhs_[i]);
+        }
+        return psi > zero<real_type>();
+    }
+
+    const IndexType* row_ptrs_;
+    const IndexType* col_idxs_;
+    const ValueType* vals_;
+    const real_type* diag_;
+    size_type steps_;
+    IndexType step_size_;
+    real_type tolerance_;
+    vector<IndexType> pattern_marker_;
+    vector<IndexType> gradient_marker_;
+    vector<ValueType> gradient_;
+    vector<std::pair<real_type, IndexType>> candidates_;
+    vector<IndexType> pattern_;
+    vector<ValueType> solution_;
+    vector<ValueType> rhs_;
+    vector<ValueType> system_;
+};
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType, typename IndexType>
+void generate(std::shared_ptr<const DefaultExecutor> exec,
+              const matrix::Csr<ValueType, IndexType>* mtx, size_type steps,
+              size_type step_size, remove_complex<ValueType> tolerance,
+              matrix::Csr<ValueType, IndexType>* factor)
+{
+    const auto num_rows = static_cast<IndexType>(mtx->get_size()[0]);
+    const auto max_row_nnz = static_cast<IndexType>(
+        std::min<size_type>(steps * step_size + 1, num_rows));
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    vector<remove_complex<ValueType>> diag(num_rows, {exec});
+    for (IndexType row = 0; row < num_rows; ++row) {
+        diag[row] = zero<remove_complex<ValueType>>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            if (col_idxs[nz] == row) {
+                diag[row] = real(vals[nz]);
+            }
+        }
+    }
+    // build all rows into fixed-size slots, then compress them
+    const auto slot_size = static_cast<size_type>(max_row_nnz);
+    vector<IndexType> slot_cols(num_rows * slot_size, {exec});
+    vector<ValueType> slot_vals(num_rows * slot_size, {exec});
+    const auto out_row_ptrs = factor->get_row_ptrs();
+    fsai_row_builder<ValueType, IndexType> builder{
+        exec, mtx, diag.data(), steps, step_size, tolerance, max_row_nnz};
+    for (IndexType row = 0; row < num_rows; ++row) {
+        out_row_ptrs[row] = builder.build_row(
+            row, slot_cols.data() + row * slot_size,
+            slot_vals.data() + row * slot_size);
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto nnz = out_row_ptrs[num_rows];
+    matrix::CsrBuilder<ValueType, IndexType> factor_builder{factor};
+    factor_builder.get_col_idx_array().resize_and_reset(nnz);
+    factor_builder.get_value_array().resize_and_reset(nnz);
+    const auto out_cols = factor->get_col_idxs();
+    const auto out_vals = factor->get_values();
+    for (IndexType row = 0; row < num_rows; ++row) {
+        const auto row_begin = out_row_ptrs[row];
+        const auto row_nnz = out_row_ptrs[row + 1] - row_begin;
+        std::copy_n(slot_cols.data() + row * slot_size, row_nnz,
+                    out_cols + row_begin);
+        std::copy_n(slot_vals.data() + row * slot_size, row_nnz,
+                    out_vals + row_begin);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FSAI_GENERATE_KERNEL);
+
+
+}  // namespace fsai
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,124 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/reorder/coloring_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The graph coloring namespace.
+ *
+ * @ingroup reorder
+ */
+namespace coloring {
+
+
+template <typename IndexType>
+void color_graph(std::shared_ptr<const ReferenceExecutor> exec,
+                 IndexType num_vertices, const IndexType* row_ptrs,
+                 const IndexType* col_idxs,
+                 gko::experimental::reorder::coloring_distance distance,
+                 IndexType* colors, IndexType& num_colors)
+{
+    const bool distance_two =
+        distance == gko::experimental::reorder::coloring_distance::two;
+    // forbidden[c] == v marks color c as used by a neighbor of vertex v
+    vector<IndexType> forbidden(num_vertices, -1, {exec});
+    std::fill_n(colors, num_vertices, -1);
+    num_colors = 0;
+    for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+        const auto mark = [&](IndexType neighbor) {
+            if (colors[neighbor] >= 0) {
+                forbidden[colors[neighbor]] = vertex;
+            }
+        };
+        for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; ++nz) {
+            const auto neighbor = col_idxs[nz];
+            mark(neighbor);
+            if (distance_two) {
+                for (auto nz2 = row_ptrs[neighbor];
+                     nz2 < row_ptrs[neighbor + 1]; ++nz2) {
+                    if (col_idxs[nz2] != vertex) {
+                        mark(col_idxs[nz2]);
+                    }
+                }
+            }
+        }
+        IndexType color{};
+        while (forbidden[color] == vertex) {
+            ++color;
+        }
+        colors[vertex] = color;
+        num_colors = std::max(num_colors, color + 1);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_COLORING_COLOR_GRAPH_KERNEL);
+
+
+template <typename IndexType>
+void get_permutation(std::shared_ptr<const ReferenceExecutor> exec,
+                     IndexType num_vertices, const IndexType* colors,
+                     IndexType num_colors, IndexType* color_ptrs,
+                     IndexType* permutation)
+{
+    std::fill_n(color_ptrs, num_colors + 1, 0);
+    for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+        color_ptrs[colors[vertex] + 1]++;
+    }
+    std::partial_sum(color_ptrs, color_ptrs + num_colors + 1, color_ptrs);
+    vector<IndexType> offsets(color_ptrs, color_ptrs + num_colors, {exec});
+    for (IndexType vertex = 0; vertex < num_vertices; ++vertex) {
+        permutation[offsets[colors[vertex]]++] = vertex;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_COLORING_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace coloring
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
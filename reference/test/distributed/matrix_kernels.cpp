@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 
 
 #include "core/distributed/matrix_kernels.hpp"
@@ -568,4 +569,26 @@ TYPED_TEST(Matrix, BuildGhostMapScattered)
     }
 }
 
+
+TYPED_TEST(Matrix, AddsScaledRows)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using Dense = gko::matrix::Dense<value_type>;
+    auto alpha = gko::initialize<Dense>({2.0}, this->ref);
+    auto rows = gko::initialize<Dense>(
+        {I<value_type>{1.0, 2.0}, I<value_type>{3.0, 4.0}}, this->ref);
+    gko::array<local_index_type> row_idxs{this->ref, {3, 0}};
+    auto x = gko::initialize<Dense>(
+        {I<value_type>{1.0, 1.0}, I<value_type>{1.0, 1.0},
+         I<value_type>{1.0, 1.0}, I<value_type>{1.0, 1.0}},
+        this->ref);
+
+    gko::kernels::reference::distributed_matrix::add_scaled_rows(
+        this->ref, alpha.get(), rows.get(), row_idxs, x.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        x, l({{7.0, 9.0}, {1.0, 1.0}, {1.0, 1.0}, {3.0, 5.0}}), 0.0);
+}
+
 }  // namespace
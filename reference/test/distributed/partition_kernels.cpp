@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 #include "core/distributed/partition_kernels.hpp"
@@ -65,6 +66,46 @@ void assert_equal_data(const T* data, std::initializer_list<U> reference_data)
 }
 
 
+template <typename IndexType>
+gko::matrix_data<double, IndexType> generate_2d_laplacian(IndexType n)
+{
+    gko::matrix_data<double, IndexType> data{gko::dim<2>(n * n, n * n)};
+    for (IndexType i = 0; i < n; i++) {
+        for (IndexType j = 0; j < n; j++) {
+            const auto row = i * n + j;
+            if (i > 0) {
+                data.nonzeros.emplace_back(row, row - n, -1.0);
+            }
+            if (j > 0) {
+                data.nonzeros.emplace_back(row, row - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(row, row, 4.0);
+            if (j < n - 1) {
+                data.nonzeros.emplace_back(row, row + 1, -1.0);
+            }
+            if (i < n - 1) {
+                data.nonzeros.emplace_back(row, row + n, -1.0);
+            }
+        }
+    }
+    return data;
+}
+
+
+template <typename IndexType>
+gko::size_type compute_edge_cut(const gko::matrix_data<double, IndexType>& data,
+                                const gko::array<comm_index_type>& mapping)
+{
+    gko::size_type cut{};
+    for (const auto& entry : data.nonzeros) {
+        cut += mapping.get_const_data()[entry.row] !=
+               mapping.get_const_data()[entry.column];
+    }
+    // every edge is stored twice
+    return cut / 2;
+}
+
+
 template <typename LocalGlobalIndexType>
 class Partition : public ::testing::Test {
 protected:
@@ -294,4 +335,67 @@ TYPED_TEST(Partition, IsOrderedFail)
 }
 
 
+TYPED_TEST(Partition, BuildsMappingFromGraph)
+{
+    using global_index_type = typename TestFixture::global_index_type;
+    using part_type = typename TestFixture::part_type;
+    using mtx_type = gko::matrix::Csr<double, global_index_type>;
+    const global_index_type n = 16;
+    const comm_index_type num_parts = 4;
+    const auto data = generate_2d_laplacian(n);
+    auto mtx = gko::share(mtx_type::create(this->ref));
+    mtx->read(data);
+
+    auto mapping = gko::experimental::distributed::build_mapping_from_graph<
+        double, global_index_type>(this->ref, mtx, num_parts);
+    auto part = part_type::build_from_mapping(this->ref, mapping, num_parts);
+
+    ASSERT_EQ(mapping.get_num_elems(), n * n);
+    // splitting the rows into contiguous ranges cuts 3 * n edges
+    ASSERT_LT(compute_edge_cut(data, mapping), 3 * n);
+    for (comm_index_type p = 0; p < num_parts; p++) {
+        ASSERT_GT(part->get_part_size(p), 0);
+        ASSERT_LE(part->get_part_size(p), 67);
+    }
+}
+
+
+TYPED_TEST(Partition, BuildsBalancedMappingFromGraphWithOddNumberOfParts)
+{
+    using global_index_type = typename TestFixture::global_index_type;
+    using part_type = typename TestFixture::part_type;
+    using mtx_type = gko::matrix::Csr<double, global_index_type>;
+    const global_index_type n = 16;
+    const comm_index_type num_parts = 3;
+    auto mtx = gko::share(mtx_type::create(this->ref));
+    mtx->read(generate_2d_laplacian(n));
+
+    auto mapping = gko::experimental::distributed::build_mapping_from_graph<
+        double, global_index_type>(this->ref, mtx, num_parts, 0.1);
+    auto part = part_type::build_from_mapping(this->ref, mapping, num_parts);
+
+    for (comm_index_type p = 0; p < num_parts; p++) {
+        ASSERT_GT(part->get_part_size(p), 0);
+        ASSERT_LE(part->get_part_size(p), 93);
+    }
+}
+
+
+TYPED_TEST(Partition, BuildsMappingFromGraphWithOnePart)
+{
+    using global_index_type = typename TestFixture::global_index_type;
+    using mtx_type = gko::matrix::Csr<double, global_index_type>;
+    auto mtx = gko::share(mtx_type::create(this->ref));
+    mtx->read(generate_2d_laplacian(global_index_type{4}));
+
+    gko::array<comm_index_type> expected{this->ref, 16};
+    expected.fill(0);
+
+    auto mapping = gko::experimental::distributed::build_mapping_from_graph<
+        double, global_index_type>(this->ref, mtx, 1);
+
+    GKO_ASSERT_ARRAY_EQ(mapping, expected);
+}
+
+
 }  // namespace
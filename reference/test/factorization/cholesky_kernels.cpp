@@ -626,4 +626,28 @@ TYPED_TEST(Cholesky, FactorizeWithKnownSparsityWorks)
 }
 
 
+
+TYPED_TEST(Cholesky, RefactorizeWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        auto factory =
+            gko::experimental::factorization::Cholesky<value_type,
+                                                       index_type>::build()
+                .on(this->ref);
+        auto scaled_mtx = gko::share(gko::clone(this->mtx));
+        scaled_mtx->scale(gko::initialize<gko::matrix::Dense<value_type>>(
+            {2.0}, this->ref));
+        auto cholesky = factory->generate(scaled_mtx);
+        auto combined = cholesky->get_combined();
+
+        cholesky->refactorize(this->mtx);
+
+        ASSERT_EQ(cholesky->get_combined(), combined);
+        GKO_ASSERT_MTX_NEAR(cholesky->get_combined(), this->combined_ref,
+                            r<value_type>::value);
+    });
+}
+
 }  // namespace
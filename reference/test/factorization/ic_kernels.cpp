@@ -221,4 +221,28 @@ TYPED_TEST(Ic, GenerateGeneral)
 }
 
 
+
+TYPED_TEST(Ic, RefactorizeGeneral)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_system));
+    scaled_mtx->scale(
+        gko::initialize<gko::matrix::Dense<value_type>>({4.0}, this->exec));
+    auto fact =
+        factorization_type::build().on(this->exec)->generate(scaled_mtx);
+    auto l_factor = fact->get_l_factor();
+    auto lt_factor = fact->get_lt_factor();
+
+    fact->refactorize(this->mtx_system);
+
+    ASSERT_EQ(fact->get_l_factor(), l_factor);
+    ASSERT_EQ(fact->get_lt_factor(), lt_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, this->mtx_l_it_expect, this->tol);
+    GKO_ASSERT_MTX_NEAR(lt_factor,
+                        gko::as<Csr>(this->mtx_l_it_expect->conj_transpose()),
+                        this->tol);
+}
+
 }  // namespace
@@ -492,4 +492,96 @@ TYPED_TEST(Ilu, GenerateForReverseCsrSmall)
 }
 
 
+
+TYPED_TEST(Ilu, RefactorizeForDenseBig)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_big));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto factors = this->ilu_factory_skip->generate(scaled_mtx);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    factors->refactorize(this->mtx_big);
+
+    ASSERT_EQ(factors->get_l_factor(), l_factor);
+    ASSERT_EQ(factors->get_u_factor(), u_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, this->big_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->big_u_expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(Ilu, GenerateWithFillLevel)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    using ilu_type = typename TestFixture::ilu_type;
+    auto mtx = gko::share(gko::initialize<Dense>({{2., 0., 0., 1.},
+                                                  {1., 2., 0., 0.},
+                                                  {0., 1., 2., 0.},
+                                                  {0., 0., 1., 2.}},
+                                                 this->exec));
+    // the level 2 fill-in at (2, 3) is dropped
+    auto expected_l = gko::initialize<Dense>({{1., 0., 0., 0.},
+                                              {0.5, 1., 0., 0.},
+                                              {0., 0.5, 1., 0.},
+                                              {0., 0., 0.5, 1.}},
+                                             this->exec);
+    auto expected_u = gko::initialize<Dense>({{2., 0., 0., 1.},
+                                              {0., 2., 0., -0.5},
+                                              {0., 0., 2., 0.},
+                                              {0., 0., 0., 2.}},
+                                             this->exec);
+    auto factory = ilu_type::build().with_fill_level(1u).on(this->exec);
+
+    auto factors = factory->generate(mtx);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), expected_l,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(factors->get_u_factor(), expected_u,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Ilu, GenerateWithLargeFillLevelIsExactLu)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    using ilu_type = typename TestFixture::ilu_type;
+    auto factory = ilu_type::build().with_fill_level(6u).on(this->exec);
+    auto product = Dense::create(this->exec, this->mtx_big->get_size());
+    auto dense_u = Dense::create(this->exec);
+
+    auto factors = factory->generate(this->mtx_big);
+    factors->get_u_factor()->convert_to(dense_u);
+    factors->get_l_factor()->apply(dense_u, product);
+
+    GKO_ASSERT_MTX_NEAR(product, this->mtx_big, r<value_type>::value);
+}
+
+
+TYPED_TEST(Ilu, RefactorizeWithFillLevelForDenseBig)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    using ilu_type = typename TestFixture::ilu_type;
+    auto factory = ilu_type::build().with_fill_level(6u).on(this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_big));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto product = Dense::create(this->exec, this->mtx_big->get_size());
+    auto dense_u = Dense::create(this->exec);
+    auto factors = factory->generate(scaled_mtx);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    factors->refactorize(this->mtx_big);
+    u_factor->convert_to(dense_u);
+    l_factor->apply(dense_u, product);
+
+    ASSERT_EQ(factors->get_l_factor(), l_factor);
+    ASSERT_EQ(factors->get_u_factor(), u_factor);
+    GKO_ASSERT_MTX_NEAR(product, this->mtx_big, r<value_type>::value);
+}
+
 }  // namespace
@@ -190,6 +190,44 @@ TYPED_TEST(Lu, SymbolicLUWorksWithMissingDiagonal)
 }
 
 
+TYPED_TEST(Lu, SymbolicILUWorks)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    auto mtx = gko::initialize<matrix_type>(
+        {{1, 0, 0, 1}, {1, 0, 0, 0}, {0, 1, 1, 0}, {0, 0, 1, 1}}, this->ref);
+    auto expected0 = gko::initialize<matrix_type>(
+        {{1, 0, 0, 1}, {1, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 1, 1}}, this->ref);
+    auto expected1 = gko::initialize<matrix_type>(
+        {{1, 0, 0, 1}, {1, 1, 0, 1}, {0, 1, 1, 0}, {0, 0, 1, 1}}, this->ref);
+    auto expected2 = gko::initialize<matrix_type>(
+        {{1, 0, 0, 1}, {1, 1, 0, 1}, {0, 1, 1, 1}, {0, 0, 1, 1}}, this->ref);
+
+    std::unique_ptr<matrix_type> ilu0;
+    std::unique_ptr<matrix_type> ilu1;
+    std::unique_ptr<matrix_type> ilu2;
+    gko::factorization::symbolic_ilu(mtx.get(), 0, ilu0);
+    gko::factorization::symbolic_ilu(mtx.get(), 1, ilu1);
+    gko::factorization::symbolic_ilu(mtx.get(), 2, ilu2);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(ilu0, expected0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(ilu1, expected1);
+    GKO_ASSERT_MTX_EQ_SPARSITY(ilu2, expected2);
+}
+
+
+TYPED_TEST(Lu, SymbolicILUWithLargeFillLevelIsSymbolicLU)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        std::unique_ptr<gko::matrix::Csr<value_type, index_type>> lu;
+        gko::factorization::symbolic_ilu(this->mtx.get(), this->num_rows, lu);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(lu, this->mtx_lu);
+    });
+}
+
+
 TYPED_TEST(Lu, KernelInitializeWorks)
 {
     using value_type = typename TestFixture::value_type;
@@ -235,7 +273,7 @@ TYPED_TEST(Lu, KernelFactorizeWorks)
         gko::kernels::reference::lu_factorization::factorize(
             this->ref, this->storage_offsets.get_const_data(),
             this->row_descs.get_const_data(), this->storage.get_const_data(),
-            diag_idxs.get_const_data(), this->mtx_lu.get(), tmp);
+            diag_idxs.get_const_data(), this->mtx_lu.get(), false, tmp);
 
         GKO_ASSERT_MTX_NEAR(this->mtx_lu, mtx_lu_ref,
                             15 * r<value_type>::value);
@@ -319,3 +357,44 @@ TYPED_TEST(Lu, FactorizeWithKnownSparsityWorks)
         ASSERT_EQ(lu->get_diagonal(), nullptr);
     });
 }
+
+
+TYPED_TEST(Lu, RefactorizeWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        auto factory = gko::experimental::factorization::Lu<value_type,
+                                                            index_type>::build()
+                           .with_symmetric_sparsity(false)
+                           .on(this->ref);
+        auto scaled_mtx = gko::share(gko::clone(this->mtx));
+        scaled_mtx->scale(gko::initialize<gko::matrix::Dense<value_type>>(
+            {2.0}, this->ref));
+        auto lu = factory->generate(scaled_mtx);
+        auto combined = lu->get_combined();
+
+        lu->refactorize(this->mtx);
+
+        ASSERT_EQ(lu->get_combined(), combined);
+        GKO_ASSERT_MTX_EQ_SPARSITY(lu->get_combined(), this->mtx_lu);
+        GKO_ASSERT_MTX_NEAR(lu->get_combined(), this->mtx_lu,
+                            15 * r<value_type>::value);
+    });
+}
+
+
+TYPED_TEST(Lu, RefactorizeWithoutSymbolicDataFails)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using factorization_type =
+        gko::experimental::factorization::Factorization<value_type,
+                                                        index_type>;
+    this->setup(gko::matrices::location_ani1_mtx,
+                gko::matrices::location_ani1_lu_mtx);
+    auto lu =
+        factorization_type::create_from_combined_lu(gko::clone(this->mtx_lu));
+
+    ASSERT_THROW(lu->refactorize(this->mtx), gko::NotSupported);
+}
@@ -746,4 +746,23 @@ TYPED_TEST(ParIlu, GenerateForReverseCsrSmall)
 }
 
 
+
+TYPED_TEST(ParIlu, RefactorizeForDenseBig)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_big));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto factors = this->ilu_factory_skip->generate(scaled_mtx);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    factors->refactorize(this->mtx_big);
+
+    ASSERT_EQ(factors->get_l_factor(), l_factor);
+    ASSERT_EQ(factors->get_u_factor(), u_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, this->big_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->big_u_expected, r<value_type>::value);
+}
+
 }  // namespace
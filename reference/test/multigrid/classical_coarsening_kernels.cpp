@@ -0,0 +1,314 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/multigrid/classical_coarsening.hpp>
+
+
+#include <memory>
+#include <type_traits>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/multigrid/classical_coarsening_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class ClassicalCoarsening : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using MgLevel = gko::multigrid::ClassicalCoarsening<value_type, index_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+
+    ClassicalCoarsening()
+        : exec(gko::ReferenceExecutor::create()),
+          rs_factory(MgLevel::build().on(exec))
+    {}
+
+    std::shared_ptr<Mtx> create_laplacian_1d(index_type size)
+    {
+        mtx_data data{gko::dim<2>(size, size)};
+        for (index_type i = 0; i < size; i++) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, 2.0);
+            if (i < size - 1) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto mtx = gko::share(Mtx::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    std::shared_ptr<Mtx> create_laplacian_2d(index_type size)
+    {
+        mtx_data data{gko::dim<2>(size * size, size * size)};
+        for (index_type y = 0; y < size; y++) {
+            for (index_type x = 0; x < size; x++) {
+                const auto row = y * size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - size, -1.0);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (x < size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (y < size - 1) {
+                    data.nonzeros.emplace_back(row, row + size, -1.0);
+                }
+            }
+        }
+        auto mtx = gko::share(Mtx::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<typename MgLevel::Factory> rs_factory;
+};
+
+TYPED_TEST_SUITE(ClassicalCoarsening, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ClassicalCoarsening, ComputesStrongConnections)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = gko::initialize<Mtx>(
+        {{4.0, -1.0, -0.1}, {-1.0, 4.0, -1.0}, {-0.1, -1.0, 4.0}}, this->exec);
+    auto strength = Mtx::create(this->exec, mtx->get_size());
+
+    gko::kernels::reference::classical_coarsening::compute_strength(
+        this->exec, mtx.get(), 0.25, strength.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        strength, l({{0.0, -1.0, 0.0}, {-1.0, 0.0, -1.0}, {0.0, -1.0, 0.0}}),
+        0.0);
+    ASSERT_EQ(strength->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(ClassicalCoarsening, SelectsIndependentCoarsePoints)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = this->create_laplacian_1d(5);
+    auto strength = Mtx::create(this->exec, mtx->get_size());
+    gko::kernels::reference::classical_coarsening::compute_strength(
+        this->exec, mtx.get(), 0.25, strength.get());
+    auto strength_transposed = gko::as<Mtx>(strength->transpose());
+    gko::array<index_type> coarse_map(this->exec, 5);
+    index_type num_coarse{};
+
+    gko::kernels::reference::classical_coarsening::select_coarse_points(
+        this->exec, strength.get(), strength_transposed.get(), coarse_map,
+        &num_coarse);
+
+    ASSERT_EQ(num_coarse, 2);
+    GKO_ASSERT_ARRAY_EQ(coarse_map,
+                        gko::array<index_type>(this->exec, {-1, 0, -1, 1, -1}));
+}
+
+
+TYPED_TEST(ClassicalCoarsening, CoarsePointsCoverAllFinePoints)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    const index_type size = 10;
+    auto mtx = this->create_laplacian_2d(size);
+    const auto num_rows = size * size;
+    auto strength = Mtx::create(this->exec, mtx->get_size());
+    gko::kernels::reference::classical_coarsening::compute_strength(
+        this->exec, mtx.get(), 0.25, strength.get());
+    auto strength_transposed = gko::as<Mtx>(strength->transpose());
+    gko::array<index_type> coarse_map(this->exec, num_rows);
+    index_type num_coarse{};
+
+    gko::kernels::reference::classical_coarsening::select_coarse_points(
+        this->exec, strength.get(), strength_transposed.get(), coarse_map,
+        &num_coarse);
+
+    const auto map = coarse_map.get_const_data();
+    const auto row_ptrs = strength->get_const_row_ptrs();
+    const auto col_idxs = strength->get_const_col_idxs();
+    index_type next_coarse{};
+    for (index_type row = 0; row < num_rows; row++) {
+        bool has_coarse_neighbor = false;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            has_coarse_neighbor =
+                has_coarse_neighbor || map[col_idxs[nz]] >= 0;
+        }
+        if (map[row] >= 0) {
+            // coarse points are numbered consecutively and independent
+            ASSERT_EQ(map[row], next_coarse++);
+            ASSERT_FALSE(has_coarse_neighbor);
+        } else {
+            ASSERT_TRUE(has_coarse_neighbor);
+        }
+    }
+    ASSERT_EQ(num_coarse, next_coarse);
+}
+
+
+TYPED_TEST(ClassicalCoarsening, ComputesDirectInterpolation)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_1d(5);
+    auto strength = Mtx::create(this->exec, mtx->get_size());
+    gko::kernels::reference::classical_coarsening::compute_strength(
+        this->exec, mtx.get(), 0.25, strength.get());
+    gko::array<index_type> coarse_map(this->exec, {-1, 0, -1, 1, -1});
+    auto prolongator = Mtx::create(this->exec, gko::dim<2>{5, 2});
+
+    gko::kernels::reference::classical_coarsening::compute_interpolation(
+        this->exec, mtx.get(), strength.get(), coarse_map, prolongator.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        prolongator,
+        l({{0.5, 0.0}, {1.0, 0.0}, {0.5, 0.5}, {0.0, 1.0}, {0.0, 0.5}}),
+        r<value_type>::value);
+    ASSERT_EQ(prolongator->get_num_stored_elements(), 6);
+}
+
+
+TYPED_TEST(ClassicalCoarsening, GeneratesGalerkinCoarseMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_2d(6);
+
+    auto level = this->rs_factory->generate(mtx);
+
+    auto prolongator = gko::as<Mtx>(level->get_prolong_op());
+    auto restriction = gko::as<Mtx>(level->get_restrict_op());
+    auto coarse = gko::as<Mtx>(level->get_coarse_op());
+    const auto num_coarse = coarse->get_size()[0];
+    ASSERT_GT(num_coarse, 0);
+    ASSERT_LE(num_coarse, mtx->get_size()[0] / 2);
+    GKO_ASSERT_MTX_NEAR(restriction, gko::as<Mtx>(prolongator->transpose()),
+                        0.0);
+    auto ap = Mtx::create(this->exec, prolongator->get_size());
+    mtx->apply(prolongator, ap);
+    auto rap = Mtx::create(this->exec, coarse->get_size());
+    restriction->apply(ap, rap);
+    GKO_ASSERT_MTX_NEAR(coarse, rap, r<value_type>::value);
+}
+
+
+TYPED_TEST(ClassicalCoarsening, UpdateValuesKeepsTransferOperators)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_2d(6);
+    auto level = this->rs_factory->generate(mtx);
+    auto prolong_op = level->get_prolong_op();
+    auto restrict_op = level->get_restrict_op();
+    auto two = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(mtx));
+    scaled_mtx->scale(two);
+    auto scaled_coarse = gko::clone(gko::as<Mtx>(level->get_coarse_op()));
+    scaled_coarse->scale(two);
+
+    level->update_values(scaled_mtx);
+
+    ASSERT_EQ(level->get_system_matrix(), scaled_mtx);
+    ASSERT_EQ(level->get_prolong_op(), prolong_op);
+    ASSERT_EQ(level->get_restrict_op(), restrict_op);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(level->get_coarse_op()), scaled_coarse,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(ClassicalCoarsening, MultigridConverges)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    if (!std::is_same<index_type, gko::int32>::value) {
+        // the default smoother and coarsest solver use 32 bit indices
+        GTEST_SKIP();
+    }
+    auto mtx = this->create_laplacian_2d(16);
+    const auto num_rows = mtx->get_size()[0];
+    auto b = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+    x->fill(gko::zero<value_type>());
+    auto solver =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::share(std::move(this->rs_factory)))
+            .with_min_coarse_rows(4u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(15u).on(
+                    this->exec))
+            .on(this->exec)
+            ->generate(mtx);
+
+    solver->apply(b, x);
+
+    auto res = gko::clone(b);
+    mtx->apply(gko::initialize<Vec>({-1.0}, this->exec), x,
+               gko::initialize<Vec>({1.0}, this->exec), res);
+    auto res_norm = gko::matrix::Dense<gko::remove_complex<value_type>>::create(
+        this->exec, gko::dim<2>{1, 1});
+    res->compute_norm2(res_norm);
+    ASSERT_LT(res_norm->at(0, 0), 1e-3 * std::sqrt(num_rows));
+}
+
+
+}  // namespace
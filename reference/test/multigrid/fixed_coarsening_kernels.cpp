@@ -407,4 +407,28 @@ TYPED_TEST(FixedCoarsening, GenerateMgLevelOnUnsortedCooMatrix)
 }
 
 
+
+TYPED_TEST(FixedCoarsening, UpdateValuesKeepsTransferOperators)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    auto coarse_fine = this->fixed_coarsening_factory->generate(this->mtx);
+    auto prolong_op = coarse_fine->get_prolong_op();
+    auto restrict_op = coarse_fine->get_restrict_op();
+    auto two = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(two);
+    auto scaled_coarse = gko::clone(this->coarse);
+    scaled_coarse->scale(two);
+
+    coarse_fine->update_values(scaled_mtx);
+
+    ASSERT_EQ(coarse_fine->get_system_matrix(), scaled_mtx);
+    ASSERT_EQ(coarse_fine->get_prolong_op(), prolong_op);
+    ASSERT_EQ(coarse_fine->get_restrict_op(), restrict_op);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        scaled_coarse, r<value_type>::value);
+}
+
 }  // namespace
@@ -0,0 +1,158 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/galerkin_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Galerkin : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+
+    Galerkin()
+        : exec(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx(gko::initialize<Mtx>({{4.0, -1.0, 0.0, 0.0, -2.0},
+                                    {-1.0, 4.0, -1.0, 0.0, 0.0},
+                                    {0.0, -1.0, 4.0, -3.0, 0.0},
+                                    {0.0, 0.0, -1.0, 4.0, 0.0},
+                                    {-1.0, 0.0, 0.0, 0.0, 4.0}},
+                                   exec)),
+          prolongator(gko::initialize<Mtx>({{1.0, 0.0, 0.0},
+                                            {0.5, 0.5, 0.0},
+                                            {0.0, 1.0, 0.0},
+                                            {0.0, 0.0, 0.0},
+                                            {0.0, 0.0, 2.0}},
+                                           exec)),
+          restriction(gko::initialize<Mtx>({{1.0, 0.5, 0.0, 0.0, 0.0},
+                                            {0.0, 0.5, 1.0, 1.0, 0.0},
+                                            {0.0, 0.0, 0.0, 0.0, 0.0}},
+                                           exec))
+    // clang-format on
+    {}
+
+    std::unique_ptr<Mtx> compute_reference()
+    {
+        auto ap = Mtx::create(exec, prolongator->get_size());
+        mtx->apply(prolongator, ap);
+        auto rap = Mtx::create(exec, gko::dim<2>{3, 3});
+        restriction->apply(ap, rap);
+        return rap;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> prolongator;
+    std::unique_ptr<Mtx> restriction;
+};
+
+TYPED_TEST_SUITE(Galerkin, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Galerkin, ComputesRapSparsity)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{3, 3});
+
+    gko::kernels::reference::galerkin::compute_rap_symbolic(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(coarse, this->compute_reference());
+    ASSERT_TRUE(coarse->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(Galerkin, ComputesRap)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{3, 3});
+    gko::kernels::reference::galerkin::compute_rap_symbolic(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+
+    gko::kernels::reference::galerkin::compute_rap_numeric(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+
+    GKO_ASSERT_MTX_NEAR(coarse, this->compute_reference(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Galerkin, RecomputesRapWithNewValues)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{3, 3});
+    gko::kernels::reference::galerkin::compute_rap_symbolic(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+    gko::kernels::reference::galerkin::compute_rap_numeric(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+    this->mtx->scale(gko::initialize<gko::matrix::Dense<value_type>>(
+        {-2.0}, this->exec));
+    this->mtx->get_values()[0] = 1.0;
+
+    gko::kernels::reference::galerkin::compute_rap_numeric(
+        this->exec, this->restriction.get(), this->mtx.get(),
+        this->prolongator.get(), coarse.get());
+
+    GKO_ASSERT_MTX_NEAR(coarse, this->compute_reference(),
+                        r<value_type>::value);
+}
+
+
+}  // namespace
@@ -358,6 +358,25 @@ TYPED_TEST(Pgm, Renumber)
 }
 
 
+TYPED_TEST(Pgm, ComputeCoarseCsr)
+{
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    // 0-2-4, 1-3
+    auto agg_ptrs = gko::array<index_type>(this->exec, {0, 3, 5});
+    auto agg_rows = gko::array<index_type>(this->exec, {0, 2, 4, 1, 3});
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{2, 2});
+
+    gko::kernels::reference::pgm::compute_coarse_csr(
+        this->exec, this->mtx.get(), this->agg.get_const_data(),
+        agg_ptrs.get_const_data(), agg_rows.get_const_data(), coarse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(coarse, this->coarse);
+    GKO_ASSERT_MTX_NEAR(coarse, this->coarse, r<value_type>::value);
+}
+
+
 TYPED_TEST(Pgm, Generate)
 {
     auto coarse_fine = this->pgm_factory->generate(this->mtx);
@@ -576,4 +595,28 @@ TYPED_TEST(Pgm, GenerateMgLevelOnUnsortedMatrix)
 }
 
 
+
+TYPED_TEST(Pgm, UpdateValuesKeepsTransferOperators)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    auto coarse_fine = this->pgm_factory->generate(this->mtx);
+    auto prolong_op = coarse_fine->get_prolong_op();
+    auto restrict_op = coarse_fine->get_restrict_op();
+    auto two = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(two);
+    auto scaled_coarse = gko::clone(this->coarse);
+    scaled_coarse->scale(two);
+
+    coarse_fine->update_values(scaled_mtx);
+
+    ASSERT_EQ(coarse_fine->get_system_matrix(), scaled_mtx);
+    ASSERT_EQ(coarse_fine->get_prolong_op(), prolong_op);
+    ASSERT_EQ(coarse_fine->get_restrict_op(), restrict_op);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        scaled_coarse, r<value_type>::value);
+}
+
 }  // namespace
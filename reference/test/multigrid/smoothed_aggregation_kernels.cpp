@@ -0,0 +1,309 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/multigrid/smoothed_aggregation.hpp>
+
+
+#include <memory>
+#include <type_traits>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/multigrid/smoothed_aggregation_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SmoothedAggregation : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using MgLevel = gko::multigrid::SmoothedAggregation<value_type, index_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+
+    SmoothedAggregation()
+        : exec(gko::ReferenceExecutor::create()),
+          sa_factory(MgLevel::build().on(exec))
+    {}
+
+    std::shared_ptr<Mtx> create_laplacian_1d(index_type size)
+    {
+        mtx_data data{gko::dim<2>(size, size)};
+        for (index_type i = 0; i < size; i++) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, 2.0);
+            if (i < size - 1) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto mtx = gko::share(Mtx::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    std::shared_ptr<Mtx> create_laplacian_2d(index_type size)
+    {
+        mtx_data data{gko::dim<2>(size * size, size * size)};
+        for (index_type y = 0; y < size; y++) {
+            for (index_type x = 0; x < size; x++) {
+                const auto row = y * size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - size, -1.0);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (x < size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (y < size - 1) {
+                    data.nonzeros.emplace_back(row, row + size, -1.0);
+                }
+            }
+        }
+        auto mtx = gko::share(Mtx::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<typename MgLevel::Factory> sa_factory;
+};
+
+TYPED_TEST_SUITE(SmoothedAggregation, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SmoothedAggregation, FilterMatrixLumpsWeakConnections)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::initialize<Mtx>(
+        {{4.0, -1.0, -0.1}, {-1.0, 4.0, -1.0}, {-0.1, -1.0, 4.0}}, this->exec);
+    auto filtered = Mtx::create(this->exec, mtx->get_size());
+
+    gko::kernels::reference::smoothed_aggregation::filter_matrix(
+        this->exec, mtx.get(), 0.08, filtered.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        filtered,
+        l({{3.9, -1.0, 0.0}, {-1.0, 4.0, -1.0}, {0.0, -1.0, 3.9}}),
+        r<value_type>::value);
+    ASSERT_EQ(filtered->get_num_stored_elements(), 7);
+}
+
+
+TYPED_TEST(SmoothedAggregation, FilterMatrixAddsMissingDiagonal)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+    mtx->read({{2, 2}, {{0, 0, 2.0}, {0, 1, -1.0}, {1, 0, -1.0}}});
+    auto filtered = Mtx::create(this->exec, mtx->get_size());
+
+    gko::kernels::reference::smoothed_aggregation::filter_matrix(
+        this->exec, mtx.get(), 0.08, filtered.get());
+
+    GKO_ASSERT_MTX_NEAR(filtered, l({{2.0, -1.0}, {-1.0, 0.0}}), 0.0);
+    ASSERT_EQ(filtered->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(SmoothedAggregation, AggregatesDistanceTwoNeighborhood)
+{
+    using index_type = typename TestFixture::index_type;
+    auto mtx = this->create_laplacian_1d(3);
+    gko::array<index_type> agg(this->exec, 3);
+    index_type num_agg{};
+
+    gko::kernels::reference::smoothed_aggregation::aggregate(
+        this->exec, mtx.get(), agg, &num_agg);
+
+    ASSERT_EQ(num_agg, 1);
+    GKO_ASSERT_ARRAY_EQ(agg, gko::array<index_type>(this->exec, {0, 0, 0}));
+}
+
+
+TYPED_TEST(SmoothedAggregation, AggregatesAllRows)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type size = 10;
+    auto mtx = this->create_laplacian_2d(size);
+    const auto num_rows = size * size;
+    gko::array<index_type> agg(this->exec, num_rows);
+    index_type num_agg{};
+
+    gko::kernels::reference::smoothed_aggregation::aggregate(
+        this->exec, mtx.get(), agg, &num_agg);
+
+    // every aggregate contains at least its root and its direct neighbors
+    std::vector<index_type> agg_sizes(num_agg);
+    for (index_type row = 0; row < num_rows; row++) {
+        ASSERT_GE(agg.get_const_data()[row], 0);
+        ASSERT_LT(agg.get_const_data()[row], num_agg);
+        agg_sizes[agg.get_const_data()[row]]++;
+    }
+    for (auto agg_size : agg_sizes) {
+        ASSERT_GE(agg_size, 3);
+    }
+}
+
+
+TYPED_TEST(SmoothedAggregation, ComputesSmoothedProlongator)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_1d(4);
+    gko::array<index_type> agg(this->exec, {0, 0, 1, 1});
+    auto prolongator = Mtx::create(this->exec, gko::dim<2>{4, 2});
+
+    // the spectral radius estimate is 2, so omega = 2/3
+    gko::kernels::reference::smoothed_aggregation::compute_prolongator(
+        this->exec, mtx.get(), agg, 4.0 / 3.0, prolongator.get());
+
+    GKO_ASSERT_MTX_NEAR(prolongator,
+                        l({{2.0 / 3.0, 0.0},
+                           {2.0 / 3.0, 1.0 / 3.0},
+                           {1.0 / 3.0, 2.0 / 3.0},
+                           {0.0, 2.0 / 3.0}}),
+                        r<value_type>::value);
+    ASSERT_EQ(prolongator->get_num_stored_elements(), 6);
+}
+
+
+TYPED_TEST(SmoothedAggregation, GeneratesGalerkinCoarseMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_2d(6);
+
+    auto level = this->sa_factory->generate(mtx);
+
+    auto prolongator = gko::as<Mtx>(level->get_prolong_op());
+    auto restriction = gko::as<Mtx>(level->get_restrict_op());
+    auto coarse = gko::as<Mtx>(level->get_coarse_op());
+    const auto num_coarse = coarse->get_size()[0];
+    ASSERT_GT(num_coarse, 0);
+    ASSERT_LT(num_coarse, mtx->get_size()[0] / 3);
+    GKO_ASSERT_MTX_NEAR(restriction, gko::as<Mtx>(prolongator->transpose()),
+                        0.0);
+    auto ap = Mtx::create(this->exec, prolongator->get_size());
+    mtx->apply(prolongator, ap);
+    auto rap = Mtx::create(this->exec, coarse->get_size());
+    restriction->apply(ap, rap);
+    GKO_ASSERT_MTX_NEAR(coarse, rap, r<value_type>::value);
+}
+
+
+TYPED_TEST(SmoothedAggregation, UpdateValuesKeepsTransferOperators)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_laplacian_2d(6);
+    auto level = this->sa_factory->generate(mtx);
+    auto prolong_op = level->get_prolong_op();
+    auto restrict_op = level->get_restrict_op();
+    auto two = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(mtx));
+    scaled_mtx->scale(two);
+    auto scaled_coarse = gko::clone(gko::as<Mtx>(level->get_coarse_op()));
+    scaled_coarse->scale(two);
+
+    level->update_values(scaled_mtx);
+
+    ASSERT_EQ(level->get_system_matrix(), scaled_mtx);
+    ASSERT_EQ(level->get_prolong_op(), prolong_op);
+    ASSERT_EQ(level->get_restrict_op(), restrict_op);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(level->get_coarse_op()), scaled_coarse,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(SmoothedAggregation, MultigridConverges)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    if (!std::is_same<index_type, gko::int32>::value) {
+        // the default smoother and coarsest solver use 32 bit indices
+        GTEST_SKIP();
+    }
+    auto mtx = this->create_laplacian_2d(16);
+    const auto num_rows = mtx->get_size()[0];
+    auto b = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+    x->fill(gko::zero<value_type>());
+    auto solver =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::share(std::move(this->sa_factory)))
+            .with_min_coarse_rows(4u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(30u).on(
+                    this->exec))
+            .on(this->exec)
+            ->generate(mtx);
+
+    solver->apply(b, x);
+
+    auto res = gko::clone(b);
+    mtx->apply(gko::initialize<Vec>({-1.0}, this->exec), x,
+               gko::initialize<Vec>({1.0}, this->exec), res);
+    auto res_norm = gko::matrix::Dense<gko::remove_complex<value_type>>::create(
+        this->exec, gko::dim<2>{1, 1});
+    res->compute_norm2(res_norm);
+    ASSERT_LT(res_norm->at(0, 0), 1e-3 * std::sqrt(num_rows));
+}
+
+
+}  // namespace
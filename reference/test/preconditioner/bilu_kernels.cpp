@@ -0,0 +1,214 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/bilu.hpp>
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/factorization/ilu.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/preconditioner/ilu.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+#include "core/preconditioner/bilu_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Bilu : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+    using bilu_type = gko::preconditioner::Bilu<value_type, index_type>;
+
+    Bilu()
+        : exec{gko::ReferenceExecutor::create()},
+          // block tridiagonal, so BILU(0) is exact
+          mtx{Fbcsr::create(exec, 2)},
+          // has fill-in outside of the sparsity pattern
+          scalar_mtx{Fbcsr::create(exec, 1)},
+          b{gko::initialize<Dense>({I<value_type>{1.0, 2.0},
+                                    I<value_type>{-2.0, 0.0},
+                                    I<value_type>{3.0, 1.0},
+                                    I<value_type>{0.5, -1.0},
+                                    I<value_type>{1.0, 0.0},
+                                    I<value_type>{-1.0, 2.0}},
+                                   exec)},
+          x{Dense::create(exec, gko::dim<2>{6, 2})},
+          factory{bilu_type::build().on(exec)}
+    {
+        mtx->read(mtx_data{{4.0, 1.0, 1.0, 0.0, 0.0, 0.0},
+                           {1.0, 5.0, 0.0, 1.0, 0.0, 0.0},
+                           {1.0, 0.0, 4.0, 1.0, 1.0, 0.0},
+                           {0.0, 1.0, 2.0, 5.0, 0.0, 1.0},
+                           {0.0, 0.0, 1.0, 0.0, 4.0, 1.0},
+                           {0.0, 0.0, 0.0, 1.0, 1.0, 5.0}});
+        scalar_mtx->read(mtx_data{{4.0, 1.0, 0.0, 0.0, 1.0, 0.0},
+                                  {1.0, 5.0, 1.0, 0.0, 0.0, 2.0},
+                                  {0.0, 2.0, 4.0, 1.0, 0.0, 0.0},
+                                  {1.0, 0.0, 1.0, 5.0, 1.0, 0.0},
+                                  {1.0, 0.0, 0.0, 2.0, 4.0, 1.0},
+                                  {0.0, 1.0, 0.0, 0.0, 1.0, 5.0}});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Fbcsr> mtx;
+    std::shared_ptr<Fbcsr> scalar_mtx;
+    std::shared_ptr<Dense> b;
+    std::shared_ptr<Dense> x;
+    std::unique_ptr<typename bilu_type::Factory> factory;
+};
+
+TYPED_TEST_SUITE(Bilu, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Bilu, KernelFactorizeFindsDiagonalBlocks)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factors = gko::clone(this->mtx);
+    gko::array<index_type> diag_idxs{this->exec, 3};
+
+    gko::kernels::reference::bilu::factorize(this->exec, factors.get(),
+                                             diag_idxs.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(diag_idxs, I<index_type>({0, 3, 6}));
+}
+
+
+TYPED_TEST(Bilu, ApplyIsExactForBlockTridiagonalMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    auto bilu = this->factory->generate(this->mtx);
+    auto result = Dense::create(this->exec, gko::dim<2>{6, 2});
+
+    bilu->apply(this->b, this->x);
+    this->mtx->apply(this->x, result);
+
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(Bilu, ApplyWithBlockSizeOneIsIlu)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Dense = typename TestFixture::Dense;
+    using ilu_type = gko::preconditioner::Ilu<
+        gko::solver::LowerTrs<value_type, index_type>,
+        gko::solver::UpperTrs<value_type, index_type>, false, index_type>;
+    auto csr_mtx = gko::share(
+        gko::matrix::Csr<value_type, index_type>::create(this->exec));
+    this->scalar_mtx->convert_to(csr_mtx);
+    auto ilu = ilu_type::build()
+                   .with_factorization_factory(
+                       gko::factorization::Ilu<value_type, index_type>::build()
+                           .on(this->exec))
+                   .on(this->exec)
+                   ->generate(csr_mtx);
+    auto bilu = this->factory->generate(this->scalar_mtx);
+    auto expected = Dense::create(this->exec, gko::dim<2>{6, 2});
+
+    ilu->apply(this->b, expected);
+    bilu->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, expected, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(Bilu, AdvancedApplyIsEquivalentToApply)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    auto bilu = this->factory->generate(this->mtx);
+    auto alpha = gko::initialize<Dense>({2.0}, this->exec);
+    auto beta = gko::initialize<Dense>({-1.0}, this->exec);
+    auto result = gko::clone(this->b);
+    auto expected = gko::clone(this->b);
+
+    bilu->apply(this->b, this->x);
+    expected->scale(beta);
+    expected->add_scaled(alpha, this->x);
+    bilu->apply(alpha, this->b, beta, result);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(Bilu, SortsUnsortedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    auto unsorted = gko::clone(this->mtx);
+    // swap the first two blocks of the second block row
+    const auto block_nnz = 4;
+    std::swap(unsorted->get_col_idxs()[2], unsorted->get_col_idxs()[3]);
+    std::swap_ranges(unsorted->get_values() + 2 * block_nnz,
+                     unsorted->get_values() + 3 * block_nnz,
+                     unsorted->get_values() + 3 * block_nnz);
+    auto expected = this->factory->generate(this->mtx);
+
+    auto bilu = this->factory->generate(gko::share(std::move(unsorted)));
+
+    GKO_ASSERT_MTX_NEAR(bilu->get_factors(), expected->get_factors(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Bilu, ThrowsOnNonFbcsrMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+
+    ASSERT_THROW(this->factory->generate(gko::share(Dense::create(
+                     this->exec, gko::dim<2>{6, 6}))),
+                 gko::NotSupported);
+}
+
+
+}  // namespace
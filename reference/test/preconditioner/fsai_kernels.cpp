@@ -0,0 +1,273 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/fsai.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/preconditioner/fsai_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Fsai : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+    using fsai_type = gko::preconditioner::Fsai<value_type, index_type>;
+
+    Fsai()
+        : exec{gko::ReferenceExecutor::create()},
+          mtx{Csr::create(exec)},
+          b{Dense::create(exec, gko::dim<2>{16, 2})},
+          x{Dense::create(exec, gko::dim<2>{16, 2})}
+    {
+        // 2D Laplacian on a 4x4 grid
+        mtx_data data{gko::dim<2>{16, 16}};
+        for (index_type y = 0; y < 4; ++y) {
+            for (index_type x = 0; x < 4; ++x) {
+                const auto row = y * 4 + x;
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                if (x < 3) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - 4, -1.0);
+                }
+                if (y < 3) {
+                    data.nonzeros.emplace_back(row, row + 4, -1.0);
+                }
+            }
+        }
+        data.ensure_row_major_order();
+        mtx->read(data);
+        for (gko::size_type i = 0; i < 16; ++i) {
+            b->at(i, 0) = static_cast<value_type>(static_cast<double>(i % 5));
+            b->at(i, 0) -= 2.0;
+            b->at(i, 1) = 1.0;
+        }
+    }
+
+    // computes G A G^H as a dense matrix
+    std::unique_ptr<Dense> preconditioned_matrix(const fsai_type* fsai)
+    {
+        auto ga = Dense::create(exec, mtx->get_size());
+        auto result = Dense::create(exec, mtx->get_size());
+        auto dense_mtx = Dense::create(exec);
+        mtx->convert_to(dense_mtx);
+        fsai->get_lower_factor()->apply(dense_mtx, ga);
+        auto upper = Dense::create(exec);
+        fsai->get_upper_factor()->convert_to(upper);
+        ga->apply(upper, result);
+        return result;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Dense> b;
+    std::shared_ptr<Dense> x;
+};
+
+TYPED_TEST_SUITE(Fsai, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Fsai, KernelGenerateWithoutStepsIsScaledDiagonal)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto factor = Csr::create(this->exec, this->mtx->get_size());
+
+    gko::kernels::reference::fsai::generate(this->exec, this->mtx.get(), 0u,
+                                            2u, 0.0, factor.get());
+
+    ASSERT_EQ(factor->get_num_stored_elements(), 16);
+    for (int row = 0; row < 16; ++row) {
+        ASSERT_EQ(factor->get_const_row_ptrs()[row], row);
+        ASSERT_EQ(factor->get_const_col_idxs()[row], row);
+        ASSERT_EQ(factor->get_const_values()[row], value_type{0.5});
+    }
+}
+
+
+TYPED_TEST(Fsai, KernelGenerateRespectsRowBudget)
+{
+    using Csr = typename TestFixture::Csr;
+    auto factor = Csr::create(this->exec, this->mtx->get_size());
+
+    gko::kernels::reference::fsai::generate(this->exec, this->mtx.get(), 2u,
+                                            1u, 0.0, factor.get());
+
+    ASSERT_TRUE(factor->is_sorted_by_column_index());
+    const auto row_ptrs = factor->get_const_row_ptrs();
+    const auto col_idxs = factor->get_const_col_idxs();
+    for (int row = 0; row < 16; ++row) {
+        ASSERT_LE(row_ptrs[row + 1] - row_ptrs[row], 3);
+        ASSERT_EQ(col_idxs[row_ptrs[row + 1] - 1], row);
+    }
+    // the first row has no candidates, all others grow by two entries
+    ASSERT_EQ(factor->get_num_stored_elements(), 1 + 2 + 14 * 3);
+}
+
+
+TYPED_TEST(Fsai, GenerateScalesToUnitDiagonal)
+{
+    using value_type = typename TestFixture::value_type;
+    using fsai_type = typename TestFixture::fsai_type;
+    auto fsai = fsai_type::build()
+                    .with_steps(2u)
+                    .with_step_size(2u)
+                    .on(this->exec)
+                    ->generate(this->mtx);
+
+    auto result = this->preconditioned_matrix(fsai.get());
+
+    for (gko::size_type row = 0; row < 16; ++row) {
+        ASSERT_NEAR(gko::real(result->at(row, row)), 1.0,
+                    r<value_type>::value * 10);
+        ASSERT_NEAR(gko::imag(result->at(row, row)), 0.0,
+                    r<value_type>::value * 10);
+    }
+}
+
+
+TYPED_TEST(Fsai, GenerateStopsAtTolerance)
+{
+    using fsai_type = typename TestFixture::fsai_type;
+    // adding any entry reduces the Kaporin number of a row only by 1/16
+    auto fsai = fsai_type::build()
+                    .with_tolerance(0.1)
+                    .on(this->exec)
+                    ->generate(this->mtx);
+
+    ASSERT_EQ(fsai->get_lower_factor()->get_num_stored_elements(), 16);
+}
+
+
+TYPED_TEST(Fsai, AdaptationImprovesPreconditioner)
+{
+    using value_type = typename TestFixture::value_type;
+    using fsai_type = typename TestFixture::fsai_type;
+    auto coarse_fsai =
+        fsai_type::build().with_steps(1u).on(this->exec)->generate(this->mtx);
+    auto fine_fsai =
+        fsai_type::build().with_steps(4u).on(this->exec)->generate(this->mtx);
+    auto deviation = [&](const fsai_type* fsai) {
+        auto result = this->preconditioned_matrix(fsai);
+        gko::remove_complex<value_type> norm{};
+        for (gko::size_type row = 0; row < 16; ++row) {
+            for (gko::size_type col = 0; col < 16; ++col) {
+                const auto expected = row == col ? gko::one<value_type>()
+                                                 : gko::zero<value_type>();
+                norm += gko::squared_norm(result->at(row, col) - expected);
+            }
+        }
+        return norm;
+    };
+
+    ASSERT_LT(deviation(fine_fsai.get()), deviation(coarse_fsai.get()));
+}
+
+
+TYPED_TEST(Fsai, ApplyIsExactWithFullPattern)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    using fsai_type = typename TestFixture::fsai_type;
+    // no limit on the row size, so G^H G = A^-1
+    auto fsai = fsai_type::build()
+                    .with_steps(16u)
+                    .with_step_size(16u)
+                    .with_tolerance(0.0)
+                    .on(this->exec)
+                    ->generate(this->mtx);
+    auto result = Dense::create(this->exec, this->b->get_size());
+
+    fsai->apply(this->b, this->x);
+    this->mtx->apply(this->x, result);
+
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value * 100);
+}
+
+
+TYPED_TEST(Fsai, AdvancedApplyIsExactWithFullPattern)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    using fsai_type = typename TestFixture::fsai_type;
+    auto fsai = fsai_type::build()
+                    .with_steps(16u)
+                    .with_step_size(16u)
+                    .with_tolerance(0.0)
+                    .on(this->exec)
+                    ->generate(this->mtx);
+    auto alpha = gko::initialize<Dense>({2.0}, this->exec);
+    auto beta = gko::initialize<Dense>({-1.0}, this->exec);
+    auto one = gko::initialize<Dense>({1.0}, this->exec);
+    auto result = Dense::create(this->exec, this->b->get_size());
+    this->x->fill(1.0);
+
+    fsai->apply(alpha, this->b, beta, this->x);
+    // A x = 2 b - A 1
+    this->mtx->apply(this->x, result);
+    auto ones = Dense::create(this->exec, this->b->get_size());
+    ones->fill(1.0);
+    auto expected = gko::clone(this->b);
+    expected->scale(alpha);
+    this->mtx->apply(beta, ones, one, expected);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, r<value_type>::value * 100);
+}
+
+
+}  // namespace
@@ -425,4 +425,32 @@ TYPED_TEST(Ic, SolvesMultipleRhs)
 }
 
 
+
+TYPED_TEST(Ic, SolvesSingleRhsAfterRefactorize)
+{
+    using ic_prec_type = typename TestFixture::ic_prec_type;
+    using Vec = typename TestFixture::Vec;
+    const auto b = gko::initialize<Vec>({1.0, 3.0, 6.0}, this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(gko::initialize<Vec>({4.0}, this->exec));
+    auto preconditioner =
+        ic_prec_type::build().on(this->exec)->generate(scaled_mtx);
+    auto l_solver = preconditioner->get_l_solver();
+
+    preconditioner->refactorize(this->mtx);
+    preconditioner->apply(b, x);
+
+    ASSERT_EQ(preconditioner->get_l_solver(), l_solver);
+    GKO_ASSERT_MTX_NEAR(x, l({3.0, -2.0, 4.0}), this->tol);
+}
+
+
+TYPED_TEST(Ic, RefactorizeThrowsForComposition)
+{
+    auto preconditioner = this->ic_pre_factory->generate(this->l_composition);
+
+    ASSERT_THROW(preconditioner->refactorize(this->mtx), gko::NotSupported);
+}
+
 }  // namespace
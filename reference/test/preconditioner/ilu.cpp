@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/factorization/par_ilu.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
@@ -658,4 +659,56 @@ TEST_F(DefaultIlu, CanBeUsedAsGeneratedPreconditioner)
 }
 
 
+
+TYPED_TEST(Ilu, SolvesSingleRhsAfterRefactorize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using trs_ilu_prec_type =
+        gko::preconditioner::Ilu<gko::solver::LowerTrs<value_type>,
+                                 gko::solver::UpperTrs<value_type>>;
+    const auto b = gko::initialize<Mtx>({1.0, 3.0, 6.0}, this->exec);
+    auto x = Mtx::create(this->exec, gko::dim<2>{3, 1});
+    x->copy_from(b);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(gko::initialize<Mtx>({2.0}, this->exec));
+    auto preconditioner =
+        trs_ilu_prec_type::build().on(this->exec)->generate(scaled_mtx);
+    auto l_solver = preconditioner->get_l_solver();
+    auto u_solver = preconditioner->get_u_solver();
+
+    preconditioner->refactorize(this->mtx);
+    preconditioner->apply(b, x);
+
+    ASSERT_EQ(preconditioner->get_l_solver(), l_solver);
+    ASSERT_EQ(preconditioner->get_u_solver(), u_solver);
+    GKO_ASSERT_MTX_NEAR(x, l({-0.125, 0.25, 1.0}), r<TypeParam>::value * 1e+1);
+}
+
+
+TYPED_TEST(Ilu, SolvesSingleRhsWithCustomSolversAfterRefactorize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    const auto b = gko::initialize<Mtx>({1.0, 3.0, 6.0}, this->exec);
+    auto x = Mtx::create(this->exec, gko::dim<2>{3, 1});
+    x->copy_from(b);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(gko::initialize<Mtx>({2.0}, this->exec));
+    auto preconditioner = this->ilu_pre_factory->generate(scaled_mtx);
+
+    preconditioner->refactorize(this->mtx);
+    preconditioner->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-0.125, 0.25, 1.0}), r<TypeParam>::value * 1e+1);
+}
+
+
+TYPED_TEST(Ilu, RefactorizeThrowsForComposition)
+{
+    auto preconditioner =
+        this->ilu_pre_factory->generate(this->l_u_composition);
+
+    ASSERT_THROW(preconditioner->refactorize(this->mtx), gko::NotSupported);
+}
+
 }  // namespace
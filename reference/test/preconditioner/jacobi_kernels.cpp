@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
 
 
 #include "core/base/extended_float.hpp"
@@ -187,6 +188,36 @@ TYPED_TEST(Jacobi, FindsNaturalBlocks)
 }
 
 
+TYPED_TEST(Jacobi, UsesFixedBlocksOfFbcsr)
+{
+    using Bj = typename TestFixture::Bj;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+    // the autodetection would merge all rows into a single block
+    auto mtx = gko::share(Fbcsr::create(this->exec, 2));
+    mtx->read(gko::matrix_data<value_type, index_type>{{4.0, 1.0, 1.0, 1.0},
+                                                      {1.0, 4.0, 1.0, 1.0},
+                                                      {1.0, 1.0, 4.0, 1.0},
+                                                      {1.0, 1.0, 1.0, 4.0}});
+    auto expected = gko::initialize<gko::matrix::Dense<value_type>>(
+        {{4.0 / 15, -1.0 / 15, 0.0, 0.0},
+         {-1.0 / 15, 4.0 / 15, 0.0, 0.0},
+         {0.0, 0.0, 4.0 / 15, -1.0 / 15},
+         {0.0, 0.0, -1.0 / 15, 4.0 / 15}},
+        this->exec);
+
+    auto bj = Bj::build().with_max_block_size(4u).on(this->exec)->generate(mtx);
+
+    ASSERT_EQ(bj->get_num_blocks(), 2);
+    auto ptrs = bj->get_parameters().block_pointers.get_const_data();
+    EXPECT_EQ(ptrs[0], 0);
+    EXPECT_EQ(ptrs[1], 2);
+    EXPECT_EQ(ptrs[2], 4);
+    GKO_ASSERT_MTX_NEAR(bj, expected, r<value_type>::value);
+}
+
+
 TYPED_TEST(Jacobi, ExecutesSupervariableAgglomeration)
 {
     /* example matrix:
@@ -0,0 +1,332 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/preconditioner/sor.hpp>
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/gauss_seidel.hpp>
+#include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/preconditioner/sor_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Sor : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using real_type = gko::remove_complex<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using sor_type = gko::preconditioner::Sor<value_type, index_type>;
+    using gs_type = gko::preconditioner::GaussSeidel<value_type, index_type>;
+    using l_solver_type = gko::solver::LowerTrs<value_type, index_type>;
+    using u_solver_type = gko::solver::UpperTrs<value_type, index_type>;
+
+    Sor()
+        : exec{gko::ReferenceExecutor::create()},
+          mtx{gko::initialize<Csr>(
+              {{2.0, -1.0, 0.5}, {-1.0, 4.0, 1.0}, {0.5, 2.0, 3.0}}, exec)},
+          l_mtx{gko::initialize<Csr>(
+              {{2.0 / 1.5, 0.0, 0.0}, {-1.0, 4.0 / 1.5, 0.0}, {0.5, 2.0, 2.0}},
+              exec)},
+          // the upper factor is scaled by 1 / (2 - w) * (D / w)^-1
+          u_mtx{gko::initialize<Csr>(
+              {{2.0, -1.5, 0.75}, {0.0, 2.0, 0.75}, {0.0, 0.0, 2.0}}, exec)},
+          b{gko::initialize<Dense>({1.0, -2.0, 3.0}, exec)}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> l_mtx;
+    std::shared_ptr<Csr> u_mtx;
+    std::shared_ptr<Dense> b;
+};
+
+TYPED_TEST_SUITE(Sor, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Sor, CanInitializeWeightedL)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto result = Csr::create(this->exec, gko::dim<2>{3, 3}, 6);
+    this->exec->copy_from(this->exec.get(), 4,
+                          this->l_mtx->get_const_row_ptrs(),
+                          result->get_row_ptrs());
+
+    gko::kernels::reference::sor::initialize_weighted_l(
+        this->exec, this->mtx.get(), 1.5, result.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->l_mtx);
+    GKO_ASSERT_MTX_NEAR(result, this->l_mtx, r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, CanInitializeWeightedLAndU)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto l_result = Csr::create(this->exec, gko::dim<2>{3, 3}, 6);
+    auto u_result = Csr::create(this->exec, gko::dim<2>{3, 3}, 6);
+    this->exec->copy_from(this->exec.get(), 4,
+                          this->l_mtx->get_const_row_ptrs(),
+                          l_result->get_row_ptrs());
+    this->exec->copy_from(this->exec.get(), 4,
+                          this->u_mtx->get_const_row_ptrs(),
+                          u_result->get_row_ptrs());
+
+    gko::kernels::reference::sor::initialize_weighted_l_u(
+        this->exec, this->mtx.get(), 1.5, l_result.get(), u_result.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_result, this->l_mtx);
+    GKO_ASSERT_MTX_EQ_SPARSITY(u_result, this->u_mtx);
+    GKO_ASSERT_MTX_NEAR(l_result, this->l_mtx, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_result, this->u_mtx, r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, InitializeWeightedLAndUUsesOneForMissingDiagonal)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Csr::create(this->exec);
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        gko::dim<2>{2, 2}, {{0, 1, 2.0}, {1, 0, 1.0}, {1, 1, 4.0}}});
+    auto l_result = Csr::create(this->exec, gko::dim<2>{2, 2}, 3);
+    auto u_result = Csr::create(this->exec, gko::dim<2>{2, 2}, 3);
+    const index_type l_row_ptrs[] = {0, 1, 3};
+    const index_type u_row_ptrs[] = {0, 2, 3};
+    std::copy_n(l_row_ptrs, 3, l_result->get_row_ptrs());
+    std::copy_n(u_row_ptrs, 3, u_result->get_row_ptrs());
+
+    gko::kernels::reference::sor::initialize_weighted_l_u(
+        this->exec, mtx.get(), 1.5, l_result.get(), u_result.get());
+
+    GKO_ASSERT_MTX_NEAR(l_result, l({{1.0 / 1.5, 0.0}, {1.0, 4.0 / 1.5}}),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_result, l({{2.0, 6.0}, {0.0, 2.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, GeneratesLowerFactor)
+{
+    using sor_type = typename TestFixture::sor_type;
+    using l_solver_type = typename TestFixture::l_solver_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto sor = sor_type::build()
+                   .with_relaxation_factor(1.5)
+                   .on(this->exec)
+                   ->generate(this->mtx);
+
+    ASSERT_EQ(sor->get_operators().size(), 1);
+    auto l_solver = gko::as<l_solver_type>(sor->get_operators()[0]);
+    GKO_ASSERT_MTX_NEAR(l_solver->get_system_matrix(), this->l_mtx,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, GeneratesLowerAndUpperFactorForSymmetric)
+{
+    using sor_type = typename TestFixture::sor_type;
+    using l_solver_type = typename TestFixture::l_solver_type;
+    using u_solver_type = typename TestFixture::u_solver_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto sor = sor_type::build()
+                   .with_symmetric(true)
+                   .with_relaxation_factor(1.5)
+                   .on(this->exec)
+                   ->generate(this->mtx);
+
+    ASSERT_EQ(sor->get_operators().size(), 2);
+    auto u_solver = gko::as<u_solver_type>(sor->get_operators()[0]);
+    auto l_solver = gko::as<l_solver_type>(sor->get_operators()[1]);
+    GKO_ASSERT_MTX_NEAR(l_solver->get_system_matrix(), this->l_mtx,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_solver->get_system_matrix(), this->u_mtx,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, GeneratesFromUnsortedMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    using sor_type = typename TestFixture::sor_type;
+    using l_solver_type = typename TestFixture::l_solver_type;
+    using value_type = typename TestFixture::value_type;
+    auto unsorted = gko::clone(this->exec, this->mtx);
+    // swap the first two entries of the last row
+    std::swap(unsorted->get_col_idxs()[6], unsorted->get_col_idxs()[7]);
+    std::swap(unsorted->get_values()[6], unsorted->get_values()[7]);
+
+    auto sor = sor_type::build()
+                   .with_relaxation_factor(1.5)
+                   .on(this->exec)
+                   ->generate(gko::share(std::move(unsorted)));
+
+    auto l_solver = gko::as<l_solver_type>(sor->get_operators()[0]);
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_solver->get_system_matrix(), this->l_mtx);
+    GKO_ASSERT_MTX_NEAR(l_solver->get_system_matrix(), this->l_mtx,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, AppliesSymmetricSor)
+{
+    using Dense = typename TestFixture::Dense;
+    using sor_type = typename TestFixture::sor_type;
+    using value_type = typename TestFixture::value_type;
+    auto sor = sor_type::build()
+                   .with_symmetric(true)
+                   .with_relaxation_factor(1.5)
+                   .on(this->exec)
+                   ->generate(this->mtx);
+    auto x = Dense::create(this->exec, gko::dim<2>{3, 1});
+    auto tmp = x->clone();
+    auto result = x->clone();
+
+    sor->apply(this->b, x);
+
+    // M = L * U, so M * x needs to reproduce b
+    this->u_mtx->apply(x, tmp);
+    this->l_mtx->apply(tmp, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Sor, GaussSeidelGeneratesUnweightedLowerFactor)
+{
+    using Csr = typename TestFixture::Csr;
+    using gs_type = typename TestFixture::gs_type;
+    using l_solver_type = typename TestFixture::l_solver_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto gs = gs_type::build().on(this->exec)->generate(this->mtx);
+
+    ASSERT_EQ(gs->get_operators().size(), 1);
+    auto l_solver = gko::as<l_solver_type>(gs->get_operators()[0]);
+    GKO_ASSERT_MTX_NEAR(
+        l_solver->get_system_matrix(),
+        l({{2.0, 0.0, 0.0}, {-1.0, 4.0, 0.0}, {0.5, 2.0, 3.0}}), 0.0);
+}
+
+
+TYPED_TEST(Sor, SymmetricGaussSeidelGeneratesScaledUpperFactor)
+{
+    using gs_type = typename TestFixture::gs_type;
+    using u_solver_type = typename TestFixture::u_solver_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto gs = gs_type::build().with_symmetric(true).on(this->exec)->generate(
+        this->mtx);
+
+    ASSERT_EQ(gs->get_operators().size(), 2);
+    auto u_solver = gko::as<u_solver_type>(gs->get_operators()[0]);
+    GKO_ASSERT_MTX_NEAR(
+        u_solver->get_system_matrix(),
+        l({{1.0, -0.5, 0.25}, {0.0, 1.0, 0.25}, {0.0, 0.0, 1.0}}), 0.0);
+}
+
+
+TYPED_TEST(Sor, SolvesLaplacianAsSmoother)
+{
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    using sor_type = typename TestFixture::sor_type;
+    const index_type size = 20;
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+    for (index_type i = 0; i < size; i++) {
+        if (i > 0) {
+            data.nonzeros.emplace_back(i, i - 1, -1.0);
+        }
+        data.nonzeros.emplace_back(i, i, 2.0);
+        if (i < size - 1) {
+            data.nonzeros.emplace_back(i, i + 1, -1.0);
+        }
+    }
+    auto mtx = gko::share(Csr::create(this->exec));
+    mtx->read(data);
+    auto solver =
+        gko::solver::build_smoother(gko::share(sor_type::build()
+                                                   .with_symmetric(true)
+                                                   .with_relaxation_factor(1.5)
+                                                   .on(this->exec)),
+                                    2000u, gko::one<value_type>())
+            ->generate(mtx);
+    auto b = Dense::create(this->exec, gko::dim<2>(size, 1));
+    b->fill(gko::one<value_type>());
+    auto x = Dense::create(this->exec, gko::dim<2>(size, 1));
+    x->fill(gko::zero<value_type>());
+    auto res = b->clone();
+    auto one = gko::initialize<Dense>({1.0}, this->exec);
+    auto neg_one = gko::initialize<Dense>({-1.0}, this->exec);
+
+    solver->apply(b, x);
+
+    mtx->apply(neg_one, x, one, res);
+    auto res_norm = gko::matrix::Dense<gko::remove_complex<value_type>>::create(
+        this->exec, gko::dim<2>{1, 1});
+    auto b_norm = res_norm->clone();
+    res->compute_norm2(res_norm);
+    b->compute_norm2(b_norm);
+    ASSERT_LE(res_norm->at(0, 0),
+              r<value_type>::value * 1e3 * b_norm->at(0, 0));
+}
+
+
+}  // namespace
@@ -0,0 +1,267 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/amd.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Amd : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type =
+        gko::experimental::reorder::Amd<value_type, index_type>;
+    using perm_type = gko::matrix::Permutation<index_type>;
+    using lu_type =
+        gko::experimental::factorization::Lu<value_type, index_type>;
+
+    Amd() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::unique_ptr<matrix_type> read_mtx(const char* filename)
+    {
+        std::ifstream stream{filename};
+        return gko::read<matrix_type>(stream, exec);
+    }
+
+    // the matrix with a full first row and column and a diagonal otherwise
+    std::shared_ptr<matrix_type> create_arrow_mtx(index_type size,
+                                                  bool symmetric = true)
+    {
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size)};
+        for (index_type i = 0; i < size; i++) {
+            data.nonzeros.emplace_back(i, i, 4);
+            if (i > 0) {
+                data.nonzeros.emplace_back(0, i, -1);
+                if (symmetric) {
+                    data.nonzeros.emplace_back(i, 0, -1);
+                }
+            }
+        }
+        data.ensure_row_major_order();
+        auto mtx = gko::share(matrix_type::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    // 5-point stencil on a size x size grid
+    std::shared_ptr<matrix_type> create_grid_mtx(index_type size)
+    {
+        const auto num_rows = size * size;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(num_rows)};
+        for (index_type y = 0; y < size; y++) {
+            for (index_type x = 0; x < size; x++) {
+                const auto row = y * size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - size, -1);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1);
+                }
+                data.nonzeros.emplace_back(row, row, 4);
+                if (x < size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1);
+                }
+                if (y < size - 1) {
+                    data.nonzeros.emplace_back(row, row + size, -1);
+                }
+            }
+        }
+        auto mtx = gko::share(matrix_type::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    void assert_is_permutation(const perm_type* perm)
+    {
+        const auto size = perm->get_permutation_size();
+        std::vector<index_type> sorted(perm->get_const_permutation(),
+                                       perm->get_const_permutation() + size);
+        std::sort(sorted.begin(), sorted.end());
+        for (gko::size_type i = 0; i < size; i++) {
+            ASSERT_EQ(sorted[i], i);
+        }
+    }
+
+    std::shared_ptr<matrix_type> permute(std::shared_ptr<matrix_type> mtx,
+                                         const perm_type* perm)
+    {
+        auto perm_array =
+            gko::make_const_array_view(exec, perm->get_permutation_size(),
+                                       perm->get_const_permutation())
+                .copy_to_array();
+        return gko::as<matrix_type>(mtx->permute(&perm_array));
+    }
+
+    gko::size_type factor_nnz(std::shared_ptr<const matrix_type> mtx)
+    {
+        return lu_type::build()
+            .with_symmetric_sparsity(true)
+            .on(exec)
+            ->generate(mtx)
+            ->get_combined()
+            ->get_num_stored_elements();
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+};
+
+TYPED_TEST_SUITE(Amd, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Amd, OrdersArrowHubLate)
+{
+    auto mtx = this->create_arrow_mtx(10);
+
+    auto perm =
+        TestFixture::reorder_type::build().on(this->exec)->generate(mtx);
+
+    this->assert_is_permutation(perm.get());
+    // once only one leaf is left, hub and leaf are interchangeable
+    auto hub_pos = std::find(perm->get_const_permutation(),
+                             perm->get_const_permutation() + 10, 0) -
+                   perm->get_const_permutation();
+    ASSERT_GE(hub_pos, 8);
+}
+
+
+TYPED_TEST(Amd, SymmetrizesPattern)
+{
+    auto mtx = this->create_arrow_mtx(10, false);
+
+    auto perm =
+        TestFixture::reorder_type::build().on(this->exec)->generate(mtx);
+
+    this->assert_is_permutation(perm.get());
+    // once only one leaf is left, hub and leaf are interchangeable
+    auto hub_pos = std::find(perm->get_const_permutation(),
+                             perm->get_const_permutation() + 10, 0) -
+                   perm->get_const_permutation();
+    ASSERT_GE(hub_pos, 8);
+}
+
+
+TYPED_TEST(Amd, OrdersDenseRowsLast)
+{
+    using index_type = typename TestFixture::index_type;
+    // a grid with an additional row coupling to all other rows
+    auto grid = this->create_grid_mtx(6);
+    gko::matrix_data<typename TestFixture::value_type, index_type> data;
+    grid->write(data);
+    data.size = gko::dim<2>{37, 37};
+    for (index_type i = 0; i < 36; i++) {
+        data.nonzeros.emplace_back(i, 36, -1);
+        data.nonzeros.emplace_back(36, i, -1);
+    }
+    data.nonzeros.emplace_back(36, 36, 40);
+    data.ensure_row_major_order();
+    auto mtx = gko::share(TestFixture::matrix_type::create(this->exec));
+    mtx->read(data);
+
+    auto perm = TestFixture::reorder_type::build()
+                    .with_dense_threshold(1.0)
+                    .on(this->exec)
+                    ->generate(mtx);
+
+    this->assert_is_permutation(perm.get());
+    ASSERT_EQ(perm->get_const_permutation()[36], 36);
+}
+
+
+TYPED_TEST(Amd, ArrowOrderingHasNoFill)
+{
+    auto mtx = this->create_arrow_mtx(10);
+    auto perm =
+        TestFixture::reorder_type::build().on(this->exec)->generate(mtx);
+
+    auto permuted = this->permute(mtx, perm.get());
+
+    ASSERT_EQ(this->factor_nnz(permuted), mtx->get_num_stored_elements());
+}
+
+
+TYPED_TEST(Amd, ReducesFillOnGrid)
+{
+    auto mtx = this->create_grid_mtx(20);
+    auto perm = TestFixture::reorder_type::build()
+                    .with_symmetric_sparsity(true)
+                    .on(this->exec)
+                    ->generate(mtx);
+
+    auto permuted = this->permute(mtx, perm.get());
+
+    this->assert_is_permutation(perm.get());
+    // the natural ordering has a band of width 20, which fills in completely
+    ASSERT_LT(this->factor_nnz(permuted), this->factor_nnz(mtx) / 2);
+}
+
+
+TYPED_TEST(Amd, FillIsComparableToReferenceAmd)
+{
+    auto mtx = gko::share(this->read_mtx(gko::matrices::location_ani1_mtx));
+    auto ref_factors = this->read_mtx(gko::matrices::location_ani1_amd_lu_mtx);
+    auto perm =
+        TestFixture::reorder_type::build().on(this->exec)->generate(mtx);
+
+    auto permuted = this->permute(mtx, perm.get());
+
+    this->assert_is_permutation(perm.get());
+    ASSERT_LE(this->factor_nnz(permuted),
+              ref_factors->get_num_stored_elements() * 6 / 5);
+}
+
+
+}  // namespace
@@ -0,0 +1,227 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/coloring.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/reorder/coloring_kernels.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Coloring : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type =
+        gko::experimental::reorder::Coloring<value_type, index_type>;
+    using coloring_distance = gko::experimental::reorder::coloring_distance;
+
+    Coloring()
+        : exec(gko::ReferenceExecutor::create()),
+          // 1D Laplacian, i.e. a path graph 0 - 1 - 2 - 3 - 4
+          path_mtx(gko::initialize<matrix_type>({{2, -1, 0, 0, 0},
+                                                 {-1, 2, -1, 0, 0},
+                                                 {0, -1, 2, -1, 0},
+                                                 {0, 0, -1, 2, -1},
+                                                 {0, 0, 0, -1, 2}},
+                                                exec)),
+          // only the upper triangle references row 0 from row 2
+          nonsymmetric_mtx(gko::initialize<matrix_type>(
+              {{1, 0, 1}, {0, 1, 0}, {0, 0, 1}}, exec)),
+          color_ptrs{exec}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<matrix_type> path_mtx;
+    std::shared_ptr<matrix_type> nonsymmetric_mtx;
+    gko::array<index_type> color_ptrs;
+};
+
+TYPED_TEST_SUITE(Coloring, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Coloring, ColorsPathGraphWithDistanceOne)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type row_ptrs[] = {0, 1, 3, 5, 7, 8};
+    const index_type col_idxs[] = {1, 0, 2, 1, 3, 2, 4, 3};
+    gko::array<index_type> colors{this->exec, 5};
+    index_type num_colors{};
+
+    gko::kernels::reference::coloring::color_graph(
+        this->exec, index_type{5}, row_ptrs, col_idxs,
+        TestFixture::coloring_distance::one, colors.get_data(), num_colors);
+
+    ASSERT_EQ(num_colors, 2);
+    GKO_ASSERT_ARRAY_EQ(colors,
+                        gko::array<index_type>(this->exec, {0, 1, 0, 1, 0}));
+}
+
+
+TYPED_TEST(Coloring, ColorsPathGraphWithDistanceTwo)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type row_ptrs[] = {0, 1, 3, 5, 7, 8};
+    const index_type col_idxs[] = {1, 0, 2, 1, 3, 2, 4, 3};
+    gko::array<index_type> colors{this->exec, 5};
+    index_type num_colors{};
+
+    gko::kernels::reference::coloring::color_graph(
+        this->exec, index_type{5}, row_ptrs, col_idxs,
+        TestFixture::coloring_distance::two, colors.get_data(), num_colors);
+
+    ASSERT_EQ(num_colors, 3);
+    GKO_ASSERT_ARRAY_EQ(colors,
+                        gko::array<index_type>(this->exec, {0, 1, 2, 0, 1}));
+}
+
+
+TYPED_TEST(Coloring, ComputesStablePermutation)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type colors[] = {1, 0, 2, 1, 0, 1};
+    gko::array<index_type> color_ptrs{this->exec, 4};
+    gko::array<index_type> permutation{this->exec, 6};
+
+    gko::kernels::reference::coloring::get_permutation(
+        this->exec, index_type{6}, colors, index_type{3},
+        color_ptrs.get_data(), permutation.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(color_ptrs,
+                        gko::array<index_type>(this->exec, {0, 2, 5, 6}));
+    GKO_ASSERT_ARRAY_EQ(permutation,
+                        gko::array<index_type>(this->exec, {1, 4, 0, 3, 5, 2}));
+}
+
+
+TYPED_TEST(Coloring, GeneratesDistanceOnePermutation)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factory = TestFixture::reorder_type::build().on(this->exec);
+
+    auto perm = factory->generate(this->path_mtx, this->color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 5,
+                                   perm->get_const_permutation()),
+        gko::array<index_type>(this->exec, {0, 2, 4, 1, 3}));
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs,
+                        gko::array<index_type>(this->exec, {0, 3, 5}));
+}
+
+
+TYPED_TEST(Coloring, GeneratesDistanceTwoPermutation)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factory = TestFixture::reorder_type::build()
+                       .with_distance(TestFixture::coloring_distance::two)
+                       .with_symmetric_sparsity(true)
+                       .on(this->exec);
+
+    auto perm = factory->generate(this->path_mtx, this->color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 5,
+                                   perm->get_const_permutation()),
+        gko::array<index_type>(this->exec, {0, 3, 1, 4, 2}));
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs,
+                        gko::array<index_type>(this->exec, {0, 2, 4, 5}));
+}
+
+
+TYPED_TEST(Coloring, GeneratesWithoutColorPtrs)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factory = TestFixture::reorder_type::build().on(this->exec);
+
+    auto perm = factory->generate(this->path_mtx);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 5,
+                                   perm->get_const_permutation()),
+        gko::array<index_type>(this->exec, {0, 2, 4, 1, 3}));
+}
+
+
+TYPED_TEST(Coloring, SymmetrizesPattern)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factory = TestFixture::reorder_type::build().on(this->exec);
+
+    auto perm = factory->generate(this->nonsymmetric_mtx, this->color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 3,
+                                   perm->get_const_permutation()),
+        gko::array<index_type>(this->exec, {0, 1, 2}));
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs,
+                        gko::array<index_type>(this->exec, {0, 2, 3}));
+}
+
+
+TYPED_TEST(Coloring, KeepsNonsymmetricPatternIfRequested)
+{
+    using index_type = typename TestFixture::index_type;
+    auto factory = TestFixture::reorder_type::build()
+                       .with_symmetric_sparsity(true)
+                       .on(this->exec);
+
+    auto perm = factory->generate(this->nonsymmetric_mtx, this->color_ptrs);
+
+    // row 2 does not see its neighbor 0, so it gets color 0 as well
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs,
+                        gko::array<index_type>(this->exec, {0, 3}));
+}
+
+
+}  // namespace
@@ -0,0 +1,253 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/nested_dissection.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+#include <ginkgo/core/reorder/amd.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class NestedDissection : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type =
+        gko::experimental::reorder::NestedDissection<value_type, index_type>;
+    using amd_type = gko::experimental::reorder::Amd<value_type, index_type>;
+    using perm_type = gko::matrix::Permutation<index_type>;
+    using lu_type =
+        gko::experimental::factorization::Lu<value_type, index_type>;
+
+    NestedDissection() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::unique_ptr<reorder_type> create_factory(gko::size_type max_leaf_size)
+    {
+        return reorder_type::build()
+            .with_use_metis(false)
+            .with_max_leaf_size(max_leaf_size)
+            .on(exec);
+    }
+
+    std::unique_ptr<matrix_type> read_mtx(const char* filename)
+    {
+        std::ifstream stream{filename};
+        return gko::read<matrix_type>(stream, exec);
+    }
+
+    // the matrix with a full first row and column and a diagonal otherwise
+    std::shared_ptr<matrix_type> create_arrow_mtx(index_type size,
+                                                  bool symmetric = true)
+    {
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size)};
+        for (index_type i = 0; i < size; i++) {
+            data.nonzeros.emplace_back(i, i, 4);
+            if (i > 0) {
+                data.nonzeros.emplace_back(0, i, -1);
+                if (symmetric) {
+                    data.nonzeros.emplace_back(i, 0, -1);
+                }
+            }
+        }
+        data.ensure_row_major_order();
+        auto mtx = gko::share(matrix_type::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    // 5-point stencil on a size x size grid
+    std::shared_ptr<matrix_type> create_grid_mtx(index_type size)
+    {
+        const auto num_rows = size * size;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(num_rows)};
+        for (index_type y = 0; y < size; y++) {
+            for (index_type x = 0; x < size; x++) {
+                const auto row = y * size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - size, -1);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1);
+                }
+                data.nonzeros.emplace_back(row, row, 4);
+                if (x < size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1);
+                }
+                if (y < size - 1) {
+                    data.nonzeros.emplace_back(row, row + size, -1);
+                }
+            }
+        }
+        auto mtx = gko::share(matrix_type::create(exec));
+        mtx->read(data);
+        return mtx;
+    }
+
+    void assert_is_permutation(const perm_type* perm)
+    {
+        const auto size = perm->get_permutation_size();
+        std::vector<index_type> sorted(perm->get_const_permutation(),
+                                       perm->get_const_permutation() + size);
+        std::sort(sorted.begin(), sorted.end());
+        for (gko::size_type i = 0; i < size; i++) {
+            ASSERT_EQ(sorted[i], i);
+        }
+    }
+
+    std::shared_ptr<matrix_type> permute(std::shared_ptr<matrix_type> mtx,
+                                         const perm_type* perm)
+    {
+        auto perm_array =
+            gko::make_const_array_view(exec, perm->get_permutation_size(),
+                                       perm->get_const_permutation())
+                .copy_to_array();
+        return gko::as<matrix_type>(mtx->permute(&perm_array));
+    }
+
+    gko::size_type factor_nnz(std::shared_ptr<const matrix_type> mtx)
+    {
+        return lu_type::build()
+            .with_symmetric_sparsity(true)
+            .on(exec)
+            ->generate(mtx)
+            ->get_combined()
+            ->get_num_stored_elements();
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+};
+
+TYPED_TEST_SUITE(NestedDissection, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(NestedDissection, WorksOnEmptyMatrix)
+{
+    auto mtx = gko::share(TestFixture::matrix_type::create(this->exec));
+
+    auto perm = this->create_factory(4)->generate(mtx);
+
+    ASSERT_EQ(perm->get_size(), gko::dim<2>{});
+}
+
+
+TYPED_TEST(NestedDissection, OrdersArrowHubLate)
+{
+    auto mtx = this->create_arrow_mtx(10);
+
+    auto perm = this->create_factory(2)->generate(mtx);
+
+    this->assert_is_permutation(perm.get());
+    // the hub is the only separator vertex, so it is ordered last
+    ASSERT_EQ(perm->get_const_permutation()[9], 0);
+}
+
+
+TYPED_TEST(NestedDissection, SymmetrizesPattern)
+{
+    auto mtx = this->create_arrow_mtx(10, false);
+
+    auto perm = this->create_factory(2)->generate(mtx);
+
+    this->assert_is_permutation(perm.get());
+    ASSERT_EQ(perm->get_const_permutation()[9], 0);
+}
+
+
+TYPED_TEST(NestedDissection, OrdersLeafWithAmd)
+{
+    auto mtx = this->create_grid_mtx(6);
+
+    auto perm = this->create_factory(36)->generate(mtx);
+    auto amd_perm =
+        TestFixture::amd_type::build().on(this->exec)->generate(mtx);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 36,
+                                   perm->get_const_permutation()),
+        gko::make_const_array_view(this->exec, 36,
+                                   amd_perm->get_const_permutation())
+            .copy_to_array());
+}
+
+
+TYPED_TEST(NestedDissection, ReducesFillOnGrid)
+{
+    auto mtx = this->create_grid_mtx(20);
+    auto perm = this->create_factory(16)->generate(mtx);
+
+    auto permuted = this->permute(mtx, perm.get());
+
+    this->assert_is_permutation(perm.get());
+    // the natural ordering has a band of width 20, which fills in completely
+    ASSERT_LT(this->factor_nnz(permuted), this->factor_nnz(mtx) * 2 / 3);
+}
+
+
+TYPED_TEST(NestedDissection, FillIsComparableToReferenceAmd)
+{
+    auto mtx = gko::share(this->read_mtx(gko::matrices::location_ani1_mtx));
+    auto ref_factors = this->read_mtx(gko::matrices::location_ani1_amd_lu_mtx);
+    auto perm = this->create_factory(16)->generate(mtx);
+
+    auto permuted = this->permute(mtx, perm.get());
+
+    this->assert_is_permutation(perm.get());
+    ASSERT_LE(this->factor_nnz(permuted),
+              ref_factors->get_num_stored_elements() * 3 / 2);
+}
+
+
+}  // namespace
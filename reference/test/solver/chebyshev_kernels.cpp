@@ -0,0 +1,398 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/chebyshev.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/solver/chebyshev_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Chebyshev : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Chebyshev<value_type>;
+    Chebyshev()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{0.9, -1.0, 3.0}, {0.0, 1.0, 3.0}, {0.0, 0.0, 1.1}}, exec)),
+          spd_mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          // Eigenvalues of mtx are 0.9, 1.0 and 1.1
+          chebyshev_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(30u).on(
+                          exec),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value)
+                          .on(exec))
+                  .with_foci(value_type{0.9}, value_type{1.1})
+                  .on(exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<Mtx> spd_mtx;
+    std::unique_ptr<typename Solver::Factory> chebyshev_factory;
+};
+
+TYPED_TEST_SUITE(Chebyshev, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Chebyshev, KernelInitUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{-1.0, 0.5}, I<T>{0.0, 4.0}}, this->exec);
+    auto update_sol = Mtx::create(this->exec, gko::dim<2>{3, 2});
+    update_sol->fill(value_type{-7.0});
+    auto output = gko::initialize<Mtx>(
+        {I<T>{1.0, 1.0}, I<T>{2.0, 2.0}, I<T>{3.0, 3.0}}, this->exec);
+
+    gko::kernels::reference::chebyshev::init_update(
+        this->exec, value_type{0.5}, inner_sol.get(), update_sol.get(),
+        output.get());
+
+    GKO_ASSERT_MTX_NEAR(update_sol, inner_sol, 0.0);
+    GKO_ASSERT_MTX_NEAR(output, l({{1.5, 2.0}, {1.5, 2.25}, {3.0, 5.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Chebyshev, KernelUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{-1.0, 0.5}, I<T>{0.0, 4.0}}, this->exec);
+    auto update_sol = gko::initialize<Mtx>(
+        {I<T>{2.0, 0.0}, I<T>{1.0, -1.0}, I<T>{-2.0, 2.0}}, this->exec);
+    auto output = gko::initialize<Mtx>(
+        {I<T>{1.0, 1.0}, I<T>{2.0, 2.0}, I<T>{3.0, 3.0}}, this->exec);
+
+    gko::kernels::reference::chebyshev::update(
+        this->exec, value_type{0.5}, value_type{2.0}, inner_sol.get(),
+        update_sol.get(), output.get());
+
+    GKO_ASSERT_MTX_NEAR(update_sol, l({{5.0, 2.0}, {1.0, -1.5}, {-4.0, 8.0}}),
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(output, l({{3.5, 2.0}, {2.5, 1.25}, {1.0, 7.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesTriangularSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesTriangularSystemMixed)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}),
+                        (r_mixed<value_type, TypeParam>()) * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesTriangularSystemComplex)
+{
+    using Mtx = gko::to_complex<typename TestFixture::Mtx>;
+    using value_type = typename Mtx::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {value_type{3.9, -7.8}, value_type{9.0, -18.0}, value_type{2.2, -4.4}},
+        this->exec);
+    auto x = gko::initialize<Mtx>(
+        {value_type{0.0, 0.0}, value_type{0.0, 0.0}, value_type{0.0, 0.0}},
+        this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({value_type{1.0, -2.0}, value_type{3.0, -6.0},
+                           value_type{2.0, -4.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesMultipleTriangularSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<value_type>{3.9, 2.9}, I<value_type>{9.0, 4.0},
+         I<value_type>{2.2, 1.1}},
+        this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<value_type>{0.0, 0.0}, I<value_type>{0.0, 0.0},
+         I<value_type>{0.0, 0.0}},
+        this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesTriangularSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesTransposedTriangularSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx->transpose());
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    gko::as<gko::Transposable>(solver.get())->transpose()->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesSpdSystemWithEstimatedFoci)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->spd_mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesSpdSystemWithPreconditioner)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->spd_mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesSpdSystemAsMultigridSmoother)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    const gko::size_type size = 32;
+    // 1D Laplacian
+    gko::matrix_data<value_type, gko::int32> data{gko::dim<2>{size, size}};
+    for (gko::int32 i = 0; i < size; i++) {
+        if (i > 0) {
+            data.nonzeros.emplace_back(i, i - 1, -1.0);
+        }
+        data.nonzeros.emplace_back(i, i, 2.0);
+        if (i < size - 1) {
+            data.nonzeros.emplace_back(i, i + 1, -1.0);
+        }
+    }
+    auto mtx = gko::share(Csr::create(this->exec));
+    mtx->read(data);
+    auto smoother =
+        gko::share(Solver::build()
+                       .with_criteria(gko::stop::Iteration::build()
+                                          .with_max_iters(2u)
+                                          .on(this->exec))
+                       .with_preconditioner(
+                           gko::preconditioner::Jacobi<value_type>::build()
+                               .with_max_block_size(1u)
+                               .on(this->exec))
+                       .on(this->exec));
+    auto solver =
+        gko::solver::Multigrid::build()
+            .with_mg_level(
+                gko::multigrid::Pgm<value_type, gko::int32>::build().on(
+                    this->exec))
+            .with_pre_smoother(smoother)
+            .with_min_coarse_rows(4u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value * 1e1)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(mtx);
+    auto b = Mtx::create(this->exec, gko::dim<2>{size, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Mtx::create(this->exec, gko::dim<2>{size, 1});
+    x->fill(gko::zero<value_type>());
+    auto res = b->clone();
+    auto one = gko::initialize<Mtx>({1.0}, this->exec);
+    auto neg_one = gko::initialize<Mtx>({-1.0}, this->exec);
+
+    solver->apply(b, x);
+
+    mtx->apply(neg_one, x, one, res);
+    auto res_norm = gko::matrix::Dense<gko::remove_complex<value_type>>::create(
+        this->exec, gko::dim<2>{1, 1});
+    auto b_norm = res_norm->clone();
+    res->compute_norm2(res_norm);
+    b->compute_norm2(b_norm);
+    ASSERT_LE(res_norm->at(0, 0),
+              r<value_type>::value * 1e3 * b_norm->at(0, 0));
+}
+
+
+TYPED_TEST(Chebyshev, ApplyWithGivenInitialGuessModeIsEquivalentToRef)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using initial_guess_mode = gko::solver::initial_guess_mode;
+    auto ref_solver =
+        gko::solver::Chebyshev<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(2u).on(this->exec))
+            .with_foci(value_type{0.9}, value_type{1.1})
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    for (auto guess : {initial_guess_mode::provided, initial_guess_mode::rhs,
+                       initial_guess_mode::zero}) {
+        auto solver =
+            gko::solver::Chebyshev<value_type>::build()
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(2u).on(
+                        this->exec))
+                .with_foci(value_type{0.9}, value_type{1.1})
+                .with_default_initial_guess(guess)
+                .on(this->exec)
+                ->generate(this->mtx);
+        auto x = gko::initialize<Mtx>({1.0, -1.0, 1.0}, this->exec);
+        std::shared_ptr<Mtx> ref_x = nullptr;
+        if (guess == initial_guess_mode::provided) {
+            ref_x = x->clone();
+        } else if (guess == initial_guess_mode::rhs) {
+            ref_x = b->clone();
+        } else {
+            ref_x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+        }
+        solver->apply(b, x);
+        ref_solver->apply(b, ref_x);
+
+        GKO_ASSERT_MTX_NEAR(x, ref_x, 0.0);
+    }
+}
+
+
+}  // namespace
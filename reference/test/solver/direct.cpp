@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/factorization/lu.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/reorder/amd.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -68,7 +69,8 @@ protected:
         gko::experimental::solver::Direct<value_type, index_type>;
     Direct() : rng{93671}, exec(gko::ReferenceExecutor::create()) {}
 
-    void setup(const char* mtx_filename, int nrhs = 1)
+    void setup(const char* mtx_filename, int nrhs = 1,
+               std::shared_ptr<const gko::LinOpFactory> reordering = nullptr)
     {
         std::ifstream stream{mtx_filename};
         mtx = gko::read<matrix_type>(stream, exec);
@@ -79,6 +81,7 @@ protected:
                                                          index_type>::build()
                         .with_symmetric_sparsity(true)
                         .on(exec))
+                .with_reordering(reordering)
                 .on(exec);
         solver = factory->generate(mtx);
         std::normal_distribution<gko::remove_complex<value_type>> dist(0, 1);
@@ -89,6 +92,26 @@ protected:
         mtx->apply(x, b);
     }
 
+    // creates a matrix with the same sparsity pattern as mtx, but with a
+    // doubled diagonal, and updates b accordingly
+    std::shared_ptr<matrix_type> create_updated_matrix()
+    {
+        auto result = gko::share(gko::clone(mtx));
+        const auto row_ptrs = result->get_const_row_ptrs();
+        const auto col_idxs = result->get_const_col_idxs();
+        const auto vals = result->get_values();
+        for (index_type row = 0;
+             row < static_cast<index_type>(result->get_size()[0]); row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (col_idxs[nz] == row) {
+                    vals[nz] *= 2;
+                }
+            }
+        }
+        result->apply(x_ref, b);
+        return result;
+    }
+
     std::default_random_engine rng;
     std::shared_ptr<const gko::ReferenceExecutor> exec;
     std::shared_ptr<matrix_type> mtx;
@@ -123,3 +146,67 @@ TYPED_TEST(Direct, SolvesAni1AmdMultipleRhs)
 
     GKO_ASSERT_MTX_NEAR(this->x, this->x_ref, r<value_type>::value);
 }
+
+
+TYPED_TEST(Direct, SolvesAni1WithAmdReordering)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->setup(gko::matrices::location_ani1_mtx, 3,
+                gko::experimental::reorder::Amd<value_type,
+                                                index_type>::build()
+                    .on(this->exec));
+
+    this->solver->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->x_ref, r<value_type>::value);
+}
+
+
+TYPED_TEST(Direct, AdvancedSolvesAni1WithAmdReordering)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using vector_type = typename TestFixture::vector_type;
+    this->setup(gko::matrices::location_ani1_mtx, 3,
+                gko::experimental::reorder::Amd<value_type,
+                                                index_type>::build()
+                    .on(this->exec));
+    auto alpha = gko::initialize<vector_type>({2.0}, this->exec);
+    auto beta = gko::initialize<vector_type>({-1.0}, this->exec);
+
+    // x is initialized with the solution, so 2 * A^-1 b - x = x
+    this->solver->apply(alpha, this->b, beta, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->x_ref, r<value_type>::value);
+}
+
+
+TYPED_TEST(Direct, SolvesAni1AfterRefactorize)
+{
+    using value_type = typename TestFixture::value_type;
+    this->setup(gko::matrices::location_ani1_mtx);
+    auto new_mtx = this->create_updated_matrix();
+
+    this->solver->refactorize(new_mtx);
+    this->solver->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->x_ref, r<value_type>::value);
+}
+
+
+TYPED_TEST(Direct, SolvesAni1WithAmdReorderingAfterRefactorize)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->setup(gko::matrices::location_ani1_mtx, 3,
+                gko::experimental::reorder::Amd<value_type,
+                                                index_type>::build()
+                    .on(this->exec));
+    auto new_mtx = this->create_updated_matrix();
+
+    this->solver->refactorize(new_mtx);
+    this->solver->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->x_ref, r<value_type>::value);
+}
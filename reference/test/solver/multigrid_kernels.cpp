@@ -1315,6 +1315,35 @@ TYPED_TEST(Multigrid, SolvesStencilSystemByVCycle)
 }
 
 
+TYPED_TEST(Multigrid, SolvesStencilSystemAfterUpdateValues)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    auto solver = multigrid_factory->generate(this->mtx);
+    auto old_level = solver->get_mg_level_list().at(0);
+    auto two = gko::initialize<Mtx>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(two);
+    auto scaled_coarse = gko::clone(gko::as<Csr>(old_level->get_coarse_op()));
+    scaled_coarse->scale(two);
+    auto b = gko::initialize<Mtx>({-2.0, 6.0, 2.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->update_values(scaled_mtx);
+    solver->apply(b, x);
+
+    auto new_level = solver->get_mg_level_list().at(0);
+    ASSERT_EQ(solver->get_system_matrix(), scaled_mtx);
+    ASSERT_EQ(new_level->get_prolong_op(), old_level->get_prolong_op());
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(new_level->get_coarse_op()),
+                        scaled_coarse, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
 TYPED_TEST(Multigrid, SolvesStencilSystemByWCycle)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -35,6 +35,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 
 #include <gtest/gtest-typed-test.h>
@@ -45,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 
 
 #include "core/test/utils.hpp"
@@ -364,3 +367,34 @@ TYPED_TEST(Matrix, BuildsLocalWithColPartitionIsEquivalentToRef)
     this->validate(row_partition, col_partition, d_row_partition,
                    d_col_partition, input);
 }
+
+
+TYPED_TEST(Matrix, AddsScaledRowsIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using Dense = gko::matrix::Dense<value_type>;
+    auto alpha = gko::initialize<Dense>({-1.5}, this->ref);
+    auto rows = gko::test::generate_random_matrix<Dense>(
+        50, 3, std::uniform_int_distribution<>(3, 3),
+        std::uniform_real_distribution<>(-1.0, 1.0), this->engine, this->ref);
+    auto x = gko::test::generate_random_matrix<Dense>(
+        200, 3, std::uniform_int_distribution<>(3, 3),
+        std::uniform_real_distribution<>(-1.0, 1.0), this->engine, this->ref);
+    std::vector<local_index_type> perm(200);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), this->engine);
+    gko::array<local_index_type> row_idxs{this->ref, perm.begin(),
+                                          perm.begin() + 50};
+    auto d_alpha = gko::clone(this->exec, alpha);
+    auto d_rows = gko::clone(this->exec, rows);
+    auto d_x = gko::clone(this->exec, x);
+    gko::array<local_index_type> d_row_idxs{this->exec, row_idxs};
+
+    gko::kernels::reference::distributed_matrix::add_scaled_rows(
+        this->ref, alpha.get(), rows.get(), row_idxs, x.get());
+    gko::kernels::EXEC_NAMESPACE::distributed_matrix::add_scaled_rows(
+        this->exec, d_alpha.get(), d_rows.get(), d_row_idxs, d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value);
+}
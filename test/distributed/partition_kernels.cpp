@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 #include "core/test/utils.hpp"
@@ -371,3 +372,22 @@ TYPED_TEST(Partition, IsOrderedRandom)
 
     ASSERT_EQ(part->has_ordered_parts(), dpart->has_ordered_parts());
 }
+
+
+TYPED_TEST(Partition, BuildsMappingFromGraph)
+{
+    using global_index_type = typename TestFixture::global_index_type;
+    using mtx_type = gko::matrix::Csr<double, global_index_type>;
+    const comm_index_type num_parts = 7;
+    auto mtx = gko::share(gko::test::generate_random_matrix<mtx_type>(
+        5000, 5000, std::uniform_int_distribution<>(2, 8),
+        std::normal_distribution<>(), this->rand_engine, this->ref));
+    auto dmtx = gko::share(gko::clone(this->exec, mtx));
+
+    auto mapping = gko::experimental::distributed::build_mapping_from_graph<
+        double, global_index_type>(this->ref, mtx, num_parts);
+    auto dmapping = gko::experimental::distributed::build_mapping_from_graph<
+        double, global_index_type>(this->exec, dmtx, num_parts);
+
+    GKO_ASSERT_ARRAY_EQ(mapping, dmapping);
+}
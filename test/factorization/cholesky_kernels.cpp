@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <memory>
+#include <random>
 
 
 #include <gtest/gtest.h>
@@ -54,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/csr_lookup.hpp"
 #include "core/test/utils.hpp"
 #include "core/test/utils/assertions.hpp"
+#include "core/test/utils/matrix_generator.hpp"
 #include "core/utils/matrix_utils.hpp"
 #include "matrices/config.hpp"
 #include "test/utils/executor.hpp"
@@ -160,6 +162,52 @@ using Types = ::testing::Types<std::tuple<float, gko::int32>,
 TYPED_TEST_SUITE(CholeskySymbolic, Types, PairTypenameNameGenerator);
 
 
+#ifdef GKO_COMPILING_OMP
+
+
+// the skeleton tree is only computed on host executors
+TYPED_TEST(CholeskySymbolic, KernelComputeSkeletonTree)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::default_random_engine engine(42);
+    this->matrices.emplace_back(
+        "random", gko::test::generate_random_matrix<matrix_type>(
+                      1000, 1000,
+                      std::uniform_int_distribution<index_type>(1, 5),
+                      std::normal_distribution<gko::remove_complex<value_type>>(
+                          -1.0, 1.0),
+                      engine, this->ref));
+    for (const auto& pair : this->matrices) {
+        SCOPED_TRACE(pair.first);
+        const auto& mtx = pair.second;
+        const auto dmtx = gko::clone(this->exec, mtx);
+        const auto num_rows = mtx->get_size()[0];
+        gko::array<index_type> row_ptrs{this->ref, num_rows + 1};
+        gko::array<index_type> cols{this->ref, num_rows};
+        gko::array<index_type> drow_ptrs{this->exec, num_rows + 1};
+        gko::array<index_type> dcols{this->exec, num_rows};
+
+        gko::kernels::reference::cholesky::compute_skeleton_tree(
+            this->ref, mtx->get_const_row_ptrs(), mtx->get_const_col_idxs(),
+            num_rows, row_ptrs.get_data(), cols.get_data());
+        gko::kernels::EXEC_NAMESPACE::cholesky::compute_skeleton_tree(
+            this->exec, dmtx->get_const_row_ptrs(), dmtx->get_const_col_idxs(),
+            num_rows, drow_ptrs.get_data(), dcols.get_data());
+
+        GKO_ASSERT_ARRAY_EQ(drow_ptrs, row_ptrs);
+        const auto nnz = row_ptrs.get_const_data()[num_rows];
+        GKO_ASSERT_ARRAY_EQ(
+            gko::make_array_view(this->exec, nnz, dcols.get_data()),
+            gko::make_array_view(this->ref, nnz, cols.get_data()));
+    }
+}
+
+
+#endif
+
+
 TYPED_TEST(CholeskySymbolic, KernelSymbolicCount)
 {
     using matrix_type = typename TestFixture::matrix_type;
@@ -243,7 +291,7 @@ TYPED_TEST(CholeskySymbolic, SymbolicFactorize)
         std::unique_ptr<elimination_forest> forest;
         std::unique_ptr<elimination_forest> dforest;
         gko::factorization::symbolic_cholesky(mtx.get(), true, factors, forest);
-        gko::factorization::symbolic_cholesky(mtx.get(), true, dfactors,
+        gko::factorization::symbolic_cholesky(dmtx.get(), true, dfactors,
                                               dforest);
 
         GKO_ASSERT_MTX_EQ_SPARSITY(dfactors, factors);
@@ -175,6 +175,66 @@ using Types = ::testing::Types<std::tuple<float, gko::int32>,
 TYPED_TEST_SUITE(Lu, Types, PairTypenameNameGenerator);
 
 
+#ifdef GKO_COMPILING_OMP
+
+
+// the symbolic factorization is only computed on host executors
+TYPED_TEST(Lu, KernelSymbolicFactorizeIsEquivalentToRef)
+{
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        gko::array<index_type> row_ptrs{this->ref, this->num_rows + 1};
+        gko::array<index_type> col_idxs{this->ref};
+        gko::array<index_type> drow_ptrs{this->exec, this->num_rows + 1};
+        gko::array<index_type> dcol_idxs{this->exec};
+
+        gko::kernels::reference::lu_factorization::symbolic_factorize(
+            this->ref, this->mtx->get_const_row_ptrs(),
+            this->mtx->get_const_col_idxs(), this->num_rows,
+            row_ptrs.get_data(), col_idxs);
+        gko::kernels::EXEC_NAMESPACE::lu_factorization::symbolic_factorize(
+            this->exec, this->dmtx->get_const_row_ptrs(),
+            this->dmtx->get_const_col_idxs(), this->num_rows,
+            drow_ptrs.get_data(), dcol_idxs);
+
+        GKO_ASSERT_ARRAY_EQ(drow_ptrs, row_ptrs);
+        GKO_ASSERT_ARRAY_EQ(dcol_idxs, col_idxs);
+    });
+}
+
+
+TYPED_TEST(Lu, KernelSymbolicFactorizeFillLevelIsEquivalentToRef)
+{
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        for (gko::size_type fill_level : {0, 1, 2, 5}) {
+            SCOPED_TRACE(fill_level);
+            gko::array<index_type> row_ptrs{this->ref, this->num_rows + 1};
+            gko::array<index_type> col_idxs{this->ref};
+            gko::array<index_type> drow_ptrs{this->exec, this->num_rows + 1};
+            gko::array<index_type> dcol_idxs{this->exec};
+
+            gko::kernels::reference::lu_factorization::
+                symbolic_factorize_fill_level(
+                    this->ref, this->mtx->get_const_row_ptrs(),
+                    this->mtx->get_const_col_idxs(), this->num_rows,
+                    fill_level, row_ptrs.get_data(), col_idxs);
+            gko::kernels::EXEC_NAMESPACE::lu_factorization::
+                symbolic_factorize_fill_level(
+                    this->exec, this->dmtx->get_const_row_ptrs(),
+                    this->dmtx->get_const_col_idxs(), this->num_rows,
+                    fill_level, drow_ptrs.get_data(), dcol_idxs);
+
+            GKO_ASSERT_ARRAY_EQ(drow_ptrs, row_ptrs);
+            GKO_ASSERT_ARRAY_EQ(dcol_idxs, col_idxs);
+        }
+    });
+}
+
+
+#endif
+
+
 TYPED_TEST(Lu, KernelInitializeIsEquivalentToRef)
 {
     using value_type = typename TestFixture::value_type;
@@ -227,11 +287,11 @@ TYPED_TEST(Lu, KernelFactorizeIsEquivalentToRef)
         gko::kernels::reference::lu_factorization::factorize(
             this->ref, this->storage_offsets.get_const_data(),
             this->row_descs.get_const_data(), this->storage.get_const_data(),
-            diag_idxs.get_const_data(), this->mtx_lu.get(), tmp);
+            diag_idxs.get_const_data(), this->mtx_lu.get(), false, tmp);
         gko::kernels::EXEC_NAMESPACE::lu_factorization::factorize(
             this->exec, this->dstorage_offsets.get_const_data(),
             this->drow_descs.get_const_data(), this->dstorage.get_const_data(),
-            ddiag_idxs.get_const_data(), this->dmtx_lu.get(), dtmp);
+            ddiag_idxs.get_const_data(), this->dmtx_lu.get(), false, dtmp);
 
         GKO_ASSERT_MTX_NEAR(this->mtx_lu, this->dmtx_lu, r<value_type>::value);
     });
@@ -301,6 +301,20 @@ TYPED_TEST(ParIlut, KernelThresholdSelectMaxIsEquivalentToRef)
 }
 
 
+TYPED_TEST(ParIlut, KernelThresholdSelectManyDuplicatesIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::clone(this->ref, this->mtx_l);
+    // only a handful of distinct magnitudes
+    for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); ++i) {
+        mtx->get_values()[i] = static_cast<value_type>(i % 3);
+    }
+    auto dmtx = gko::clone(this->exec, mtx);
+
+    this->test_select(mtx, dmtx, mtx->get_num_stored_elements() / 2);
+}
+
+
 TYPED_TEST(ParIlut, KernelThresholdFilterNullptrCooIsEquivalentToRef)
 {
     using Csr = typename TestFixture::Csr;
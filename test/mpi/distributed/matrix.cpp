@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <array>
 #include <memory>
 #include <random>
+#include <sstream>
 
 
 #include <mpi.h>
@@ -43,7 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/config.hpp>
 #include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/matrix_assembly_data.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/mtx_io.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
@@ -184,6 +187,102 @@ TYPED_TEST(MatrixCreation, ReadsDistributedWithColPartition)
 }
 
 
+TYPED_TEST(MatrixCreation, ReadsDistributedWithOffProcessEntries)
+{
+    using value_type = typename TestFixture::value_type;
+    using csr = typename TestFixture::local_matrix_type;
+    using matrix_data = typename TestFixture::matrix_data;
+    I<I<value_type>> res_local[] = {{{0, 1}, {0, 3}}, {{6, 0}, {0, 8}}, {{10}}};
+    I<I<value_type>> res_non_local[] = {
+        {{0, 2}, {4, 0}}, {{5, 0}, {0, 7}}, {{9}}};
+    auto rank = this->dist_mat->get_communicator().rank();
+    // each rank provides every third entry, regardless of the row owner
+    matrix_data input{this->size};
+    for (gko::size_type i = rank; i < this->mat_input.nonzeros.size();
+         i += 3) {
+        input.nonzeros.push_back(this->mat_input.nonzeros[i]);
+    }
+
+    this->dist_mat->read_distributed(
+        input, this->row_part,
+        gko::experimental::distributed::assembly_mode::communicate);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        res_local[rank], 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        res_non_local[rank], 0);
+}
+
+
+TYPED_TEST(MatrixCreation, SumsOffProcessEntriesFromAssemblyData)
+{
+    using value_type = typename TestFixture::value_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    using csr = typename TestFixture::local_matrix_type;
+    auto expected_input = this->mat_input;
+    for (auto& entry : expected_input.nonzeros) {
+        entry.value *= 3;
+    }
+    auto expected = dist_mtx_type::create(this->exec, this->comm);
+    expected->read_distributed(expected_input, this->row_part,
+                               this->col_part);
+    // every rank adds all entries, so the owners have to sum them up
+    gko::matrix_assembly_data<value_type, global_index_type> assembly{
+        this->size};
+    for (const auto& entry : this->mat_input.nonzeros) {
+        assembly.add_value(entry.row, entry.column, entry.value);
+    }
+
+    this->dist_mat->read_distributed(
+        assembly.get_ordered_data(), this->row_part, this->col_part,
+        gko::experimental::distributed::assembly_mode::communicate);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        gko::as<csr>(expected->get_local_matrix()), 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        gko::as<csr>(expected->get_non_local_matrix()), 0);
+}
+
+
+TYPED_TEST(MatrixCreation, ReadsDistributedBinary)
+{
+    using value_type = typename TestFixture::value_type;
+    using csr = typename TestFixture::local_matrix_type;
+    I<I<value_type>> res_local[] = {{{0, 1}, {0, 3}}, {{6, 0}, {0, 8}}, {{10}}};
+    I<I<value_type>> res_non_local[] = {
+        {{0, 2}, {4, 0}}, {{5, 0}, {0, 7}}, {{9}}};
+    auto rank = this->dist_mat->get_communicator().rank();
+    std::stringstream ss;
+    gko::write_binary_raw(ss, this->mat_input);
+
+    this->dist_mat->read_distributed_binary(ss, this->row_part);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        res_local[rank], 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        res_non_local[rank], 0);
+}
+
+
+TYPED_TEST(MatrixCreation, ReadsDistributedBinaryWithDisconnectedParts)
+{
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    using csr = typename TestFixture::local_matrix_type;
+    auto expected = dist_mtx_type::create(this->exec, this->comm);
+    expected->read_distributed(this->mat_input, this->col_part);
+    std::stringstream ss;
+    gko::write_binary_raw(ss, this->mat_input);
+
+    this->dist_mat->read_distributed_binary(ss, this->col_part);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        gko::as<csr>(expected->get_local_matrix()), 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        gko::as<csr>(expected->get_non_local_matrix()), 0);
+}
+
+
 #endif
 
 
@@ -317,6 +416,55 @@ public:
         dense_y->read(vec_md);
     }
 
+    void init_rectangular(gko::size_type num_rows, gko::size_type num_cols,
+                          gko::size_type num_vectors)
+    {
+        int num_parts = comm.size();
+        auto x_md = gko::test::generate_random_matrix_data<value_type,
+                                                           global_index_type>(
+            num_cols, num_vectors,
+            std::uniform_int_distribution<int>(static_cast<int>(num_vectors),
+                                               static_cast<int>(num_vectors)),
+            std::normal_distribution<gko::remove_complex<value_type>>(),
+            engine);
+        auto y_md = gko::test::generate_random_matrix_data<value_type,
+                                                           global_index_type>(
+            num_rows, num_vectors,
+            std::uniform_int_distribution<int>(static_cast<int>(num_vectors),
+                                               static_cast<int>(num_vectors)),
+            std::normal_distribution<gko::remove_complex<value_type>>(),
+            engine);
+        auto mat_md = gko::test::generate_random_matrix_data<value_type,
+                                                             global_index_type>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<int>(0, static_cast<int>(num_cols)),
+            std::normal_distribution<gko::remove_complex<value_type>>(),
+            engine);
+
+        auto row_mapping = gko::test::generate_random_array<
+            gko::experimental::distributed::comm_index_type>(
+            num_rows, std::uniform_int_distribution<int>(0, num_parts - 1),
+            engine, exec);
+        auto col_mapping = gko::test::generate_random_array<
+            gko::experimental::distributed::comm_index_type>(
+            num_cols, std::uniform_int_distribution<int>(0, num_parts - 1),
+            engine, exec);
+        row_part_large =
+            part_type::build_from_mapping(exec, row_mapping, num_parts);
+        col_part_large =
+            part_type::build_from_mapping(exec, col_mapping, num_parts);
+
+        dist_mat_large->read_distributed(mat_md, row_part_large,
+                                         col_part_large);
+        csr_mat->read(mat_md);
+
+        x->read_distributed(x_md, col_part_large);
+        dense_x->read(x_md);
+
+        y->read_distributed(y_md, row_part_large);
+        dense_y->read(y_md);
+    }
+
     gko::dim<2> size;
 
     std::unique_ptr<part_type> row_part;
@@ -436,6 +584,217 @@ TYPED_TEST(Matrix, CanAdvancedApplyToMultipleVectorsLarge)
 }
 
 
+TYPED_TEST(Matrix, CanApplyRectangular)
+{
+    this->init_rectangular(100, 60, 3);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyTransposedToMultipleVectorsLarge)
+{
+    this->init_large(100, 17);
+
+    this->dist_mat_large->apply_transposed(this->y, this->x);
+    this->csr_mat->transpose()->apply(this->dense_y, this->dense_x);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->x.get(), this->dense_x.get(), this->col_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyTransposedRectangular)
+{
+    this->init_rectangular(100, 60, 3);
+
+    this->dist_mat_large->apply_transposed(this->y, this->x);
+    this->csr_mat->transpose()->apply(this->dense_y, this->dense_x);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->x.get(), this->dense_x.get(), this->col_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanAdvancedApplyTransposedRectangular)
+{
+    this->init_rectangular(60, 100, 3);
+
+    this->dist_mat_large->apply_transposed(this->alpha, this->y, this->beta,
+                                           this->x);
+    this->csr_mat->transpose()->apply(this->alpha, this->dense_y, this->beta,
+                                      this->dense_x);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->x.get(), this->dense_x.get(), this->col_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyTransposedAfterReadingAgain)
+{
+    this->init_rectangular(100, 60, 3);
+    // creates the transposed local matrices for the first matrix
+    this->dist_mat_large->apply_transposed(this->y, this->x);
+    this->init_rectangular(100, 60, 3);
+
+    this->dist_mat_large->apply_transposed(this->y, this->x);
+    this->csr_mat->transpose()->apply(this->dense_y, this->dense_x);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->x.get(), this->dense_x.get(), this->col_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyWithInteriorRows)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    using part_type = typename TestFixture::part_type;
+    // tridiagonal matrix with three rows per rank, so the middle row of each
+    // rank does not depend on non-local values
+    gko::matrix_data<value_type, index_type> mat_md{gko::dim<2>{9, 9}};
+    for (index_type row = 0; row < 9; ++row) {
+        for (auto col : {row - 1, row, row + 1}) {
+            if (col >= 0 && col < 9) {
+                mat_md.nonzeros.emplace_back(row, col, row * 9 + col + 1);
+            }
+        }
+    }
+    auto vec_md = gko::test::generate_random_matrix_data<value_type,
+                                                         index_type>(
+        9, 2, std::uniform_int_distribution<int>(2, 2),
+        std::normal_distribution<gko::remove_complex<value_type>>(),
+        this->engine);
+    auto part = gko::share(part_type::build_from_contiguous(
+        this->exec,
+        gko::array<index_type>(this->exec, I<index_type>{0, 3, 6, 9})));
+    this->dist_mat->read_distributed(mat_md, part);
+    this->csr_mat->read(mat_md);
+    this->x->read_distributed(vec_md, part);
+    this->dense_x->read(vec_md);
+    this->y->read_distributed(vec_md, part);
+    this->dense_y->read(vec_md);
+    auto copy = gko::clone(this->dist_mat);
+
+    copy->apply(this->alpha, this->x, this->beta, this->y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta,
+                         this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), part.get(), this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, SharedMemoryHaloRequiresHostExecutor)
+{
+    if (this->exec == this->exec->get_master()) {
+        this->dist_mat->set_shared_memory_halo(true);
+
+        ASSERT_TRUE(this->dist_mat->get_shared_memory_halo());
+    } else {
+        ASSERT_THROW(this->dist_mat->set_shared_memory_halo(true),
+                     gko::NotSupported);
+        ASSERT_FALSE(this->dist_mat->get_shared_memory_halo());
+    }
+}
+
+
+TYPED_TEST(Matrix, CanApplyWithSharedMemoryHalo)
+{
+    if (this->exec != this->exec->get_master()) {
+        GTEST_SKIP() << "shared-memory halos require a host executor";
+    }
+    this->init_large(100, 17);
+    this->dist_mat_large->set_shared_memory_halo(true);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanAdvancedApplyWithSharedMemoryHalo)
+{
+    if (this->exec != this->exec->get_master()) {
+        GTEST_SKIP() << "shared-memory halos require a host executor";
+    }
+    this->init_large(100, 17);
+    this->dist_mat_large->set_shared_memory_halo(true);
+
+    this->dist_mat_large->apply(this->alpha, this->x, this->beta, this->y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyWithSharedMemoryHaloRepeatedly)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    if (this->exec != this->exec->get_master()) {
+        GTEST_SKIP() << "shared-memory halos require a host executor";
+    }
+    this->init_large(100, 17);
+    this->dist_mat_large->set_shared_memory_halo(true);
+    // the first apply allocates the shared memory for 17 columns
+    this->dist_mat_large->apply(this->x, this->y);
+    auto vec_md = gko::test::generate_random_matrix_data<value_type,
+                                                         index_type>(
+        100, 1, std::uniform_int_distribution<int>(1, 1),
+        std::normal_distribution<gko::remove_complex<value_type>>(),
+        this->engine);
+    this->x->read_distributed(vec_md, this->col_part_large);
+    this->dense_x->read(vec_md);
+    this->y->read_distributed(vec_md, this->row_part_large);
+    this->dense_y->read(vec_md);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->dist_mat_large->apply(this->alpha, this->x, this->beta, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta,
+                         this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CopyKeepsSharedMemoryHalo)
+{
+    if (this->exec != this->exec->get_master()) {
+        GTEST_SKIP() << "shared-memory halos require a host executor";
+    }
+    this->init_large(100, 3);
+    this->dist_mat_large->set_shared_memory_halo(true);
+    this->dist_mat_large->apply(this->x, this->y);
+
+    auto copy = gko::clone(this->dist_mat_large);
+    copy->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    ASSERT_TRUE(copy->get_shared_memory_halo());
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
 TYPED_TEST(Matrix, CanConvertToNextPrecision)
 {
     using T = typename TestFixture::value_type;
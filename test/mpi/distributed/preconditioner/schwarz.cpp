@@ -266,3 +266,149 @@ TYPED_TEST(SchwarzPreconditioner, CanAdvancedApplyPreconditioner)
     this->assert_equal_to_non_distributed_vector(this->dist_x,
                                                  this->non_dist_x);
 }
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionerWithOverlap)
+{
+    using value_type = typename TestFixture::value_type;
+    using vec = typename TestFixture::local_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto exact_solver_factory = gko::share(
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec));
+
+    auto precond = prec::build()
+                       .with_local_solver_factory(exact_solver_factory)
+                       .with_overlap(1u)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    precond->apply(this->dist_b, this->dist_x);
+
+    // each rank solves the 1D Laplacian on its subdomain extended by one
+    // neighbor on each side and keeps the values of its own unknowns
+    auto expected = gko::share(gko::initialize<vec>(
+        {-1.5, -2.0, -3.0, -3.0, -4.0, -4.5, -4.0, -2.5}, this->exec));
+    this->assert_equal_to_non_distributed_vector(this->dist_x, expected);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, FullOverlapIsExactInverse)
+{
+    using value_type = typename TestFixture::value_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto exact_solver_factory = gko::share(
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec));
+    auto residual = gko::clone(this->dist_b);
+
+    auto precond = prec::build()
+                       .with_local_solver_factory(exact_solver_factory)
+                       .with_overlap(8u)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    precond->apply(this->dist_b, this->dist_x);
+    this->dist_mat->apply(this->dist_x, residual);
+
+    GKO_ASSERT_MTX_NEAR(residual->get_local_vector(),
+                        this->dist_b->get_local_vector(),
+                        10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionerWithCoarseCorrection)
+{
+    using vec = typename TestFixture::local_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+
+    auto precond = prec::build()
+                       .with_local_solver_factory(this->local_solver_factory)
+                       .with_coarse_correction(true)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    precond->apply(this->dist_b, this->dist_x);
+
+    // the Jacobi part contributes -0.5, the coarse matrix of the three
+    // aggregates is [2 -1 0; -1 2 -1; 0 -1 2] with right-hand side
+    // [-2 -2 -4], which has the solution [-3.5 -5 -4.5]
+    auto expected = gko::share(gko::initialize<vec>(
+        {-4.0, -4.0, -5.5, -5.5, -5.0, -5.0, -5.0, -5.0}, this->exec));
+    this->assert_equal_to_non_distributed_vector(this->dist_x, expected);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionerWithUserCoarseSpace)
+{
+    using value_type = typename TestFixture::value_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    using vec = typename TestFixture::local_vec_type;
+    using dist_vec = typename TestFixture::dist_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+    // the indicator vectors of the subdomains span the same coarse space as
+    // one aggregate per rank
+    gko::matrix_data<value_type, global_index_type> coarse_data{
+        gko::dim<2>{8, 3},
+        {{0, 0, 1}, {1, 0, 1}, {2, 1, 1}, {3, 1, 1}, {4, 2, 1}, {5, 2, 1},
+         {6, 2, 1}, {7, 2, 1}}};
+    auto coarse_space = gko::share(dist_vec::create(this->exec, this->comm));
+    coarse_space->read_distributed(coarse_data, this->row_part);
+
+    auto precond = prec::build()
+                       .with_local_solver_factory(this->local_solver_factory)
+                       .with_coarse_space(coarse_space)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    precond->apply(this->dist_b, this->dist_x);
+
+    auto expected = gko::share(gko::initialize<vec>(
+        {-4.0, -4.0, -5.5, -5.5, -5.0, -5.0, -5.0, -5.0}, this->exec));
+    this->assert_equal_to_non_distributed_vector(this->dist_x, expected);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionedSolverWithOverlap)
+{
+    using value_type = typename TestFixture::value_type;
+    using solver = typename TestFixture::solver_type;
+    using prec = typename TestFixture::dist_prec_type;
+    constexpr double tolerance = 1e-20;
+    auto iter_stop = gko::share(
+        gko::stop::Iteration::build().with_max_iters(200u).on(this->exec));
+    auto tol_stop = gko::share(
+        gko::stop::ResidualNorm<value_type>::build()
+            .with_reduction_factor(
+                static_cast<gko::remove_complex<value_type>>(tolerance))
+            .on(this->exec));
+    auto non_dist_solver = solver::build()
+                               .with_criteria(iter_stop, tol_stop)
+                               .on(this->exec)
+                               ->generate(this->non_dist_mat);
+    auto dist_solver =
+        solver::build()
+            .with_preconditioner(
+                prec::build()
+                    .with_local_solver_factory(this->local_solver_factory)
+                    .with_overlap(2u)
+                    .with_coarse_correction(true)
+                    .on(this->exec))
+            .with_criteria(iter_stop, tol_stop)
+            .on(this->exec)
+            ->generate(this->dist_mat);
+
+    dist_solver->apply(this->dist_b, this->dist_x);
+    non_dist_solver->apply(this->non_dist_b, this->non_dist_x);
+
+    this->assert_equal_to_non_distributed_vector(this->dist_x,
+                                                 this->non_dist_x);
+}
@@ -598,6 +598,49 @@ TYPED_TEST(VectorReductions, ComputeConjDotProductWithTmpIsSameAsDense)
 }
 
 
+TYPED_TEST(VectorReductions, ComputeConjDotsIsSameAsDense)
+{
+    using dense_type = typename TestFixture::dense_type;
+    using dist_vec_type = typename TestFixture::dist_vec_type;
+    using value_type = typename TestFixture::value_type;
+    this->init_result();
+    auto res2 = dense_type::create(this->exec, gko::dim<2>{1, this->size[1]});
+    auto dense_res2 = gko::clone(res2);
+
+    dist_vec_type::compute_conj_dots(
+        {{this->x.get(), this->y.get()}, {this->y.get(), this->y.get()}},
+        {this->res.get(), res2.get()}, this->tmp);
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_y->compute_conj_dot(this->dense_y, dense_res2);
+
+    GKO_ASSERT_MTX_NEAR(this->res, this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(res2, dense_res2, r<value_type>::value);
+}
+
+
+TYPED_TEST(VectorReductions, NonBlockingComputeConjDotsIsSameAsDense)
+{
+    using dense_type = typename TestFixture::dense_type;
+    using dist_vec_type = typename TestFixture::dist_vec_type;
+    using value_type = typename TestFixture::value_type;
+    this->init_result();
+    auto res = dense_type::create(this->exec, gko::dim<2>{2, this->size[1]});
+    auto dense_res2 = gko::clone(this->dense_res);
+
+    auto req = dist_vec_type::i_compute_conj_dots(
+        {{this->x.get(), this->y.get()}, {this->x.get(), this->x.get()}},
+        res);
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_x->compute_conj_dot(this->dense_x, dense_res2);
+    req.wait();
+
+    GKO_ASSERT_MTX_NEAR(res->create_submatrix({0, 1}, {0, this->size[1]}),
+                        this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(res->create_submatrix({1, 2}, {0, this->size[1]}),
+                        dense_res2, r<value_type>::value);
+}
+
+
 TYPED_TEST(VectorReductions, ComputeNorm2IsSameAsDense)
 {
     using value_type = typename TestFixture::value_type;
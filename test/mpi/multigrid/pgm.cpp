@@ -0,0 +1,262 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/mpi/executor.hpp"
+
+
+#ifndef GKO_COMPILING_DPCPP
+
+
+template <typename ValueLocalGlobalIndexType>
+class Pgm : public CommonMpiTestFixture {
+protected:
+    using value_type = typename std::tuple_element<
+        0, decltype(ValueLocalGlobalIndexType())>::type;
+    using local_index_type = typename std::tuple_element<
+        1, decltype(ValueLocalGlobalIndexType())>::type;
+    using global_index_type = typename std::tuple_element<
+        2, decltype(ValueLocalGlobalIndexType())>::type;
+    using dist_mtx_type =
+        gko::experimental::distributed::Matrix<value_type, local_index_type,
+                                               global_index_type>;
+    using dist_vec_type = gko::experimental::distributed::Vector<value_type>;
+    using dense_vec_type = gko::matrix::Dense<value_type>;
+    using partition_type =
+        gko::experimental::distributed::Partition<local_index_type,
+                                                  global_index_type>;
+    using pgm_type = gko::multigrid::Pgm<value_type, local_index_type>;
+    using matrix_data = gko::matrix_data<value_type, global_index_type>;
+
+    Pgm() : grid_size{8}, engine(42)
+    {
+        const auto num_rows = grid_size * grid_size;
+        part = gko::share(partition_type::build_from_global_size_uniform(
+            exec, comm.size(), num_rows));
+        dist_mat = gko::share(dist_mtx_type::create(exec, comm));
+        dist_mat->read_distributed(gen_laplacian(1.0), part);
+    }
+
+    void SetUp() override { ASSERT_EQ(comm.size(), 3); }
+
+    // 5-point stencil on a grid_size x grid_size grid
+    matrix_data gen_laplacian(gko::remove_complex<value_type> scale)
+    {
+        const auto num_rows = grid_size * grid_size;
+        matrix_data data{gko::dim<2>{static_cast<gko::size_type>(num_rows),
+                                     static_cast<gko::size_type>(num_rows)}};
+        for (global_index_type y = 0; y < grid_size; y++) {
+            for (global_index_type x = 0; x < grid_size; x++) {
+                const auto row = y * grid_size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - grid_size, -scale);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -scale);
+                }
+                data.nonzeros.emplace_back(row, row, 4 * scale);
+                if (x < grid_size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -scale);
+                }
+                if (y < grid_size - 1) {
+                    data.nonzeros.emplace_back(row, row + grid_size, -scale);
+                }
+            }
+        }
+        return data;
+    }
+
+    std::unique_ptr<dist_vec_type> gen_vec(
+        std::shared_ptr<const partition_type> vec_part)
+    {
+        auto vec = dist_vec_type::create(exec, comm);
+        vec->read_distributed(
+            gko::test::generate_random_matrix_data<value_type,
+                                                   global_index_type>(
+                vec_part->get_size(), 1,
+                std::uniform_int_distribution<int>(1, 1),
+                std::normal_distribution<gko::remove_complex<value_type>>(),
+                engine),
+            vec_part);
+        return vec;
+    }
+
+    std::unique_ptr<dist_vec_type> gen_empty_vec(
+        std::shared_ptr<const partition_type> vec_part)
+    {
+        return dist_vec_type::create(
+            exec, comm, gko::dim<2>{vec_part->get_size(), 1},
+            gko::dim<2>{static_cast<gko::size_type>(
+                            vec_part->get_part_size(comm.rank())),
+                        1});
+    }
+
+    void assert_galerkin_product(const pgm_type* pgm,
+                                 const dist_mtx_type* fine)
+    {
+        auto coarse = gko::as<dist_mtx_type>(pgm->get_coarse_op());
+        auto coarse_part = coarse->get_row_partition();
+        auto x = gen_vec(coarse_part);
+        auto fine_x = gen_empty_vec(part);
+        auto fine_y = gen_empty_vec(part);
+        auto result = gen_empty_vec(coarse_part);
+        auto expected = gen_empty_vec(coarse_part);
+
+        coarse->apply(x, result);
+        pgm->get_prolong_op()->apply(x, fine_x);
+        fine->apply(fine_x, fine_y);
+        pgm->get_restrict_op()->apply(fine_y, expected);
+
+        GKO_ASSERT_MTX_NEAR(result->get_local_vector(),
+                            expected->get_local_vector(),
+                            r<value_type>::value);
+    }
+
+    global_index_type grid_size;
+    std::shared_ptr<partition_type> part;
+    std::shared_ptr<dist_mtx_type> dist_mat;
+    std::default_random_engine engine;
+};
+
+TYPED_TEST_SUITE(Pgm, gko::test::ValueLocalGlobalIndexTypes,
+                 TupleTypenameNameGenerator);
+
+
+TYPED_TEST(Pgm, GeneratesDistributedLevel)
+{
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+
+    auto pgm = TestFixture::pgm_type::build().on(this->exec)->generate(
+        this->dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(pgm->get_coarse_op());
+    auto coarse_part = coarse->get_row_partition();
+    ASSERT_EQ(pgm->get_fine_op(), this->dist_mat);
+    ASSERT_LT(coarse->get_size()[0], this->dist_mat->get_size()[0]);
+    ASSERT_EQ(coarse_part->get_num_parts(), this->comm.size());
+    for (int rank = 0; rank < this->comm.size(); rank++) {
+        // the aggregates never cross rank boundaries
+        ASSERT_GT(coarse_part->get_part_size(rank), 0);
+        ASSERT_LE(coarse_part->get_part_size(rank),
+                  this->part->get_part_size(rank));
+    }
+}
+
+
+TYPED_TEST(Pgm, CoarseOperatorIsGalerkinProduct)
+{
+    auto pgm = TestFixture::pgm_type::build().on(this->exec)->generate(
+        this->dist_mat);
+
+    this->assert_galerkin_product(pgm.get(), this->dist_mat.get());
+}
+
+
+TYPED_TEST(Pgm, RestrictionIsTransposedProlongation)
+{
+    using dense_vec_type = typename TestFixture::dense_vec_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    using value_type = typename TestFixture::value_type;
+    auto pgm = TestFixture::pgm_type::build().on(this->exec)->generate(
+        this->dist_mat);
+    auto coarse_part =
+        gko::as<dist_mtx_type>(pgm->get_coarse_op())->get_row_partition();
+    auto coarse_x = this->gen_vec(coarse_part);
+    auto fine_x = this->gen_vec(this->part);
+    auto prolonged = this->gen_empty_vec(this->part);
+    auto restricted = this->gen_empty_vec(coarse_part);
+    auto result = dense_vec_type::create(this->exec, gko::dim<2>{1, 1});
+    auto expected = dense_vec_type::create(this->exec, gko::dim<2>{1, 1});
+
+    pgm->get_prolong_op()->apply(coarse_x, prolonged);
+    pgm->get_restrict_op()->apply(fine_x, restricted);
+    coarse_x->compute_dot(restricted, result);
+    prolonged->compute_dot(fine_x, expected);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, AgglomeratesSmallCoarseLevel)
+{
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+
+    auto pgm = TestFixture::pgm_type::build()
+                   .with_min_coarse_rows_per_rank(1000u)
+                   .on(this->exec)
+                   ->generate(this->dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(pgm->get_coarse_op());
+    auto coarse_part = coarse->get_row_partition();
+    ASSERT_EQ(coarse_part->get_part_size(0), coarse->get_size()[0]);
+    ASSERT_EQ(coarse_part->get_part_size(1), 0);
+    ASSERT_EQ(coarse_part->get_part_size(2), 0);
+    this->assert_galerkin_product(pgm.get(), this->dist_mat.get());
+}
+
+
+TYPED_TEST(Pgm, UpdatesValuesOfDistributedLevel)
+{
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    auto pgm = TestFixture::pgm_type::build().on(this->exec)->generate(
+        this->dist_mat);
+    auto prolong = pgm->get_prolong_op();
+    auto restrict_op = pgm->get_restrict_op();
+    auto scaled_mat = gko::share(dist_mtx_type::create(this->exec, this->comm));
+    scaled_mat->read_distributed(this->gen_laplacian(2.0), this->part);
+
+    pgm->update_values(scaled_mat);
+
+    ASSERT_EQ(pgm->get_fine_op(), scaled_mat);
+    ASSERT_EQ(pgm->get_prolong_op(), prolong);
+    ASSERT_EQ(pgm->get_restrict_op(), restrict_op);
+    this->assert_galerkin_product(pgm.get(), scaled_mat.get());
+}
+
+
+#endif
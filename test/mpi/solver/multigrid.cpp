@@ -0,0 +1,194 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/mpi/executor.hpp"
+
+
+#ifndef GKO_COMPILING_DPCPP
+
+
+#if GINKGO_DPCPP_SINGLE_MODE
+using solver_value_type = float;
+#else
+using solver_value_type = double;
+#endif  // GINKGO_DPCPP_SINGLE_MODE
+
+
+class Multigrid : public CommonMpiTestFixture {
+protected:
+    using value_type = solver_value_type;
+    using local_index_type = gko::int32;
+    using global_index_type = gko::int64;
+    using dist_mtx_type =
+        gko::experimental::distributed::Matrix<value_type, local_index_type,
+                                               global_index_type>;
+    using dist_vec_type = gko::experimental::distributed::Vector<value_type>;
+    using norm_type = gko::matrix::Dense<gko::remove_complex<value_type>>;
+    using partition_type =
+        gko::experimental::distributed::Partition<local_index_type,
+                                                  global_index_type>;
+    using pgm_type = gko::multigrid::Pgm<value_type, local_index_type>;
+    using mg_type = gko::solver::Multigrid;
+
+    Multigrid() : grid_size{16}
+    {
+        const auto num_rows = grid_size * grid_size;
+        part = gko::share(partition_type::build_from_global_size_uniform(
+            exec, comm.size(), num_rows));
+        // 5-point stencil on a grid_size x grid_size grid
+        gko::matrix_data<value_type, global_index_type> data{
+            gko::dim<2>{static_cast<gko::size_type>(num_rows),
+                        static_cast<gko::size_type>(num_rows)}};
+        for (global_index_type y = 0; y < grid_size; y++) {
+            for (global_index_type x = 0; x < grid_size; x++) {
+                const auto row = y * grid_size + x;
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - grid_size, -1.0);
+                }
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (x < grid_size - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (y < grid_size - 1) {
+                    data.nonzeros.emplace_back(row, row + grid_size, -1.0);
+                }
+            }
+        }
+        mtx = gko::share(dist_mtx_type::create(exec, comm));
+        mtx->read_distributed(data, part);
+        const auto local_size = gko::dim<2>{
+            static_cast<gko::size_type>(part->get_part_size(comm.rank())), 1};
+        const auto global_size = gko::dim<2>{mtx->get_size()[0], 1};
+        b = dist_vec_type::create(exec, comm, global_size, local_size);
+        b->fill(gko::one<value_type>());
+        x = dist_vec_type::create(exec, comm, global_size, local_size);
+        x->fill(gko::zero<value_type>());
+    }
+
+    void SetUp() override { ASSERT_EQ(comm.size(), 3); }
+
+    void assert_converged()
+    {
+        auto one = gko::initialize<gko::matrix::Dense<value_type>>({1.0}, exec);
+        auto neg_one =
+            gko::initialize<gko::matrix::Dense<value_type>>({-1.0}, exec);
+        auto res = gko::clone(b);
+        auto res_norm = norm_type::create(exec, gko::dim<2>{1, 1});
+        auto b_norm = norm_type::create(exec, gko::dim<2>{1, 1});
+        mtx->apply(neg_one, x, one, res);
+        res->compute_norm2(res_norm);
+        b->compute_norm2(b_norm);
+        ASSERT_LT(exec->copy_val_to_host(res_norm->get_const_values()),
+                  reduction_factor() *
+                      exec->copy_val_to_host(b_norm->get_const_values()));
+    }
+
+    static constexpr gko::remove_complex<value_type> reduction_factor()
+    {
+        return 1e-4;
+    }
+
+    std::unique_ptr<mg_type::Factory> build_solver(
+        gko::size_type min_coarse_rows_per_rank)
+    {
+        return mg_type::build()
+            .with_mg_level(
+                pgm_type::build()
+                    .with_deterministic(true)
+                    .with_min_coarse_rows_per_rank(min_coarse_rows_per_rank)
+                    .on(exec))
+            .with_max_levels(3u)
+            .with_min_coarse_rows(8u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(reduction_factor())
+                    .on(exec))
+            .on(exec);
+    }
+
+    global_index_type grid_size;
+    std::shared_ptr<partition_type> part;
+    std::shared_ptr<dist_mtx_type> mtx;
+    std::unique_ptr<dist_vec_type> b;
+    std::unique_ptr<dist_vec_type> x;
+};
+
+
+TEST_F(Multigrid, SolvesWithDistributedPgm)
+{
+    auto solver = build_solver(0u)->generate(mtx);
+
+    solver->apply(b, x);
+
+    ASSERT_GT(solver->get_mg_level_list().size(), 0);
+    assert_converged();
+}
+
+
+TEST_F(Multigrid, SolvesWithAgglomeratedCoarseLevel)
+{
+    auto solver = build_solver(1000u)->generate(mtx);
+
+    solver->apply(b, x);
+
+    auto coarsest = gko::as<dist_mtx_type>(
+        solver->get_mg_level_list().back()->get_coarse_op());
+    ASSERT_EQ(coarsest->get_row_partition()->get_part_size(0),
+              coarsest->get_size()[0]);
+    assert_converged();
+}
+
+
+#endif
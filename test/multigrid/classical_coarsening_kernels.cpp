@@ -0,0 +1,161 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/classical_coarsening_kernels.hpp"
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/multigrid/classical_coarsening.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "core/test/utils/unsort_matrix.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class ClassicalCoarsening : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    ClassicalCoarsening() : rand_engine(42)
+    {
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                num_rows, num_rows, std::uniform_int_distribution<>(2, 10),
+                std::normal_distribution<>(-1.0, 1.0), rand_engine);
+        gko::utils::make_symmetric(data);
+        gko::utils::make_diag_dominant(data);
+        mtx = gko::share(Csr::create(ref));
+        mtx->read(data);
+        d_mtx = gko::clone(exec, mtx);
+        strength = Csr::create(ref, mtx->get_size());
+        gko::kernels::reference::classical_coarsening::compute_strength(
+            ref, mtx.get(), 0.25, strength.get());
+        strength_transposed = gko::as<Csr>(strength->transpose());
+        d_strength = gko::clone(exec, strength);
+        d_strength_transposed = gko::clone(exec, strength_transposed);
+    }
+
+    std::default_random_engine rand_engine;
+    const gko::size_type num_rows = 1234;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    std::unique_ptr<Csr> strength;
+    std::unique_ptr<Csr> strength_transposed;
+    std::unique_ptr<Csr> d_strength;
+    std::unique_ptr<Csr> d_strength_transposed;
+};
+
+
+TEST_F(ClassicalCoarsening, ComputeStrengthIsEquivalentToRef)
+{
+    auto d_result = Csr::create(exec, mtx->get_size());
+
+    gko::kernels::EXEC_NAMESPACE::classical_coarsening::compute_strength(
+        exec, d_mtx.get(), 0.25, d_result.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_result, strength);
+    GKO_ASSERT_MTX_NEAR(d_result, strength, 0.0);
+}
+
+
+TEST_F(ClassicalCoarsening, SelectCoarsePointsIsEquivalentToRef)
+{
+    gko::array<index_type> coarse_map(ref, num_rows);
+    gko::array<index_type> d_coarse_map(exec, num_rows);
+    index_type num_coarse{};
+    index_type d_num_coarse{};
+
+    gko::kernels::reference::classical_coarsening::select_coarse_points(
+        ref, strength.get(), strength_transposed.get(), coarse_map,
+        &num_coarse);
+    gko::kernels::EXEC_NAMESPACE::classical_coarsening::select_coarse_points(
+        exec, d_strength.get(), d_strength_transposed.get(), d_coarse_map,
+        &d_num_coarse);
+
+    ASSERT_EQ(d_num_coarse, num_coarse);
+    GKO_ASSERT_ARRAY_EQ(d_coarse_map, coarse_map);
+}
+
+
+TEST_F(ClassicalCoarsening, ComputeInterpolationIsEquivalentToRef)
+{
+    gko::array<index_type> coarse_map(ref, num_rows);
+    index_type num_coarse{};
+    gko::kernels::reference::classical_coarsening::select_coarse_points(
+        ref, strength.get(), strength_transposed.get(), coarse_map,
+        &num_coarse);
+    gko::array<index_type> d_coarse_map(exec, coarse_map);
+    const gko::dim<2> size{num_rows, static_cast<gko::size_type>(num_coarse)};
+    auto prolongator = Csr::create(ref, size);
+    auto d_prolongator = Csr::create(exec, size);
+
+    gko::kernels::reference::classical_coarsening::compute_interpolation(
+        ref, mtx.get(), strength.get(), coarse_map, prolongator.get());
+    gko::kernels::EXEC_NAMESPACE::classical_coarsening::compute_interpolation(
+        exec, d_mtx.get(), d_strength.get(), d_coarse_map,
+        d_prolongator.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_prolongator, prolongator);
+    GKO_ASSERT_MTX_NEAR(d_prolongator, prolongator, r<value_type>::value);
+}
+
+
+TEST_F(ClassicalCoarsening, GenerateMgLevelIsEquivalentToRefOnUnsortedMatrix)
+{
+    gko::test::unsort_matrix(mtx, rand_engine);
+    d_mtx = gko::clone(exec, mtx);
+    using MgLevel = gko::multigrid::ClassicalCoarsening<value_type, index_type>;
+
+    auto mg_level = MgLevel::build().on(ref)->generate(mtx);
+    auto d_mg_level = MgLevel::build().on(exec)->generate(d_mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_prolong_op()),
+                        gko::as<Csr>(mg_level->get_prolong_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_restrict_op()),
+                        gko::as<Csr>(mg_level->get_restrict_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_coarse_op()),
+                        gko::as<Csr>(mg_level->get_coarse_op()),
+                        r<value_type>::value);
+}
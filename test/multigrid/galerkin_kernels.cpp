@@ -0,0 +1,117 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/galerkin_kernels.hpp"
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Galerkin : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    Galerkin() : rand_engine(42)
+    {
+        mtx = gen_mtx(num_rows, num_rows, 10);
+        prolongator = gen_mtx(num_rows, num_coarse, 3);
+        restriction = gko::as<Csr>(prolongator->transpose());
+        d_mtx = gko::clone(exec, mtx);
+        d_prolongator = gko::clone(exec, prolongator);
+        d_restriction = gko::clone(exec, restriction);
+    }
+
+    std::unique_ptr<Csr> gen_mtx(gko::size_type num_rows,
+                                 gko::size_type num_cols,
+                                 int max_row_nnz)
+    {
+        return gko::test::generate_random_matrix<Csr>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(0, max_row_nnz),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    std::default_random_engine rand_engine;
+    const gko::size_type num_rows = 1234;
+    const gko::size_type num_coarse = 345;
+    std::unique_ptr<Csr> mtx;
+    std::unique_ptr<Csr> prolongator;
+    std::unique_ptr<Csr> restriction;
+    std::unique_ptr<Csr> d_mtx;
+    std::unique_ptr<Csr> d_prolongator;
+    std::unique_ptr<Csr> d_restriction;
+};
+
+
+TEST_F(Galerkin, ComputeRapSymbolicIsEquivalentToRef)
+{
+    auto coarse = Csr::create(ref, gko::dim<2>{num_coarse, num_coarse});
+    auto d_coarse = Csr::create(exec, gko::dim<2>{num_coarse, num_coarse});
+
+    gko::kernels::reference::galerkin::compute_rap_symbolic(
+        ref, restriction.get(), mtx.get(), prolongator.get(), coarse.get());
+    gko::kernels::EXEC_NAMESPACE::galerkin::compute_rap_symbolic(
+        exec, d_restriction.get(), d_mtx.get(), d_prolongator.get(),
+        d_coarse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_coarse, coarse);
+}
+
+
+TEST_F(Galerkin, ComputeRapNumericIsEquivalentToRef)
+{
+    auto coarse = Csr::create(ref, gko::dim<2>{num_coarse, num_coarse});
+    gko::kernels::reference::galerkin::compute_rap_symbolic(
+        ref, restriction.get(), mtx.get(), prolongator.get(), coarse.get());
+    auto d_coarse = gko::clone(exec, coarse);
+
+    gko::kernels::reference::galerkin::compute_rap_numeric(
+        ref, restriction.get(), mtx.get(), prolongator.get(), coarse.get());
+    gko::kernels::EXEC_NAMESPACE::galerkin::compute_rap_numeric(
+        exec, d_restriction.get(), d_mtx.get(), d_prolongator.get(),
+        d_coarse.get());
+
+    GKO_ASSERT_MTX_NEAR(d_coarse, coarse, r<value_type>::value);
+}
@@ -33,9 +33,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/multigrid/pgm_kernels.hpp"
 
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
 #include <random>
 #include <string>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -271,6 +274,64 @@ TEST_F(Pgm, AssignToExistAggUnderteminsticIsEquivalentToRef)
 }
 
 
+TEST_F(Pgm, SortAggIsEquivalentToRef)
+{
+    initialize_data();
+    // large enough to be sorted in parallel
+    const index_type num = 100000;
+    auto row_idxs = gen_array(num, 0, 1000);
+    auto col_idxs = gen_array(num, 0, num - 1);
+    auto d_row_idxs = gko::array<index_type>(exec, row_idxs);
+    auto d_col_idxs = gko::array<index_type>(exec, col_idxs);
+
+    gko::kernels::reference::pgm::sort_agg(ref, num, row_idxs.get_data(),
+                                           col_idxs.get_data());
+    gko::kernels::EXEC_NAMESPACE::pgm::sort_agg(
+        exec, num, d_row_idxs.get_data(), d_col_idxs.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(d_row_idxs, row_idxs);
+    GKO_ASSERT_ARRAY_EQ(d_col_idxs, col_idxs);
+}
+
+
+TEST_F(Pgm, ComputeCoarseCsrIsEquivalentToRef)
+{
+    initialize_data();
+    index_type num_agg;
+    gko::kernels::reference::pgm::renumber(ref, agg, &num_agg);
+    // group the fine rows by aggregate
+    gko::array<index_type> agg_ptrs(ref, num_agg + 1);
+    gko::array<index_type> agg_rows(ref, m);
+    std::fill_n(agg_ptrs.get_data(), num_agg + 1, 0);
+    for (gko::size_type row = 0; row < m; row++) {
+        agg_ptrs.get_data()[agg.get_const_data()[row] + 1]++;
+    }
+    std::partial_sum(agg_ptrs.get_data(), agg_ptrs.get_data() + num_agg + 1,
+                     agg_ptrs.get_data());
+    std::vector<index_type> agg_pos(agg_ptrs.get_const_data(),
+                                    agg_ptrs.get_const_data() + num_agg);
+    for (gko::size_type row = 0; row < m; row++) {
+        agg_rows.get_data()[agg_pos[agg.get_const_data()[row]]++] = row;
+    }
+    d_agg = gko::array<index_type>(exec, agg);
+    auto d_agg_ptrs = gko::array<index_type>(exec, agg_ptrs);
+    auto d_agg_rows = gko::array<index_type>(exec, agg_rows);
+    auto coarse = Csr::create(ref, gko::dim<2>(num_agg));
+    auto d_coarse = Csr::create(exec, gko::dim<2>(num_agg));
+
+    gko::kernels::reference::pgm::compute_coarse_csr(
+        ref, system_mtx.get(), agg.get_const_data(), agg_ptrs.get_const_data(),
+        agg_rows.get_const_data(), coarse.get());
+    gko::kernels::EXEC_NAMESPACE::pgm::compute_coarse_csr(
+        exec, d_system_mtx.get(), d_agg.get_const_data(),
+        d_agg_ptrs.get_const_data(), d_agg_rows.get_const_data(),
+        d_coarse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_coarse, coarse);
+    GKO_ASSERT_MTX_NEAR(d_coarse, coarse, r<value_type>::value);
+}
+
+
 TEST_F(Pgm, GenerateMgLevelIsEquivalentToRef)
 {
     initialize_data();
@@ -0,0 +1,150 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/multigrid/smoothed_aggregation_kernels.hpp"
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/multigrid/smoothed_aggregation.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "core/test/utils/unsort_matrix.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class SmoothedAggregation : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    SmoothedAggregation() : rand_engine(42)
+    {
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                num_rows, num_rows, std::uniform_int_distribution<>(2, 10),
+                std::normal_distribution<>(-1.0, 1.0), rand_engine);
+        gko::utils::make_symmetric(data);
+        gko::utils::make_diag_dominant(data);
+        mtx = gko::share(Csr::create(ref));
+        mtx->read(data);
+        d_mtx = gko::clone(exec, mtx);
+    }
+
+    std::default_random_engine rand_engine;
+    const gko::size_type num_rows = 1234;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+};
+
+
+TEST_F(SmoothedAggregation, FilterMatrixIsEquivalentToRef)
+{
+    auto filtered = Csr::create(ref, mtx->get_size());
+    auto d_filtered = Csr::create(exec, mtx->get_size());
+
+    gko::kernels::reference::smoothed_aggregation::filter_matrix(
+        ref, mtx.get(), 0.1, filtered.get());
+    gko::kernels::EXEC_NAMESPACE::smoothed_aggregation::filter_matrix(
+        exec, d_mtx.get(), 0.1, d_filtered.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_filtered, filtered);
+    GKO_ASSERT_MTX_NEAR(d_filtered, filtered, 0.0);
+}
+
+
+TEST_F(SmoothedAggregation, AggregateIsEquivalentToRef)
+{
+    gko::array<index_type> agg(ref, num_rows);
+    gko::array<index_type> d_agg(exec, num_rows);
+    index_type num_agg{};
+    index_type d_num_agg{};
+
+    gko::kernels::reference::smoothed_aggregation::aggregate(ref, mtx.get(),
+                                                             agg, &num_agg);
+    gko::kernels::EXEC_NAMESPACE::smoothed_aggregation::aggregate(
+        exec, d_mtx.get(), d_agg, &d_num_agg);
+
+    ASSERT_EQ(d_num_agg, num_agg);
+    GKO_ASSERT_ARRAY_EQ(d_agg, agg);
+}
+
+
+TEST_F(SmoothedAggregation, ComputeProlongatorIsEquivalentToRef)
+{
+    gko::array<index_type> agg(ref, num_rows);
+    index_type num_agg{};
+    gko::kernels::reference::smoothed_aggregation::aggregate(ref, mtx.get(),
+                                                             agg, &num_agg);
+    gko::array<index_type> d_agg(exec, agg);
+    const gko::dim<2> size{num_rows, static_cast<gko::size_type>(num_agg)};
+    auto prolongator = Csr::create(ref, size);
+    auto d_prolongator = Csr::create(exec, size);
+
+    gko::kernels::reference::smoothed_aggregation::compute_prolongator(
+        ref, mtx.get(), agg, 4.0 / 3.0, prolongator.get());
+    gko::kernels::EXEC_NAMESPACE::smoothed_aggregation::compute_prolongator(
+        exec, d_mtx.get(), d_agg, 4.0 / 3.0, d_prolongator.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_prolongator, prolongator);
+    GKO_ASSERT_MTX_NEAR(d_prolongator, prolongator, r<value_type>::value);
+}
+
+
+TEST_F(SmoothedAggregation, GenerateMgLevelIsEquivalentToRefOnUnsortedMatrix)
+{
+    gko::test::unsort_matrix(mtx, rand_engine);
+    d_mtx = gko::clone(exec, mtx);
+    using MgLevel = gko::multigrid::SmoothedAggregation<value_type, index_type>;
+
+    auto mg_level = MgLevel::build().on(ref)->generate(mtx);
+    auto d_mg_level = MgLevel::build().on(exec)->generate(d_mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_prolong_op()),
+                        gko::as<Csr>(mg_level->get_prolong_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_restrict_op()),
+                        gko::as<Csr>(mg_level->get_restrict_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_coarse_op()),
+                        gko::as<Csr>(mg_level->get_coarse_op()),
+                        r<value_type>::value);
+}
@@ -0,0 +1,106 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/bilu_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/preconditioner/bilu.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/fb_matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Bilu : public CommonTestFixture {
+protected:
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using bilu_type = gko::preconditioner::Bilu<value_type, index_type>;
+
+    Bilu() : rand_engine(42)
+    {
+        const index_type num_block_rows = 97;
+        const int block_size = 3;
+        mtx = gko::share(gko::test::generate_random_fbcsr<value_type>(
+            ref, num_block_rows, num_block_rows, block_size, true, false,
+            rand_engine));
+        d_mtx = gko::share(gko::clone(exec, mtx));
+        b = gko::test::generate_random_matrix<Dense>(
+            num_block_rows * block_size, 3,
+            std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        d_b = gko::clone(exec, b);
+        x = Dense::create(ref, b->get_size());
+        d_x = Dense::create(exec, b->get_size());
+    }
+
+    std::default_random_engine rand_engine;
+    std::shared_ptr<Fbcsr> mtx;
+    std::shared_ptr<Fbcsr> d_mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> d_b;
+    std::unique_ptr<Dense> x;
+    std::unique_ptr<Dense> d_x;
+};
+
+
+TEST_F(Bilu, GenerateIsEquivalentToRef)
+{
+    auto bilu = bilu_type::build().on(ref)->generate(mtx);
+    auto d_bilu = bilu_type::build().on(exec)->generate(d_mtx);
+
+    GKO_ASSERT_MTX_NEAR(d_bilu->get_factors(), bilu->get_factors(),
+                        r<value_type>::value * 1e2);
+}
+
+
+TEST_F(Bilu, ApplyIsEquivalentToRef)
+{
+    auto bilu = bilu_type::build().on(ref)->generate(mtx);
+    auto d_bilu = bilu_type::build().on(exec)->generate(d_mtx);
+
+    bilu->apply(b, x);
+    d_bilu->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
@@ -0,0 +1,127 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/fsai_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/fsai.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Fsai : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using mtx_data = gko::matrix_data<value_type, index_type>;
+    using fsai_type = gko::preconditioner::Fsai<value_type, index_type>;
+
+    Fsai() : rand_engine(42)
+    {
+        const gko::size_type num_rows = 531;
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                num_rows, num_rows, std::uniform_int_distribution<>(2, 6),
+                std::normal_distribution<>(-1.0, 1.0), rand_engine);
+        // make the matrix symmetric and diagonally dominant
+        mtx_data spd_data{data.size};
+        std::vector<gko::remove_complex<value_type>> row_sums(num_rows);
+        for (const auto& entry : data.nonzeros) {
+            if (entry.row > entry.column) {
+                spd_data.nonzeros.emplace_back(entry.row, entry.column,
+                                               entry.value);
+                spd_data.nonzeros.emplace_back(entry.column, entry.row,
+                                               gko::conj(entry.value));
+                row_sums[entry.row] += gko::abs(entry.value);
+                row_sums[entry.column] += gko::abs(entry.value);
+            }
+        }
+        for (gko::size_type row = 0; row < num_rows; ++row) {
+            spd_data.nonzeros.emplace_back(row, row, row_sums[row] + 1.0);
+        }
+        spd_data.sum_duplicates();
+        mtx = gko::share(Csr::create(ref));
+        mtx->read(spd_data);
+        d_mtx = gko::share(gko::clone(exec, mtx));
+        b = gko::test::generate_random_matrix<Dense>(
+            num_rows, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        d_b = gko::clone(exec, b);
+        x = Dense::create(ref, b->get_size());
+        d_x = Dense::create(exec, b->get_size());
+    }
+
+    std::default_random_engine rand_engine;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> d_b;
+    std::unique_ptr<Dense> x;
+    std::unique_ptr<Dense> d_x;
+};
+
+
+TEST_F(Fsai, GenerateIsEquivalentToRef)
+{
+    auto fsai = fsai_type::build().with_tolerance(1e-4).on(ref)->generate(mtx);
+    auto d_fsai =
+        fsai_type::build().with_tolerance(1e-4).on(exec)->generate(d_mtx);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_fsai->get_lower_factor(),
+                               fsai->get_lower_factor());
+    GKO_ASSERT_MTX_NEAR(d_fsai->get_lower_factor(), fsai->get_lower_factor(),
+                        r<value_type>::value * 1e2);
+}
+
+
+TEST_F(Fsai, ApplyIsEquivalentToRef)
+{
+    auto fsai = fsai_type::build().on(ref)->generate(mtx);
+    auto d_fsai = fsai_type::build().on(exec)->generate(d_mtx);
+
+    fsai->apply(b, x);
+    d_fsai->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
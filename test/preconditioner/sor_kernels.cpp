@@ -0,0 +1,134 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/preconditioner/sor_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/gauss_seidel.hpp>
+#include <ginkgo/core/preconditioner/sor.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Sor : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using sor_type = gko::preconditioner::Sor<value_type, index_type>;
+    using gs_type = gko::preconditioner::GaussSeidel<value_type, index_type>;
+
+    Sor() : rand_engine(42)
+    {
+        const gko::size_type size = 531;
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                size, size, std::uniform_int_distribution<>(1, 10),
+                std::normal_distribution<>(-1.0, 1.0), rand_engine);
+        gko::utils::make_diag_dominant(data);
+        mtx = gko::share(Csr::create(ref));
+        mtx->read(data);
+        d_mtx = gko::share(gko::clone(exec, mtx));
+        b = gko::test::generate_random_matrix<Dense>(
+            size, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        d_b = gko::clone(exec, b);
+        x = Dense::create(ref, b->get_size());
+        d_x = Dense::create(exec, b->get_size());
+    }
+
+    std::default_random_engine rand_engine;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> d_b;
+    std::unique_ptr<Dense> x;
+    std::unique_ptr<Dense> d_x;
+};
+
+
+TEST_F(Sor, GenerateIsEquivalentToRef)
+{
+    auto sor = sor_type::build().with_relaxation_factor(1.3).on(ref)->generate(
+        mtx);
+    auto d_sor =
+        sor_type::build().with_relaxation_factor(1.3).on(exec)->generate(
+            d_mtx);
+
+    sor->apply(b, x);
+    d_sor->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
+
+
+TEST_F(Sor, GenerateSymmetricIsEquivalentToRef)
+{
+    auto sor = sor_type::build()
+                   .with_symmetric(true)
+                   .with_relaxation_factor(0.8)
+                   .on(ref)
+                   ->generate(mtx);
+    auto d_sor = sor_type::build()
+                     .with_symmetric(true)
+                     .with_relaxation_factor(0.8)
+                     .on(exec)
+                     ->generate(d_mtx);
+
+    sor->apply(b, x);
+    d_sor->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
+
+
+TEST_F(Sor, GaussSeidelIsEquivalentToRef)
+{
+    auto gs = gs_type::build().with_symmetric(true).on(ref)->generate(mtx);
+    auto d_gs = gs_type::build().with_symmetric(true).on(exec)->generate(d_mtx);
+
+    gs->apply(b, x);
+    d_gs->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
@@ -0,0 +1,152 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2023, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/reorder/coloring.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Coloring : public CommonTestFixture {
+protected:
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type =
+        gko::experimental::reorder::Coloring<value_type, index_type>;
+    using coloring_distance = gko::experimental::reorder::coloring_distance;
+
+    Coloring() : rand_engine(42), color_ptrs{ref}, dcolor_ptrs{ref}
+    {
+        mtx = gko::test::generate_random_matrix<matrix_type>(
+            1000, 1000, std::uniform_int_distribution<>(0, 20),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        dmtx = gko::clone(exec, mtx);
+    }
+
+    // checks that the permutation groups the rows by color according to
+    // color_ptrs, and that no two rows of the same color are within the
+    // given distance in the symmetrized pattern of mtx
+    void assert_valid_coloring(
+        const gko::matrix::Permutation<index_type>* perm,
+        const gko::array<index_type>& color_ptrs, coloring_distance distance)
+    {
+        const auto host_perm = gko::clone(ref, perm);
+        const auto num_rows = static_cast<index_type>(mtx->get_size()[0]);
+        const auto num_colors =
+            static_cast<index_type>(color_ptrs.get_num_elems()) - 1;
+        const auto ptrs = color_ptrs.get_const_data();
+        const auto perm_idxs = host_perm->get_const_permutation();
+        ASSERT_EQ(ptrs[0], 0);
+        ASSERT_EQ(ptrs[num_colors], num_rows);
+        std::vector<index_type> colors(num_rows, -1);
+        for (index_type color = 0; color < num_colors; color++) {
+            ASSERT_LT(ptrs[color], ptrs[color + 1]);
+            for (auto i = ptrs[color]; i < ptrs[color + 1]; i++) {
+                ASSERT_EQ(colors[perm_idxs[i]], -1);
+                colors[perm_idxs[i]] = color;
+            }
+        }
+        std::vector<std::vector<index_type>> neighbors(num_rows);
+        const auto row_ptrs = mtx->get_const_row_ptrs();
+        const auto col_idxs = mtx->get_const_col_idxs();
+        for (index_type row = 0; row < num_rows; row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                if (col != row) {
+                    neighbors[row].push_back(col);
+                    neighbors[col].push_back(row);
+                }
+            }
+        }
+        for (index_type row = 0; row < num_rows; row++) {
+            for (auto neighbor : neighbors[row]) {
+                ASSERT_NE(colors[row], colors[neighbor]);
+                if (distance == coloring_distance::two) {
+                    for (auto neighbor2 : neighbors[neighbor]) {
+                        if (neighbor2 != row) {
+                            ASSERT_NE(colors[row], colors[neighbor2]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::default_random_engine rand_engine;
+    std::shared_ptr<matrix_type> mtx;
+    std::shared_ptr<matrix_type> dmtx;
+    gko::array<index_type> color_ptrs;
+    gko::array<index_type> dcolor_ptrs;
+};
+
+
+TEST_F(Coloring, DistanceOneColoringIsValid)
+{
+    auto dperm = reorder_type::build().on(exec)->generate(dmtx, dcolor_ptrs);
+
+    assert_valid_coloring(dperm.get(), dcolor_ptrs, coloring_distance::one);
+}
+
+
+TEST_F(Coloring, DistanceTwoColoringIsValid)
+{
+    auto dperm = reorder_type::build()
+                     .with_distance(coloring_distance::two)
+                     .on(exec)
+                     ->generate(dmtx, dcolor_ptrs);
+
+    assert_valid_coloring(dperm.get(), dcolor_ptrs, coloring_distance::two);
+}
+
+
+TEST_F(Coloring, NumberOfColorsIsComparableToRef)
+{
+    auto dperm = reorder_type::build().on(exec)->generate(dmtx, dcolor_ptrs);
+    auto perm = reorder_type::build().on(ref)->generate(mtx, color_ptrs);
+
+    // the speculative parallel coloring may differ from the sequential one,
+    // but should not need significantly more colors
+    ASSERT_LE(dcolor_ptrs.get_num_elems(), 2 * color_ptrs.get_num_elems());
+}
@@ -85,3 +85,25 @@ TYPED_TEST(NestedDissection, ResultIsEquivalentToRef)
         this->exec, this->mtx->get_size()[0], dperm->get_permutation());
     GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
 }
+
+
+TYPED_TEST(NestedDissection, NativeResultIsEquivalentToRef)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto perm = reorder_type::build()
+                    .with_use_metis(false)
+                    .with_max_leaf_size(8u)
+                    .on(this->ref)
+                    ->generate(this->mtx);
+    auto dperm = reorder_type::build()
+                     .with_use_metis(false)
+                     .with_max_leaf_size(8u)
+                     .on(this->exec)
+                     ->generate(this->dmtx);
+
+    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
+                                           perm->get_permutation());
+    auto dperm_array = gko::make_array_view(
+        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+}
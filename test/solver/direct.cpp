@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/factorization/lu.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
+#include <ginkgo/core/reorder/amd.hpp>
 #include <ginkgo/core/solver/direct.hpp>
 
 
@@ -73,6 +74,8 @@ protected:
         gko::experimental::solver::Direct<value_type, index_type>;
     using matrix_type = typename factorization_type::matrix_type;
     using vector_type = gko::matrix::Dense<value_type>;
+    using reorder_type =
+        gko::experimental::reorder::Amd<value_type, index_type>;
 
     Direct() : rand_engine(633) {}
 
@@ -87,7 +90,8 @@ protected:
             rand_engine, ref);
     }
 
-    void initialize_data(const char* mtx_filename, int nrhs)
+    void initialize_data(const char* mtx_filename, int nrhs,
+                         bool reorder = false)
     {
         std::ifstream s_mtx{mtx_filename};
         mtx = gko::read<matrix_type>(s_mtx, ref);
@@ -97,6 +101,9 @@ protected:
                       .with_factorization(factorization_type::build()
                                               .with_symmetric_sparsity(true)
                                               .on(ref))
+                      .with_reordering(
+                          reorder ? gko::share(reorder_type::build().on(ref))
+                                  : nullptr)
                       .with_num_rhs(static_cast<gko::size_type>(nrhs))
                       .on(ref);
         alpha = gen_mtx(1, 1);
@@ -107,6 +114,9 @@ protected:
                        .with_factorization(factorization_type::build()
                                                .with_symmetric_sparsity(true)
                                                .on(exec))
+                       .with_reordering(
+                           reorder ? gko::share(reorder_type::build().on(exec))
+                                   : nullptr)
                        .with_num_rhs(static_cast<gko::size_type>(nrhs))
                        .on(exec);
         dalpha = gko::clone(exec, alpha);
@@ -208,4 +218,34 @@ TYPED_TEST(Direct, AdvancedApplyToMultipleRhsIsEquivalentToRef)
 }
 
 
+TYPED_TEST(Direct, ApplyWithReorderingIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    this->initialize_data(gko::matrices::location_ani1_mtx, 6, true);
+    auto solver = this->factory->generate(this->mtx);
+    auto dsolver = this->dfactory->generate(this->dmtx);
+
+    solver->apply(this->input, this->output);
+    dsolver->apply(this->dinput, this->doutput);
+
+    GKO_ASSERT_MTX_NEAR(this->output, this->doutput,
+                        100 * r<value_type>::value);
+}
+
+
+TYPED_TEST(Direct, AdvancedApplyWithReorderingIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    this->initialize_data(gko::matrices::location_ani1_mtx, 6, true);
+    auto solver = this->factory->generate(this->mtx);
+    auto dsolver = this->dfactory->generate(this->dmtx);
+
+    solver->apply(this->alpha, this->input, this->beta, this->output);
+    dsolver->apply(this->dalpha, this->dinput, this->dbeta, this->doutput);
+
+    GKO_ASSERT_MTX_NEAR(this->output, this->doutput,
+                        100 * r<value_type>::value);
+}
+
+
 }  // namespace
@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/solver/cgs.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
 #include <ginkgo/core/solver/fcg.hpp>
 #include <ginkgo/core/solver/gcr.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
@@ -217,6 +218,12 @@ struct Ir : SimpleSolverTest<gko::solver::Ir<solver_value_type>> {
 };
 
 
+struct Chebyshev
+    : SimpleSolverTest<gko::solver::Chebyshev<solver_value_type>> {
+    static double tolerance() { return 1e5 * r<value_type>::value; }
+};
+
+
 template <unsigned dimension>
 struct CbGmres : SimpleSolverTest<gko::solver::CbGmres<solver_value_type>> {
     static constexpr bool will_not_allocate() { return false; }
@@ -920,9 +927,9 @@ using SolverTypes =
     ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab,
                      /* "IDR uses different initialization approaches even when
                         deterministic", Idr<1>, Idr<4>,*/
-                     Ir, CbGmres<2>, CbGmres<10>, Gmres<2>, Gmres<10>,
-                     FGmres<2>, FGmres<10>, Gcr<2>, Gcr<10>, LowerTrs, UpperTrs,
-                     LowerTrsUnitdiag, UpperTrsUnitdiag
+                     Ir, Chebyshev, CbGmres<2>, CbGmres<10>, Gmres<2>,
+                     Gmres<10>, FGmres<2>, FGmres<10>, Gcr<2>, Gcr<10>,
+                     LowerTrs, UpperTrs, LowerTrsUnitdiag, UpperTrsUnitdiag
 #ifdef GKO_COMPILING_CUDA
                      ,
                      LowerTrsSyncfree, UpperTrsSyncfree,
@@ -365,6 +365,33 @@ TEST_F(UpperTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(UpperTrs, ApplyWideLevelsMtxIsEquivalentToRef)
+{
+    // each row only depends on the row 256 rows below, so the matrix has
+    // only a few levels with many independent rows each
+    const index_type size = 1024;
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+    std::normal_distribution<> dist(-1.0, 1.0);
+    for (index_type row = 0; row < size; ++row) {
+        if (row + 256 < size) {
+            data.nonzeros.emplace_back(row, row + 256, dist(rand_engine));
+        }
+        data.nonzeros.emplace_back(row, row, 2.0 + std::abs(dist(rand_engine)));
+    }
+    data.ensure_row_major_order();
+    initialize_data(size, 1, 1);
+    mtx->read(data);
+    dmtx = gko::clone(exec, mtx);
+    auto solver = solver_type::build().on(ref)->generate(mtx);
+    auto d_solver = solver_type::build().on(exec)->generate(dmtx);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 